@@ -4,6 +4,7 @@
 #  ORC_FOUND - system has Orc
 #  ORC_INCLUDE_DIR - the Orc include directory
 #  ORC_LIBRARIES - Orc library
+#  ORC_COMPILER - the orcc compiler, if found
 
 # Copyright (c) 2008 Laurent Montel, <montel@kde.org>
 #
@@ -32,5 +33,8 @@ find_library(ORC_LIBRARIES
              NAMES orc-0.4
              HINTS ${PKG_ORC_LIBRARY_DIRS} ${PKG_ORC_LIBDIR} ${GSTREAMER_ROOT}/lib)
 
+find_program(ORC_COMPILER orcc
+             HINTS ${PKG_ORC_PREFIX}/bin ${GSTREAMER_ROOT}/bin)
+
 include(FindPackageHandleStandardArgs)
 find_package_handle_standard_args(ORC  DEFAULT_MSG  ORC_LIBRARIES ORC_INCLUDE_DIR)
\ No newline at end of file
@@ -0,0 +1,66 @@
+# - macro orc_add_sources
+#
+# ORC_ADD_SOURCES(SOURCES_VAR NAME)
+#   Adds the code for the ORC kernels in NAME.orc of the current source
+#   directory to the list SOURCES_VAR, as NAME.c and NAME.h. Users include
+#   "NAME.h".
+#
+#   When orcc was found (ORC_COMPILER), the code is generated from NAME.orc
+#   at build time, so it always matches the kernels. Otherwise the
+#   NAME-dist.c and NAME-dist.h files kept next to NAME.orc are used.
+#
+#   With orcc, the orc-update target regenerates the -dist files in the
+#   source tree; run it and commit the result after changing a .orc file.
+#   Every build with orcc also writes the -dist files it would produce to
+#   the binary directory and warns if the committed ones differ, so that
+#   -dist files not produced by orcc are noticed.
+#
+# Redistribution and use is allowed according to the terms of the BSD license.
+# For details see the accompanying COPYING-CMAKE-SCRIPTS file.
+
+set(_ORC_CHECK_DIST_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/OrcCheckDist.cmake)
+
+macro(orc_add_sources _sources _name)
+    set(_orc_src ${CMAKE_CURRENT_SOURCE_DIR}/${_name}.orc)
+    set(_orc_dist ${CMAKE_CURRENT_SOURCE_DIR}/${_name}-dist)
+    set(_orc_c ${CMAKE_CURRENT_BINARY_DIR}/${_name}.c)
+    set(_orc_h ${CMAKE_CURRENT_BINARY_DIR}/${_name}.h)
+    set(_orc_check ${CMAKE_CURRENT_BINARY_DIR}/${_name}-dist)
+
+    if (ORC_COMPILER)
+        add_custom_command(OUTPUT ${_orc_h}
+            COMMAND ${ORC_COMPILER} --header --include glib.h -o ${_orc_h} ${_orc_src}
+            DEPENDS ${_orc_src}
+            COMMENT "Generating ${_name}.h from ${_name}.orc")
+        add_custom_command(OUTPUT ${_orc_c}
+            COMMAND ${ORC_COMPILER} --implementation --include glib.h -o ${_orc_c} ${_orc_src}
+            DEPENDS ${_orc_src} ${_orc_h}
+            COMMENT "Generating ${_name}.c from ${_name}.orc")
+        list(APPEND ${_sources} ${_orc_c} ${_orc_h})
+
+        if (NOT TARGET orc-update)
+            add_custom_target(orc-update)
+        endif ()
+        add_custom_target(orc-update-${_name}
+            COMMAND ${ORC_COMPILER} --header --include glib.h -o ${_orc_dist}.h ${_orc_src}
+            COMMAND ${ORC_COMPILER} --implementation --include glib.h -o ${_orc_dist}.c ${_orc_src}
+            DEPENDS ${_orc_src}
+            COMMENT "Updating ${_name}-dist.c and ${_name}-dist.h")
+        add_dependencies(orc-update orc-update-${_name})
+
+        add_custom_command(OUTPUT ${_orc_check}.c ${_orc_check}.h
+            COMMAND ${ORC_COMPILER} --header --include glib.h -o ${_orc_check}.h ${_orc_src}
+            COMMAND ${ORC_COMPILER} --implementation --include glib.h -o ${_orc_check}.c ${_orc_src}
+            COMMAND ${CMAKE_COMMAND} -DGENERATED=${_orc_check} -DDIST=${_orc_dist}
+                -DNAME=${_name} -P ${_ORC_CHECK_DIST_SCRIPT}
+            DEPENDS ${_orc_src} ${_orc_dist}.c ${_orc_dist}.h
+            COMMENT "Checking ${_name}-dist.c and ${_name}-dist.h against orcc")
+        add_custom_target(orc-check-${_name} ALL
+            DEPENDS ${_orc_check}.c ${_orc_check}.h)
+    else ()
+        configure_file(${_orc_dist}.h ${_orc_h} COPYONLY)
+        list(APPEND ${_sources} ${_orc_dist}.c ${_orc_h})
+    endif ()
+
+    include_directories(BEFORE ${CMAKE_CURRENT_BINARY_DIR})
+endmacro(orc_add_sources)
@@ -0,0 +1,18 @@
+# - script run by orc_add_sources to compare the committed -dist files with
+# the output of orcc
+#
+#   cmake -DGENERATED=<prefix> -DDIST=<prefix> -DNAME=<name> -P OrcCheckDist.cmake
+#
+# Redistribution and use is allowed according to the terms of the BSD license.
+# For details see the accompanying COPYING-CMAKE-SCRIPTS file.
+
+foreach (_ext c h)
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files
+        ${GENERATED}.${_ext} ${DIST}.${_ext}
+        RESULT_VARIABLE _differ OUTPUT_QUIET ERROR_QUIET)
+    if (_differ)
+        message(WARNING "${NAME}-dist.${_ext} doesn't match the output of "
+            "orcc, builds without orcc would use stale code. Run the "
+            "orc-update target and commit the result.")
+    endif ()
+endforeach ()
@@ -0,0 +1,195 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/*
+ * A small pool of persistent worker threads used to split per-frame work
+ * (usually into row stripes) across cores. The pool is created once, e.g. in
+ * GstBaseTransform::start or when the "n-threads" property changes, so no
+ * threads are spawned per frame.
+ *
+ * gst_vision_task_runner_run() executes func once for each of the n_threads
+ * entries of task_data and returns when all of them have completed. The
+ * calling (streaming) thread takes part in the work, so a runner with
+ * n_threads == 1 has no worker threads and just calls func directly.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "gstvisiontaskrunner.h"
+
+struct _GstVisionTaskRunner
+{
+  GMutex lock;
+  GCond cond_todo;
+  GCond cond_done;
+
+  GThread **threads;
+  guint n_threads;
+
+  /* current job, protected by lock */
+  GstVisionTaskFunc func;
+  gpointer *task_data;
+  guint n_todo;                 /* index of the next unclaimed task */
+  guint n_done;                 /* number of completed tasks */
+
+  gboolean quit;
+};
+
+/* Claim and run tasks until none are left, must be called with lock held */
+static void
+gst_vision_task_runner_work (GstVisionTaskRunner * runner)
+{
+  while (runner->n_todo < runner->n_threads) {
+    guint idx = runner->n_todo++;
+
+    g_mutex_unlock (&runner->lock);
+    runner->func (runner->task_data[idx]);
+    g_mutex_lock (&runner->lock);
+
+    runner->n_done++;
+    if (runner->n_done == runner->n_threads)
+      g_cond_signal (&runner->cond_done);
+  }
+}
+
+static gpointer
+gst_vision_task_runner_thread (gpointer data)
+{
+  GstVisionTaskRunner *runner = data;
+
+  g_mutex_lock (&runner->lock);
+  while (!runner->quit) {
+    gst_vision_task_runner_work (runner);
+    if (runner->quit)
+      break;
+    g_cond_wait (&runner->cond_todo, &runner->lock);
+  }
+  g_mutex_unlock (&runner->lock);
+
+  return NULL;
+}
+
+/**
+ * gst_vision_task_runner_new:
+ * @n_threads: number of threads, 0 to use the number of processors
+ *
+ * Returns: a new #GstVisionTaskRunner, free with gst_vision_task_runner_free()
+ */
+GstVisionTaskRunner *
+gst_vision_task_runner_new (guint n_threads)
+{
+  GstVisionTaskRunner *runner;
+  guint i;
+
+  if (n_threads == 0)
+    n_threads = g_get_num_processors ();
+
+  runner = g_new0 (GstVisionTaskRunner, 1);
+  g_mutex_init (&runner->lock);
+  g_cond_init (&runner->cond_todo);
+  g_cond_init (&runner->cond_done);
+  runner->n_threads = MAX (n_threads, 1);
+
+  /* nothing to do yet, keep workers asleep */
+  runner->n_todo = runner->n_threads;
+  runner->n_done = runner->n_threads;
+
+  /* the calling thread always runs the first task */
+  runner->threads = g_new0 (GThread *, runner->n_threads);
+  for (i = 1; i < runner->n_threads; i++) {
+    runner->threads[i] = g_thread_new ("visiontask",
+        gst_vision_task_runner_thread, runner);
+  }
+
+  return runner;
+}
+
+/**
+ * gst_vision_task_runner_free:
+ * @runner: a #GstVisionTaskRunner
+ *
+ * Stops and joins the worker threads, then frees @runner.
+ */
+void
+gst_vision_task_runner_free (GstVisionTaskRunner * runner)
+{
+  guint i;
+
+  if (runner == NULL)
+    return;
+
+  g_mutex_lock (&runner->lock);
+  runner->quit = TRUE;
+  g_cond_broadcast (&runner->cond_todo);
+  g_mutex_unlock (&runner->lock);
+
+  for (i = 1; i < runner->n_threads; i++)
+    g_thread_join (runner->threads[i]);
+
+  g_free (runner->threads);
+  g_cond_clear (&runner->cond_done);
+  g_cond_clear (&runner->cond_todo);
+  g_mutex_clear (&runner->lock);
+  g_free (runner);
+}
+
+/**
+ * gst_vision_task_runner_get_n_threads:
+ * @runner: a #GstVisionTaskRunner
+ *
+ * Returns: the number of tasks each call to gst_vision_task_runner_run()
+ * expects, which is the number of threads including the caller
+ */
+guint
+gst_vision_task_runner_get_n_threads (GstVisionTaskRunner * runner)
+{
+  return runner->n_threads;
+}
+
+/**
+ * gst_vision_task_runner_run:
+ * @runner: a #GstVisionTaskRunner
+ * @func: function to run for each task
+ * @task_data: array of gst_vision_task_runner_get_n_threads() pointers
+ *
+ * Runs @func on every element of @task_data in parallel and blocks until all
+ * tasks are complete. Must not be called concurrently on the same runner.
+ */
+void
+gst_vision_task_runner_run (GstVisionTaskRunner * runner,
+    GstVisionTaskFunc func, gpointer * task_data)
+{
+  if (runner->n_threads == 1) {
+    func (task_data[0]);
+    return;
+  }
+
+  g_mutex_lock (&runner->lock);
+  runner->func = func;
+  runner->task_data = task_data;
+  runner->n_todo = 0;
+  runner->n_done = 0;
+  g_cond_broadcast (&runner->cond_todo);
+
+  gst_vision_task_runner_work (runner);
+  while (runner->n_done < runner->n_threads)
+    g_cond_wait (&runner->cond_done, &runner->lock);
+  g_mutex_unlock (&runner->lock);
+}
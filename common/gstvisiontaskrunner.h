@@ -0,0 +1,51 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __GST_VISION_TASK_RUNNER_H__
+#define __GST_VISION_TASK_RUNNER_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * GstVisionTaskFunc:
+ * @data: the per-task data passed to gst_vision_task_runner_run()
+ *
+ * Function called once per task, typically to process one stripe of rows.
+ */
+typedef void (*GstVisionTaskFunc) (gpointer data);
+
+typedef struct _GstVisionTaskRunner GstVisionTaskRunner;
+
+G_GNUC_INTERNAL
+GstVisionTaskRunner *gst_vision_task_runner_new (guint n_threads);
+
+G_GNUC_INTERNAL
+void gst_vision_task_runner_free (GstVisionTaskRunner * runner);
+
+G_GNUC_INTERNAL
+guint gst_vision_task_runner_get_n_threads (GstVisionTaskRunner * runner);
+
+G_GNUC_INTERNAL
+void gst_vision_task_runner_run (GstVisionTaskRunner * runner,
+    GstVisionTaskFunc func, gpointer * task_data);
+
+G_END_DECLS
+
+#endif /* __GST_VISION_TASK_RUNNER_H__ */
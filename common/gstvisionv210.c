@@ -0,0 +1,172 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/*
+ * Helpers for v210 rows, which pack the chroma and luma samples of three
+ * pixels into two 32-bit words of three 10-bit samples each.
+ *
+ * That ratio doesn't map onto the power of two element sizes of ORC, so
+ * kernels work on one element per group of two words: the packers read
+ * three planar rows holding the first, second and third pixel of each
+ * group, the unpackers write the three pixels of a group into one 64-bit
+ * element. The functions below convert between these and rows of 16-bit
+ * pixels, stopping exactly at the width.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "gstvisionv210.h"
+
+#include <gst/gst.h>
+#include <string.h>
+
+/**
+ * gst_vision_v210_split_row:
+ * @p0: first pixel of each group
+ * @p1: second pixel of each group
+ * @p2: third pixel of each group
+ * @src: row of @width pixels
+ * @width: width in pixels
+ *
+ * Split a row into groups of three pixels. Pixels of the last group past
+ * @width are set to 0.
+ */
+void
+gst_vision_v210_split_row (guint16 * p0, guint16 * p1, guint16 * p2,
+    const guint16 * src, gint width)
+{
+  gint x, i;
+
+  for (x = 0, i = 0; x + 3 <= width; x += 3, i++) {
+    p0[i] = src[x];
+    p1[i] = src[x + 1];
+    p2[i] = src[x + 2];
+  }
+
+  if (x < width) {
+    p0[i] = src[x];
+    p1[i] = x + 1 < width ? src[x + 1] : 0;
+    p2[i] = 0;
+  }
+}
+
+/**
+ * gst_vision_v210_split_row_8:
+ * @p0: first pixel of each group
+ * @p1: second pixel of each group
+ * @p2: third pixel of each group
+ * @src: row of @width 8-bit pixels
+ * @width: width in pixels
+ *
+ * Like gst_vision_v210_split_row(), widening 8-bit pixels to 16 bits.
+ */
+void
+gst_vision_v210_split_row_8 (guint16 * p0, guint16 * p1, guint16 * p2,
+    const guint8 * src, gint width)
+{
+  gint x, i;
+
+  for (x = 0, i = 0; x + 3 <= width; x += 3, i++) {
+    p0[i] = src[x];
+    p1[i] = src[x + 1];
+    p2[i] = src[x + 2];
+  }
+
+  if (x < width) {
+    p0[i] = src[x];
+    p1[i] = x + 1 < width ? src[x + 1] : 0;
+    p2[i] = 0;
+  }
+}
+
+/**
+ * gst_vision_v210_store_groups:
+ * @dst: row of @width pixels
+ * @groups: one element per group, holding its three pixels from the low
+ *   16 bits up, the top 16 bits unused
+ * @width: width in pixels
+ *
+ * Store the groups written by a kernel back to back, never writing past
+ * @width. Every group but the last is stored whole and the next one
+ * overwrites its unused fourth pixel.
+ */
+void
+gst_vision_v210_store_groups (guint16 * dst, const guint64 * groups,
+    gint width)
+{
+  gint x, i;
+
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+  for (x = 0, i = 0; x + 4 <= width; x += 3, i++)
+    memcpy (dst + x, groups + i, sizeof (guint64));
+#else
+  for (x = 0, i = 0; x + 4 <= width; x += 3, i++) {
+    dst[x] = groups[i];
+    dst[x + 1] = groups[i] >> 16;
+    dst[x + 2] = groups[i] >> 32;
+  }
+#endif
+
+  for (; x < width; x++)
+    dst[x] = groups[i] >> (16 * (x % 3));
+}
+
+/**
+ * gst_vision_v210_repack_yvyu10:
+ * @dst: v210 row
+ * @src: row of 10-bit samples packed back to back, little endian, in
+ *   Y U Y V order
+ * @width: width in pixels
+ *
+ * Reorder a row of packed 10-bit 4:2:2 samples into v210. Both formats
+ * store six pixels in 16 bytes, and whole groups of six are converted.
+ */
+void
+gst_vision_v210_repack_yvyu10 (guint32 * dst, const guint8 * src, gint width)
+{
+  const gint n_groups = (width + 5) / 6;
+  gint i;
+
+  for (i = 0; i < n_groups; i++, src += 16, dst += 4) {
+    guint32 a0 = GST_READ_UINT32_LE (src + 0);
+    guint32 a1 = GST_READ_UINT32_LE (src + 4);
+    guint32 a2 = GST_READ_UINT32_LE (src + 8);
+    guint32 a3 = GST_READ_UINT32_LE (src + 12);
+
+    guint32 y0 = (a0 >> 0) & 0x3ff;
+    guint32 u0 = (a0 >> 10) & 0x3ff;
+    guint32 y1 = (a0 >> 20) & 0x3ff;
+    guint32 v0 = ((a0 >> 30) | (a1 << 2)) & 0x3ff;
+    guint32 y2 = (a1 >> 8) & 0x3ff;
+    guint32 u2 = (a1 >> 18) & 0x3ff;
+
+    guint32 y3 = (a2 >> 0) & 0x3ff;
+    guint32 v2 = (a2 >> 10) & 0x3ff;
+    guint32 y4 = (a2 >> 20) & 0x3ff;
+    guint32 u4 = ((a2 >> 30) | (a3 << 2)) & 0x3ff;
+    guint32 y5 = (a3 >> 8) & 0x3ff;
+    guint32 v4 = (a3 >> 18) & 0x3ff;
+
+    GST_WRITE_UINT32_LE (dst + 0, (v0 << 20) | (y0 << 10) | u0);
+    GST_WRITE_UINT32_LE (dst + 1, (y2 << 20) | (u2 << 10) | y1);
+    GST_WRITE_UINT32_LE (dst + 2, (u4 << 20) | (y3 << 10) | v2);
+    GST_WRITE_UINT32_LE (dst + 3, (y5 << 20) | (v4 << 10) | y4);
+  }
+}
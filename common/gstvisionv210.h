@@ -0,0 +1,53 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __GST_VISION_V210_H__
+#define __GST_VISION_V210_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * GST_VISION_V210_N_GROUPS:
+ * @width: width in pixels
+ *
+ * Number of groups of three pixels covering @width. Each group is stored
+ * in two v210 words, and v210 rows always hold whole groups.
+ */
+#define GST_VISION_V210_N_GROUPS(width) (((width) + 2) / 3)
+
+G_GNUC_INTERNAL
+void gst_vision_v210_split_row (guint16 * p0, guint16 * p1, guint16 * p2,
+    const guint16 * src, gint width);
+
+G_GNUC_INTERNAL
+void gst_vision_v210_split_row_8 (guint16 * p0, guint16 * p1, guint16 * p2,
+    const guint8 * src, gint width);
+
+G_GNUC_INTERNAL
+void gst_vision_v210_store_groups (guint16 * dst, const guint64 * groups,
+    gint width);
+
+G_GNUC_INTERNAL
+void gst_vision_v210_repack_yvyu10 (guint32 * dst, const guint8 * src,
+    gint width);
+
+G_END_DECLS
+
+#endif /* __GST_VISION_V210_H__ */
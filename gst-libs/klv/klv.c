@@ -39,23 +39,36 @@
 #include "config.h"
 #endif
 
+#include <string.h>
+
 #include <gst/tag/tag.h>
 #include "klv.h"
 
 /* We hide the implementation details, so that we have the option to implement
- * different/more efficient storage in future (unfortunately we can't put the
- * data inline with the meta allocation though since it's registered as fixed
- * size, although that could probably be fixed in a backwards compatible way).
- * GBytes means effectively two allocations, one for the GBytes, one for the
- * data. Plus one for the KLV meta struct.
+ * different/more efficient storage in future.
+ *
+ * Small payloads, which is most local sets, are copied inline into the meta
+ * struct itself, so adding or copying the meta needs no allocation beyond
+ * the meta. Larger payloads are kept in a GBytes, which is shared by
+ * reference when the meta is copied to another buffer. A GBytes of an
+ * inline payload is only created if gst_klv_meta_get_bytes() is called.
  *
  * For now we also assume that KLV data is always self-contained and one single
  * chunk of data, but in future we may have use cases where we might want to
  * relax that requirement. */
+#define GST_KLV_META_INLINE_SIZE 256
+
 typedef struct
 {
   GstKLVMeta klv_meta;
+
+  /* shared payload, NULL if inline */
   GBytes *bytes;
+
+  /* inline payload, and a GBytes copy of it made on request */
+  gsize size;
+  guint8 data[GST_KLV_META_INLINE_SIZE];
+  GBytes *inline_bytes;
 } GstKLVMetaImpl;
 
 GType
@@ -77,6 +90,8 @@ gst_klv_meta_init (GstMeta * meta, gpointer params, GstBuffer * buffer)
   GstKLVMetaImpl *impl = (GstKLVMetaImpl *) meta;
 
   impl->bytes = NULL;
+  impl->size = 0;
+  impl->inline_bytes = NULL;
   return TRUE;
 }
 
@@ -87,21 +102,31 @@ gst_klv_meta_clear (GstMeta * meta, GstBuffer * buffer)
 
   if (impl->bytes != NULL)
     g_bytes_unref (impl->bytes);
+  if (impl->inline_bytes != NULL)
+    g_bytes_unref (impl->inline_bytes);
 }
 
 static gboolean
 gst_klv_meta_transform (GstBuffer * dest, GstMeta * meta,
     GstBuffer * buffer, GQuark type, gpointer data)
 {
-  GstKLVMetaImpl *smeta;
-  GstKLVMeta *dmeta;
+  GstKLVMetaImpl *smeta, *dmeta;
 
   smeta = (GstKLVMetaImpl *) meta;
 
   if (GST_META_TRANSFORM_IS_COPY (type)) {
-    dmeta = gst_buffer_add_klv_meta_from_bytes (dest, smeta->bytes);
+    /* the payload was validated when first added */
+    dmeta = (GstKLVMetaImpl *) gst_buffer_add_meta (dest, GST_KLV_META_INFO,
+        NULL);
     if (!dmeta)
       return FALSE;
+
+    if (smeta->bytes != NULL) {
+      dmeta->bytes = g_bytes_ref (smeta->bytes);
+    } else {
+      dmeta->size = smeta->size;
+      memcpy (dmeta->data, smeta->data, smeta->size);
+    }
   } else {
     return FALSE;
   }
@@ -126,31 +151,62 @@ gst_klv_meta_get_info (void)
 
 /* Add KLV meta data to a buffer */
 
+/* KLV coding shall use and only use a fixed 16-byte SMPTE-administered
+ * Universal Label, according to SMPTE 298M as Key (Rec. ITU R-BT.1653-1) */
+static gboolean
+gst_klv_meta_is_valid (gconstpointer data, gsize size)
+{
+  if (size < 16 || GST_READ_UINT32_BE (data) != 0x060E2B34) {
+    GST_ERROR ("Trying to attach a invalid KLV meta data to buffer");
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+static GstKLVMetaImpl *
+gst_buffer_add_klv_meta_impl (GstBuffer * buffer, gsize size)
+{
+  GST_TRACE ("Adding %u bytes of KLV data to buffer %p", (guint) size, buffer);
+
+  return (GstKLVMetaImpl *) gst_buffer_add_meta (buffer, GST_KLV_META_INFO,
+      NULL);
+}
+
 static GstKLVMeta *
 gst_buffer_add_klv_meta_internal (GstBuffer * buffer, GBytes * bytes)
 {
   GstKLVMetaImpl *impl;
-  GstKLVMeta *meta;
   gconstpointer data;
   gsize size;
 
-  /* KLV coding shall use and only use a fixed 16-byte SMPTE-administered
-   * Universal Label, according to SMPTE 298M as Key (Rec. ITU R-BT.1653-1) */
   data = g_bytes_get_data (bytes, &size);
-  if (size < 16 || GST_READ_UINT32_BE (data) != 0x060E2B34) {
-    GST_ERROR ("Trying to attach a invalid KLV meta data to buffer");
+  if (!gst_klv_meta_is_valid (data, size)) {
     g_bytes_unref (bytes);
     return NULL;
   }
 
-  meta = (GstKLVMeta *) gst_buffer_add_meta (buffer, GST_KLV_META_INFO, NULL);
+  impl = gst_buffer_add_klv_meta_impl (buffer, size);
+  impl->bytes = bytes;
+
+  return (GstKLVMeta *) impl;
+}
 
-  GST_TRACE ("Adding %u bytes of KLV data to buffer %p", (guint) size, buffer);
+/* copy small payloads inline, returns NULL if @data is too large */
+static GstKLVMeta *
+gst_buffer_add_klv_meta_inline (GstBuffer * buffer, const guint8 * data,
+    gsize size)
+{
+  GstKLVMetaImpl *impl;
 
-  impl = (GstKLVMetaImpl *) meta;
-  impl->bytes = bytes;
+  if (size > GST_KLV_META_INLINE_SIZE)
+    return NULL;
+
+  impl = gst_buffer_add_klv_meta_impl (buffer, size);
+  impl->size = size;
+  memcpy (impl->data, data, size);
 
-  return meta;
+  return (GstKLVMeta *) impl;
 }
 
 /**
@@ -171,9 +227,18 @@ GstKLVMeta *
 gst_buffer_add_klv_meta_from_data (GstBuffer * buffer, const guint8 * data,
     gsize size)
 {
+  GstKLVMeta *meta;
+
   g_return_val_if_fail (buffer != NULL, NULL);
   g_return_val_if_fail (data != NULL && size > 16, NULL);
 
+  if (!gst_klv_meta_is_valid (data, size))
+    return NULL;
+
+  meta = gst_buffer_add_klv_meta_inline (buffer, data, size);
+  if (meta)
+    return meta;
+
   return gst_buffer_add_klv_meta_internal (buffer, g_bytes_new (data, size));
 }
 
@@ -195,9 +260,22 @@ GstKLVMeta *
 gst_buffer_add_klv_meta_take_data (GstBuffer * buffer, guint8 * data,
     gsize size)
 {
+  GstKLVMeta *meta;
+
   g_return_val_if_fail (buffer != NULL, NULL);
   g_return_val_if_fail (data != NULL && size > 16, NULL);
 
+  if (!gst_klv_meta_is_valid (data, size)) {
+    g_free (data);
+    return NULL;
+  }
+
+  meta = gst_buffer_add_klv_meta_inline (buffer, data, size);
+  if (meta) {
+    g_free (data);
+    return meta;
+  }
+
   return gst_buffer_add_klv_meta_internal (buffer, g_bytes_new_take (data,
           size));
 }
@@ -279,6 +357,11 @@ gst_klv_meta_get_data (GstKLVMeta * klv_meta, gsize * size)
 
   impl = (GstKLVMetaImpl *) klv_meta;
 
+  if (impl->bytes == NULL) {
+    *size = impl->size;
+    return impl->data;
+  }
+
   return g_bytes_get_data (impl->bytes, size);
 }
 
@@ -299,6 +382,22 @@ gst_klv_meta_get_bytes (GstKLVMeta * klv_meta)
 
   impl = (GstKLVMetaImpl *) klv_meta;
 
+  if (impl->bytes == NULL) {
+    GBytes *bytes = g_atomic_pointer_get (&impl->inline_bytes);
+
+    /* the meta may be read from several threads when its buffer is shared,
+     * only the first GBytes created is published */
+    if (bytes == NULL) {
+      bytes = g_bytes_new (impl->data, impl->size);
+      if (!g_atomic_pointer_compare_and_exchange (&impl->inline_bytes, NULL,
+              bytes)) {
+        g_bytes_unref (bytes);
+        bytes = g_atomic_pointer_get (&impl->inline_bytes);
+      }
+    }
+    return bytes;
+  }
+
   return impl->bytes;
 }
 
@@ -312,6 +411,9 @@ gst_klv_meta_copy_boxed (gpointer boxed)
 
   copy = g_new (GstKLVMetaImpl, 1);
   copy->bytes = impl->bytes ? g_bytes_ref (impl->bytes) : NULL;
+  copy->size = impl->size;
+  memcpy (copy->data, impl->data, impl->size);
+  copy->inline_bytes = NULL;
   return copy;
 }
 
@@ -322,6 +424,8 @@ gst_klv_meta_free_boxed (gpointer boxed)
 
   if (impl->bytes)
     g_bytes_unref (impl->bytes);
+  if (impl->inline_bytes)
+    g_bytes_unref (impl->inline_bytes);
 
   g_free (impl);
 }
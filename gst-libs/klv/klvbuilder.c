@@ -0,0 +1,463 @@
+/* GStreamer KLV Metadata Support Library
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:gstklvbuilder
+ * @short_description: KLV local set building
+ * @title: KLV building
+ *
+ * <refsect2>
+ * <para>
+ * Building of local set packets such as the MISB ST 0601 UAS Datalink local
+ * set, ending with the ST 0601 checksum item.
+ * </para>
+ * <para>
+ * The items are laid out once and the packet is then rebuilt in place for
+ * every frame: only the values that change are overwritten, and the key,
+ * BER length and checksum are written around the items when the packet is
+ * finished. The scale functions map physical values onto the integer
+ * ranges ST 0601 uses for angles, positions and the like.
+ * </para>
+ * </refsect2>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "klvbuilder.h"
+
+/* Room in front of the items for the key and a BER length of up to four
+ * bytes, so that finishing a packet never has to move the items. */
+#define ITEMS_OFFSET (GST_KLV_KEY_SIZE + 5)
+
+/* the checksum item that finish() appends */
+#define CHECKSUM_ITEM_SIZE 4
+
+static void
+gst_klv_local_set_builder_ensure (GstKLVLocalSetBuilder * builder,
+    gsize extra)
+{
+  gsize needed = builder->size + extra + CHECKSUM_ITEM_SIZE;
+
+  if (needed <= builder->alloc)
+    return;
+
+  builder->alloc = MAX (needed, MAX (builder->alloc * 2, 128));
+  builder->data = g_realloc (builder->data, builder->alloc);
+}
+
+static guint
+ber_length_size (gsize length)
+{
+  guint n = 1;
+
+  if (length < 0x80)
+    return 1;
+
+  while (length) {
+    length >>= 8;
+    n++;
+  }
+  return n;
+}
+
+static guint8 *
+write_ber_length (guint8 * p, gsize length)
+{
+  guint n = ber_length_size (length);
+
+  if (n == 1) {
+    *p++ = length;
+    return p;
+  }
+
+  *p++ = 0x80 | (n - 1);
+  while (--n)
+    *p++ = length >> (8 * (n - 1));
+  return p;
+}
+
+static guint
+ber_oid_size (guint tag)
+{
+  guint n = 1;
+
+  while (tag >>= 7)
+    n++;
+  return n;
+}
+
+static guint8 *
+write_ber_oid (guint8 * p, guint tag)
+{
+  guint n = ber_oid_size (tag);
+
+  while (--n)
+    *p++ = 0x80 | ((tag >> (7 * n)) & 0x7f);
+  *p++ = tag & 0x7f;
+  return p;
+}
+
+static guint8 *
+write_uint_be (guint8 * p, guint64 value, gsize n_bytes)
+{
+  while (n_bytes--)
+    *p++ = value >> (8 * n_bytes);
+  return p;
+}
+
+/* reserves a new item at the end of the set and returns its value */
+static guint8 *
+gst_klv_local_set_builder_add (GstKLVLocalSetBuilder * builder, guint tag,
+    gsize size)
+{
+  guint8 *p;
+
+  gst_klv_local_set_builder_ensure (builder,
+      ber_oid_size (tag) + ber_length_size (size) + size);
+
+  p = builder->data + builder->size;
+  p = write_ber_oid (p, tag);
+  p = write_ber_length (p, size);
+  builder->size = (p - builder->data) + size;
+
+  return p;
+}
+
+/* looks up an existing item, returning its value */
+static guint8 *
+gst_klv_local_set_builder_lookup (GstKLVLocalSetBuilder * builder,
+    guint tag, gsize * size)
+{
+  GstKLVLocalSetItem item;
+
+  if (!gst_klv_local_set_find (builder->data + ITEMS_OFFSET,
+          builder->size - ITEMS_OFFSET, tag, &item))
+    return NULL;
+
+  *size = item.length;
+  return (guint8 *) item.value;
+}
+
+/**
+ * gst_klv_local_set_builder_init:
+ * @builder: a #GstKLVLocalSetBuilder
+ * @key: (array fixed-size=16): the Universal Label of the local set, e.g.
+ *     %GST_KLV_UAS_LOCAL_SET_KEY
+ *
+ * Initialises @builder with an empty local set. Free the resources it
+ * holds with gst_klv_local_set_builder_clear() when done.
+ */
+void
+gst_klv_local_set_builder_init (GstKLVLocalSetBuilder * builder,
+    const guint8 * key)
+{
+  g_return_if_fail (builder != NULL);
+  g_return_if_fail (key != NULL);
+
+  memcpy (builder->key, key, GST_KLV_KEY_SIZE);
+  builder->data = NULL;
+  builder->alloc = 0;
+  builder->size = ITEMS_OFFSET;
+  gst_klv_local_set_builder_ensure (builder, 0);
+}
+
+/**
+ * gst_klv_local_set_builder_clear:
+ * @builder: a #GstKLVLocalSetBuilder
+ *
+ * Frees the resources held by @builder.
+ */
+void
+gst_klv_local_set_builder_clear (GstKLVLocalSetBuilder * builder)
+{
+  g_return_if_fail (builder != NULL);
+
+  g_free (builder->data);
+  builder->data = NULL;
+  builder->alloc = 0;
+  builder->size = ITEMS_OFFSET;
+}
+
+/**
+ * gst_klv_local_set_builder_reset:
+ * @builder: a #GstKLVLocalSetBuilder
+ *
+ * Removes all items, keeping the allocated buffer.
+ */
+void
+gst_klv_local_set_builder_reset (GstKLVLocalSetBuilder * builder)
+{
+  g_return_if_fail (builder != NULL);
+
+  builder->size = ITEMS_OFFSET;
+}
+
+/**
+ * gst_klv_local_set_builder_put_data:
+ * @builder: a #GstKLVLocalSetBuilder
+ * @tag: the local tag, less than 2^28
+ * @data: (array length=size): the value
+ * @size: size of @data in bytes
+ *
+ * Appends an item to the local set.
+ */
+void
+gst_klv_local_set_builder_put_data (GstKLVLocalSetBuilder * builder,
+    guint tag, const guint8 * data, gsize size)
+{
+  guint8 *value;
+
+  g_return_if_fail (builder != NULL);
+  g_return_if_fail (tag < (1 << 28));
+  g_return_if_fail (data != NULL || size == 0);
+
+  value = gst_klv_local_set_builder_add (builder, tag, size);
+  if (size > 0)
+    memcpy (value, data, size);
+}
+
+/**
+ * gst_klv_local_set_builder_put_uint:
+ * @builder: a #GstKLVLocalSetBuilder
+ * @tag: the local tag, less than 2^28
+ * @value: the value
+ * @n_bytes: size of the item value, 1 to 8 bytes
+ *
+ * Appends an item with a big endian unsigned integer value.
+ */
+void
+gst_klv_local_set_builder_put_uint (GstKLVLocalSetBuilder * builder,
+    guint tag, guint64 value, guint n_bytes)
+{
+  guint8 *p;
+
+  g_return_if_fail (builder != NULL);
+  g_return_if_fail (tag < (1 << 28));
+  g_return_if_fail (n_bytes >= 1 && n_bytes <= 8);
+
+  p = gst_klv_local_set_builder_add (builder, tag, n_bytes);
+  write_uint_be (p, value, n_bytes);
+}
+
+/**
+ * gst_klv_local_set_builder_put_int:
+ * @builder: a #GstKLVLocalSetBuilder
+ * @tag: the local tag, less than 2^28
+ * @value: the value
+ * @n_bytes: size of the item value, 1 to 8 bytes
+ *
+ * Appends an item with a big endian two's complement integer value.
+ */
+void
+gst_klv_local_set_builder_put_int (GstKLVLocalSetBuilder * builder,
+    guint tag, gint64 value, guint n_bytes)
+{
+  gst_klv_local_set_builder_put_uint (builder, tag, (guint64) value, n_bytes);
+}
+
+/**
+ * gst_klv_local_set_builder_set_data:
+ * @builder: a #GstKLVLocalSetBuilder
+ * @tag: the local tag of an item added before
+ * @data: (array length=size): the new value
+ * @size: size of @data in bytes
+ *
+ * Overwrites the value of the first item with @tag in place.
+ *
+ * Returns: %TRUE if the item exists and @size matches its size
+ */
+gboolean
+gst_klv_local_set_builder_set_data (GstKLVLocalSetBuilder * builder,
+    guint tag, const guint8 * data, gsize size)
+{
+  guint8 *value;
+  gsize value_size;
+
+  g_return_val_if_fail (builder != NULL, FALSE);
+  g_return_val_if_fail (data != NULL || size == 0, FALSE);
+
+  value = gst_klv_local_set_builder_lookup (builder, tag, &value_size);
+  if (value == NULL || value_size != size)
+    return FALSE;
+
+  if (size > 0)
+    memcpy (value, data, size);
+  return TRUE;
+}
+
+/**
+ * gst_klv_local_set_builder_set_uint:
+ * @builder: a #GstKLVLocalSetBuilder
+ * @tag: the local tag of an item added before
+ * @value: the new value
+ *
+ * Overwrites the value of the first item with @tag in place, as a big
+ * endian unsigned integer of the item's size.
+ *
+ * Returns: %TRUE if the item exists and is 1 to 8 bytes long
+ */
+gboolean
+gst_klv_local_set_builder_set_uint (GstKLVLocalSetBuilder * builder,
+    guint tag, guint64 value)
+{
+  guint8 *p;
+  gsize size;
+
+  g_return_val_if_fail (builder != NULL, FALSE);
+
+  p = gst_klv_local_set_builder_lookup (builder, tag, &size);
+  if (p == NULL || size < 1 || size > 8)
+    return FALSE;
+
+  write_uint_be (p, value, size);
+  return TRUE;
+}
+
+/**
+ * gst_klv_local_set_builder_set_int:
+ * @builder: a #GstKLVLocalSetBuilder
+ * @tag: the local tag of an item added before
+ * @value: the new value
+ *
+ * Overwrites the value of the first item with @tag in place, as a big
+ * endian two's complement integer of the item's size.
+ *
+ * Returns: %TRUE if the item exists and is 1 to 8 bytes long
+ */
+gboolean
+gst_klv_local_set_builder_set_int (GstKLVLocalSetBuilder * builder,
+    guint tag, gint64 value)
+{
+  return gst_klv_local_set_builder_set_uint (builder, tag, (guint64) value);
+}
+
+/**
+ * gst_klv_local_set_builder_finish:
+ * @builder: a #GstKLVLocalSetBuilder
+ * @size: (out): size of the packet
+ *
+ * Completes the packet: appends the MISB ST 0601 checksum item and writes
+ * the key and BER length in front of the items. The items stay in
+ * @builder, so they can be updated and the packet finished again.
+ *
+ * Returns: (transfer none) (array length=size): the packet, valid until
+ *     @builder is next modified
+ */
+const guint8 *
+gst_klv_local_set_builder_finish (GstKLVLocalSetBuilder * builder,
+    gsize * size)
+{
+  guint8 *packet, *checksum;
+  gsize length, len_size, start, total;
+
+  g_return_val_if_fail (builder != NULL, NULL);
+  g_return_val_if_fail (builder->data != NULL, NULL);
+  g_return_val_if_fail (size != NULL, NULL);
+
+  length = builder->size - ITEMS_OFFSET + CHECKSUM_ITEM_SIZE;
+  len_size = ber_length_size (length);
+  g_return_val_if_fail (len_size <= ITEMS_OFFSET - GST_KLV_KEY_SIZE, NULL);
+
+  start = ITEMS_OFFSET - len_size - GST_KLV_KEY_SIZE;
+  packet = builder->data + start;
+  memcpy (packet, builder->key, GST_KLV_KEY_SIZE);
+  write_ber_length (packet + GST_KLV_KEY_SIZE, length);
+
+  /* the checksum covers everything up to and including its own length */
+  checksum = builder->data + builder->size;
+  checksum[0] = GST_KLV_TAG_CHECKSUM;
+  checksum[1] = 2;
+  total = builder->size + CHECKSUM_ITEM_SIZE - start;
+  GST_WRITE_UINT16_BE (checksum + 2, gst_klv_checksum (packet, total - 2));
+
+  *size = total;
+  return packet;
+}
+
+/**
+ * gst_klv_scale_int:
+ * @value: the value to map
+ * @limit: the largest magnitude of @value
+ * @n_bytes: size of the integer, 1 to 8 bytes
+ *
+ * Maps @value from -@limit..@limit onto the symmetric signed integer range
+ * of @n_bytes bytes, as ST 0601 does for latitudes, longitudes and
+ * angles. Out of range values map to the most negative integer, which
+ * ST 0601 reserves as an error indicator.
+ *
+ * Returns: the integer to store
+ */
+gint64
+gst_klv_scale_int (gdouble value, gdouble limit, guint n_bytes)
+{
+  gint64 range;
+  gdouble x;
+
+  g_return_val_if_fail (n_bytes >= 1 && n_bytes <= 8, 0);
+  g_return_val_if_fail (limit > 0.0, 0);
+
+  range = (gint64) (G_MAXUINT64 >> (65 - 8 * n_bytes));
+
+  /* also catches NaN */
+  if (!(value >= -limit && value <= limit))
+    return -range - 1;
+
+  x = value / limit * (gdouble) range;
+  x = x < 0.0 ? x - 0.5 : x + 0.5;
+  if (x >= (gdouble) range)
+    return range;
+  if (x <= (gdouble) - range)
+    return -range;
+  return (gint64) x;
+}
+
+/**
+ * gst_klv_scale_uint:
+ * @value: the value to map
+ * @min: the smallest value
+ * @max: the largest value
+ * @n_bytes: size of the integer, 1 to 8 bytes
+ *
+ * Maps @value from @min..@max onto the unsigned integer range of @n_bytes
+ * bytes, as ST 0601 does for headings and altitudes. Out of range values
+ * are clamped.
+ *
+ * Returns: the integer to store
+ */
+guint64
+gst_klv_scale_uint (gdouble value, gdouble min, gdouble max, guint n_bytes)
+{
+  guint64 range;
+  gdouble x;
+
+  g_return_val_if_fail (n_bytes >= 1 && n_bytes <= 8, 0);
+  g_return_val_if_fail (max > min, 0);
+
+  range = G_MAXUINT64 >> (64 - 8 * n_bytes);
+
+  x = (value - min) / (max - min) * (gdouble) range + 0.5;
+  if (!(x > 0.0))
+    return 0;
+  if (x >= (gdouble) range)
+    return range;
+  return (guint64) x;
+}
@@ -0,0 +1,118 @@
+/* GStreamer KLV Metadata Support Library
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_KLV_BUILDER_H__
+#define __GST_KLV_BUILDER_H__
+
+#include "klvparse.h"
+
+G_BEGIN_DECLS
+
+/**
+ * GstKLVUasTag:
+ * @GST_KLV_UAS_TAG_CHECKSUM: checksum, uint16
+ * @GST_KLV_UAS_TAG_PRECISION_TIME_STAMP: microseconds since the epoch, uint64
+ * @GST_KLV_UAS_TAG_PLATFORM_HEADING: 0..360 degrees, uint16
+ * @GST_KLV_UAS_TAG_PLATFORM_PITCH: +/-20 degrees, int16
+ * @GST_KLV_UAS_TAG_PLATFORM_ROLL: +/-50 degrees, int16
+ * @GST_KLV_UAS_TAG_IMAGE_COORDINATE_SYSTEM: string
+ * @GST_KLV_UAS_TAG_SENSOR_LATITUDE: +/-90 degrees, int32
+ * @GST_KLV_UAS_TAG_SENSOR_LONGITUDE: +/-180 degrees, int32
+ * @GST_KLV_UAS_TAG_SENSOR_TRUE_ALTITUDE: -900..19000 meters, uint16
+ * @GST_KLV_UAS_TAG_VERSION: UAS Datalink LS version number, uint8
+ *
+ * Some of the MISB ST 0601 UAS Datalink local set tags.
+ */
+typedef enum {
+  GST_KLV_UAS_TAG_CHECKSUM = GST_KLV_TAG_CHECKSUM,
+  GST_KLV_UAS_TAG_PRECISION_TIME_STAMP = 2,
+  GST_KLV_UAS_TAG_PLATFORM_HEADING = 5,
+  GST_KLV_UAS_TAG_PLATFORM_PITCH = 6,
+  GST_KLV_UAS_TAG_PLATFORM_ROLL = 7,
+  GST_KLV_UAS_TAG_IMAGE_COORDINATE_SYSTEM = 12,
+  GST_KLV_UAS_TAG_SENSOR_LATITUDE = 13,
+  GST_KLV_UAS_TAG_SENSOR_LONGITUDE = 14,
+  GST_KLV_UAS_TAG_SENSOR_TRUE_ALTITUDE = 15,
+  GST_KLV_UAS_TAG_VERSION = 65
+} GstKLVUasTag;
+
+/**
+ * GST_KLV_UAS_LOCAL_SET_KEY:
+ *
+ * Initialiser for the 16-byte Universal Label of the MISB ST 0601 UAS
+ * Datalink local set.
+ */
+#define GST_KLV_UAS_LOCAL_SET_KEY { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x0b, 0x01, \
+    0x01, 0x0e, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00 }
+
+/**
+ * GstKLVLocalSetBuilder:
+ *
+ * Builds a local set packet in a buffer that is reused from one packet to
+ * the next. Items are added once with the put functions, which makes up a
+ * template; the values of items can then be overwritten in place with the
+ * set functions, and gst_klv_local_set_builder_finish() writes the key,
+ * length and checksum around them. Only the put functions allocate.
+ */
+typedef struct {
+  /*< private >*/
+  guint8 key[GST_KLV_KEY_SIZE];
+  guint8 *data;
+  gsize   alloc;
+  gsize   size;
+} GstKLVLocalSetBuilder;
+
+GST_TAG_API
+void            gst_klv_local_set_builder_init (GstKLVLocalSetBuilder * builder, const guint8 * key);
+
+GST_TAG_API
+void            gst_klv_local_set_builder_clear (GstKLVLocalSetBuilder * builder);
+
+GST_TAG_API
+void            gst_klv_local_set_builder_reset (GstKLVLocalSetBuilder * builder);
+
+GST_TAG_API
+void            gst_klv_local_set_builder_put_data (GstKLVLocalSetBuilder * builder, guint tag, const guint8 * data, gsize size);
+
+GST_TAG_API
+void            gst_klv_local_set_builder_put_uint (GstKLVLocalSetBuilder * builder, guint tag, guint64 value, guint n_bytes);
+
+GST_TAG_API
+void            gst_klv_local_set_builder_put_int (GstKLVLocalSetBuilder * builder, guint tag, gint64 value, guint n_bytes);
+
+GST_TAG_API
+gboolean        gst_klv_local_set_builder_set_data (GstKLVLocalSetBuilder * builder, guint tag, const guint8 * data, gsize size);
+
+GST_TAG_API
+gboolean        gst_klv_local_set_builder_set_uint (GstKLVLocalSetBuilder * builder, guint tag, guint64 value);
+
+GST_TAG_API
+gboolean        gst_klv_local_set_builder_set_int (GstKLVLocalSetBuilder * builder, guint tag, gint64 value);
+
+GST_TAG_API
+const guint8  * gst_klv_local_set_builder_finish (GstKLVLocalSetBuilder * builder, gsize * size);
+
+GST_TAG_API
+gint64          gst_klv_scale_int (gdouble value, gdouble limit, guint n_bytes);
+
+GST_TAG_API
+guint64         gst_klv_scale_uint (gdouble value, gdouble min, gdouble max, guint n_bytes);
+
+G_END_DECLS
+
+#endif /* __GST_KLV_BUILDER_H__ */
@@ -0,0 +1,392 @@
+/* GStreamer KLV Metadata Support Library
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * SECTION:gstklvparse
+ * @short_description: KLV packet and local set parsing
+ * @title: KLV parsing
+ *
+ * <refsect2>
+ * <para>
+ * Parsing of SMPTE 336M universal key packets and of the tag, length, value
+ * local sets they carry, e.g. MISB ST 0601 UAS Datalink local sets.
+ * </para>
+ * <para>
+ * The parser never allocates or copies: packets and items are returned as
+ * views into the parsed data, which must stay alive while they are used.
+ * All lengths are checked against the available data, so truncated or
+ * corrupt input makes the functions return %FALSE rather than read past
+ * the end.
+ * </para>
+ * </refsect2>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "klvparse.h"
+
+/**
+ * gst_klv_read_ber_length:
+ * @data: (array length=size): BER encoded length
+ * @size: size of @data in bytes
+ * @length: (out): the decoded length
+ * @consumed: (out): number of bytes the encoded length takes up
+ *
+ * Decodes a BER short or long form length. The indefinite form is not
+ * allowed in KLV.
+ *
+ * Returns: %TRUE if a valid length was read
+ */
+gboolean
+gst_klv_read_ber_length (const guint8 * data, gsize size, gsize * length,
+    gsize * consumed)
+{
+  gsize len;
+  guint i, n;
+
+  if (size < 1)
+    return FALSE;
+
+  if (data[0] < 0x80) {
+    *length = data[0];
+    *consumed = 1;
+    return TRUE;
+  }
+
+  n = data[0] & 0x7f;
+  if (n == 0 || n > sizeof (gsize) || n >= size)
+    return FALSE;
+
+  len = 0;
+  for (i = 1; i <= n; i++)
+    len = (len << 8) | data[i];
+
+  *length = len;
+  *consumed = n + 1;
+  return TRUE;
+}
+
+/**
+ * gst_klv_read_ber_oid:
+ * @data: (array length=size): BER-OID encoded tag
+ * @size: size of @data in bytes
+ * @tag: (out): the decoded tag
+ * @consumed: (out): number of bytes the encoded tag takes up
+ *
+ * Decodes a BER-OID tag, seven bits per byte with the top bit set on all
+ * but the last byte. Tags of more than four bytes are rejected.
+ *
+ * Returns: %TRUE if a valid tag was read
+ */
+gboolean
+gst_klv_read_ber_oid (const guint8 * data, gsize size, guint * tag,
+    gsize * consumed)
+{
+  guint val = 0;
+  gsize i;
+
+  for (i = 0; i < size && i < 4; i++) {
+    val = (val << 7) | (data[i] & 0x7f);
+    if (!(data[i] & 0x80)) {
+      *tag = val;
+      *consumed = i + 1;
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
+
+/**
+ * gst_klv_packet_parse:
+ * @data: (array length=size): data starting with a KLV packet
+ * @size: size of @data in bytes
+ * @packet: (out caller-allocates): the parsed packet
+ *
+ * Parses the KLV packet at the start of @data. @data may continue past the
+ * end of the packet, the packet size is returned in @packet.
+ *
+ * Returns: %TRUE if a complete packet with a SMPTE Universal Label was read
+ */
+gboolean
+gst_klv_packet_parse (const guint8 * data, gsize size, GstKLVPacket * packet)
+{
+  gsize len, len_size;
+
+  g_return_val_if_fail (packet != NULL, FALSE);
+
+  if (data == NULL || size <= GST_KLV_KEY_SIZE)
+    return FALSE;
+
+  if (GST_READ_UINT32_BE (data) != 0x060E2B34)
+    return FALSE;
+
+  if (!gst_klv_read_ber_length (data + GST_KLV_KEY_SIZE,
+          size - GST_KLV_KEY_SIZE, &len, &len_size))
+    return FALSE;
+
+  if (len > size - GST_KLV_KEY_SIZE - len_size)
+    return FALSE;
+
+  packet->data = data;
+  packet->size = GST_KLV_KEY_SIZE + len_size + len;
+  packet->key = data;
+  packet->value = data + GST_KLV_KEY_SIZE + len_size;
+  packet->length = len;
+  return TRUE;
+}
+
+/**
+ * gst_klv_checksum:
+ * @data: (array length=size): data to checksum
+ * @size: size of @data in bytes
+ *
+ * Computes the MISB ST 0601 checksum, the 16-bit sum of @data read as big
+ * endian 16-bit words. To checksum a local set packet, @data runs from the
+ * start of the key up to and including the checksum tag and length.
+ *
+ * Returns: the checksum
+ */
+guint16
+gst_klv_checksum (const guint8 * data, gsize size)
+{
+  guint32 sum = 0;
+  gsize i;
+
+  for (i = 0; i + 1 < size; i += 2)
+    sum += GST_READ_UINT16_BE (data + i);
+
+  if (size & 1)
+    sum += data[size - 1] << 8;
+
+  return (guint16) sum;
+}
+
+/**
+ * gst_klv_packet_verify_checksum:
+ * @packet: a parsed local set packet
+ *
+ * Checks that the local set of @packet ends with a checksum item and that
+ * it matches the packet contents.
+ *
+ * Returns: %TRUE if the checksum is present and correct
+ */
+gboolean
+gst_klv_packet_verify_checksum (const GstKLVPacket * packet)
+{
+  const guint8 *item;
+
+  g_return_val_if_fail (packet != NULL, FALSE);
+
+  if (packet->length < 4)
+    return FALSE;
+
+  item = packet->value + packet->length - 4;
+  if (item[0] != GST_KLV_TAG_CHECKSUM || item[1] != 2)
+    return FALSE;
+
+  return gst_klv_checksum (packet->data, packet->size - 2) ==
+      GST_READ_UINT16_BE (item + 2);
+}
+
+/**
+ * gst_klv_iter_init:
+ * @iter: a #GstKLVIter
+ * @data: (array length=size): a sequence of KLV packets
+ * @size: size of @data in bytes
+ *
+ * Initialises @iter to walk the packets in @data.
+ */
+void
+gst_klv_iter_init (GstKLVIter * iter, const guint8 * data, gsize size)
+{
+  g_return_if_fail (iter != NULL);
+
+  iter->data = data;
+  iter->size = data ? size : 0;
+  iter->offset = 0;
+}
+
+/**
+ * gst_klv_iter_next:
+ * @iter: a #GstKLVIter
+ * @packet: (out caller-allocates): the next packet
+ *
+ * Parses the next packet. Iteration stops at the end of the data or at
+ * the first invalid packet.
+ *
+ * Returns: %TRUE if a packet was returned in @packet
+ */
+gboolean
+gst_klv_iter_next (GstKLVIter * iter, GstKLVPacket * packet)
+{
+  g_return_val_if_fail (iter != NULL, FALSE);
+
+  if (!gst_klv_packet_parse (iter->data + iter->offset,
+          iter->size - iter->offset, packet)) {
+    iter->offset = iter->size;
+    return FALSE;
+  }
+
+  iter->offset += packet->size;
+  return TRUE;
+}
+
+/**
+ * gst_klv_local_set_iter_init:
+ * @iter: a #GstKLVLocalSetIter
+ * @data: (array length=size): a local set, e.g. the value of a packet
+ * @size: size of @data in bytes
+ *
+ * Initialises @iter to walk the items of the local set in @data.
+ */
+void
+gst_klv_local_set_iter_init (GstKLVLocalSetIter * iter, const guint8 * data,
+    gsize size)
+{
+  g_return_if_fail (iter != NULL);
+
+  iter->data = data;
+  iter->size = data ? size : 0;
+  iter->offset = 0;
+}
+
+/**
+ * gst_klv_local_set_iter_next:
+ * @iter: a #GstKLVLocalSetIter
+ * @item: (out caller-allocates): the next item
+ *
+ * Parses the next item. Iteration stops at the end of the set or at the
+ * first item that does not fit in it.
+ *
+ * Returns: %TRUE if an item was returned in @item
+ */
+gboolean
+gst_klv_local_set_iter_next (GstKLVLocalSetIter * iter,
+    GstKLVLocalSetItem * item)
+{
+  const guint8 *data;
+  gsize size, tag_size, len, len_size;
+
+  g_return_val_if_fail (iter != NULL, FALSE);
+  g_return_val_if_fail (item != NULL, FALSE);
+
+  data = iter->data + iter->offset;
+  size = iter->size - iter->offset;
+
+  if (!gst_klv_read_ber_oid (data, size, &item->tag, &tag_size))
+    goto done;
+
+  if (!gst_klv_read_ber_length (data + tag_size, size - tag_size, &len,
+          &len_size))
+    goto done;
+
+  if (len > size - tag_size - len_size)
+    goto done;
+
+  item->value = data + tag_size + len_size;
+  item->length = len;
+  iter->offset += tag_size + len_size + len;
+  return TRUE;
+
+done:
+  iter->offset = iter->size;
+  return FALSE;
+}
+
+/**
+ * gst_klv_local_set_find:
+ * @data: (array length=size): a local set
+ * @size: size of @data in bytes
+ * @tag: the tag to look for
+ * @item: (out caller-allocates): the item found
+ *
+ * Looks up the first item with @tag in the local set in @data.
+ *
+ * Returns: %TRUE if the item was found
+ */
+gboolean
+gst_klv_local_set_find (const guint8 * data, gsize size, guint tag,
+    GstKLVLocalSetItem * item)
+{
+  GstKLVLocalSetIter iter;
+
+  gst_klv_local_set_iter_init (&iter, data, size);
+  while (gst_klv_local_set_iter_next (&iter, item)) {
+    if (item->tag == tag)
+      return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+ * gst_klv_local_set_item_get_uint:
+ * @item: a local set item
+ * @value: (out): the value
+ *
+ * Reads the value of @item as a big endian unsigned integer of one to
+ * eight bytes.
+ *
+ * Returns: %TRUE if @item has a suitable length
+ */
+gboolean
+gst_klv_local_set_item_get_uint (const GstKLVLocalSetItem * item,
+    guint64 * value)
+{
+  guint64 val = 0;
+  gsize i;
+
+  g_return_val_if_fail (item != NULL, FALSE);
+
+  if (item->length < 1 || item->length > 8)
+    return FALSE;
+
+  for (i = 0; i < item->length; i++)
+    val = (val << 8) | item->value[i];
+
+  *value = val;
+  return TRUE;
+}
+
+/**
+ * gst_klv_local_set_item_get_int:
+ * @item: a local set item
+ * @value: (out): the value
+ *
+ * Reads the value of @item as a big endian two's complement integer of one
+ * to eight bytes.
+ *
+ * Returns: %TRUE if @item has a suitable length
+ */
+gboolean
+gst_klv_local_set_item_get_int (const GstKLVLocalSetItem * item,
+    gint64 * value)
+{
+  guint64 val;
+  guint shift;
+
+  if (!gst_klv_local_set_item_get_uint (item, &val))
+    return FALSE;
+
+  shift = 64 - 8 * item->length;
+  *value = ((gint64) (val << shift)) >> shift;
+  return TRUE;
+}
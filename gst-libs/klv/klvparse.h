@@ -0,0 +1,139 @@
+/* GStreamer KLV Metadata Support Library
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_KLV_PARSE_H__
+#define __GST_KLV_PARSE_H__
+
+#include "klv.h"
+
+G_BEGIN_DECLS
+
+/**
+ * GST_KLV_KEY_SIZE:
+ *
+ * Size in bytes of a SMPTE 336M Universal Label key.
+ */
+#define GST_KLV_KEY_SIZE 16
+
+/**
+ * GST_KLV_TAG_CHECKSUM:
+ *
+ * Local set tag of the MISB ST 0601 checksum item, which must be the last
+ * item of a UAS Datalink local set.
+ */
+#define GST_KLV_TAG_CHECKSUM 1
+
+/**
+ * GstKLVPacket:
+ * @data: start of the whole packet, key included
+ * @size: size of the whole packet
+ * @key: the 16-byte Universal Label key
+ * @value: the value, i.e. the local set of a local set packet
+ * @length: size of @value
+ *
+ * A view into a universal key, BER length and value triplet. All pointers
+ * point into the parsed data, nothing is copied.
+ */
+typedef struct {
+  const guint8 *data;
+  gsize         size;
+  const guint8 *key;
+  const guint8 *value;
+  gsize         length;
+} GstKLVPacket;
+
+/**
+ * GstKLVIter:
+ *
+ * Iterates over a sequence of KLV packets, e.g. the payload of a
+ * meta/x-klv buffer. Initialise with gst_klv_iter_init().
+ */
+typedef struct {
+  /*< private >*/
+  const guint8 *data;
+  gsize         size;
+  gsize         offset;
+} GstKLVIter;
+
+/**
+ * GstKLVLocalSetItem:
+ * @tag: the BER-OID decoded tag
+ * @value: the value
+ * @length: size of @value
+ *
+ * A view into a tag, BER length and value triplet of a local set.
+ */
+typedef struct {
+  guint         tag;
+  const guint8 *value;
+  gsize         length;
+} GstKLVLocalSetItem;
+
+/**
+ * GstKLVLocalSetIter:
+ *
+ * Iterates over the items of a local set. Initialise with
+ * gst_klv_local_set_iter_init(); nested sets are walked by initialising
+ * another iterator on the value of an item.
+ */
+typedef struct {
+  /*< private >*/
+  const guint8 *data;
+  gsize         size;
+  gsize         offset;
+} GstKLVLocalSetIter;
+
+GST_TAG_API
+gboolean  gst_klv_read_ber_length (const guint8 * data, gsize size, gsize * length, gsize * consumed);
+
+GST_TAG_API
+gboolean  gst_klv_read_ber_oid (const guint8 * data, gsize size, guint * tag, gsize * consumed);
+
+GST_TAG_API
+gboolean  gst_klv_packet_parse (const guint8 * data, gsize size, GstKLVPacket * packet);
+
+GST_TAG_API
+gboolean  gst_klv_packet_verify_checksum (const GstKLVPacket * packet);
+
+GST_TAG_API
+guint16   gst_klv_checksum (const guint8 * data, gsize size);
+
+GST_TAG_API
+void      gst_klv_iter_init (GstKLVIter * iter, const guint8 * data, gsize size);
+
+GST_TAG_API
+gboolean  gst_klv_iter_next (GstKLVIter * iter, GstKLVPacket * packet);
+
+GST_TAG_API
+void      gst_klv_local_set_iter_init (GstKLVLocalSetIter * iter, const guint8 * data, gsize size);
+
+GST_TAG_API
+gboolean  gst_klv_local_set_iter_next (GstKLVLocalSetIter * iter, GstKLVLocalSetItem * item);
+
+GST_TAG_API
+gboolean  gst_klv_local_set_find (const guint8 * data, gsize size, guint tag, GstKLVLocalSetItem * item);
+
+GST_TAG_API
+gboolean  gst_klv_local_set_item_get_uint (const GstKLVLocalSetItem * item, guint64 * value);
+
+GST_TAG_API
+gboolean  gst_klv_local_set_item_get_int (const GstKLVLocalSetItem * item, gint64 * value);
+
+G_END_DECLS
+
+#endif /* __GST_KLV_PARSE_H__ */
@@ -0,0 +1,123 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "videolevelsmeta.h"
+
+GType
+gst_videolevels_meta_api_get_type (void)
+{
+  static volatile GType type;
+  static const gchar *tags[] = { "video", NULL };
+
+  if (g_once_init_enter (&type)) {
+    GType _type = gst_meta_api_type_register ("GstVideoLevelsMetaAPI", tags);
+    g_once_init_leave (&type, _type);
+  }
+  return type;
+}
+
+static gboolean
+gst_videolevels_meta_init (GstMeta * meta, gpointer params, GstBuffer * buffer)
+{
+  GstVideoLevelsMeta *lmeta = (GstVideoLevelsMeta *) meta;
+
+  memset (&lmeta->stats, 0, sizeof (GstVideoLevelsStats));
+  return TRUE;
+}
+
+static void
+gst_videolevels_meta_free (GstMeta * meta, GstBuffer * buffer)
+{
+  GstVideoLevelsMeta *lmeta = (GstVideoLevelsMeta *) meta;
+
+  g_free (lmeta->stats.histogram);
+}
+
+static gboolean
+gst_videolevels_meta_transform (GstBuffer * dest, GstMeta * meta,
+    GstBuffer * buffer, GQuark type, gpointer data)
+{
+  GstVideoLevelsMeta *smeta = (GstVideoLevelsMeta *) meta;
+
+  /* the statistics only describe the complete, unmodified frame */
+  if (GST_META_TRANSFORM_IS_COPY (type)) {
+    GstMetaTransformCopy *copy = data;
+    if (copy->region)
+      return FALSE;
+    return gst_buffer_add_videolevels_meta (dest, &smeta->stats) != NULL;
+  }
+
+  return FALSE;
+}
+
+const GstMetaInfo *
+gst_videolevels_meta_get_info (void)
+{
+  static const GstMetaInfo *videolevels_meta_info = NULL;
+
+  if (g_once_init_enter ((GstMetaInfo **) & videolevels_meta_info)) {
+    const GstMetaInfo *meta =
+        gst_meta_register (GST_VIDEOLEVELS_META_API_TYPE, "GstVideoLevelsMeta",
+        sizeof (GstVideoLevelsMeta), gst_videolevels_meta_init,
+        gst_videolevels_meta_free,
+        gst_videolevels_meta_transform);
+    g_once_init_leave ((GstMetaInfo **) & videolevels_meta_info,
+        (GstMetaInfo *) meta);
+  }
+  return videolevels_meta_info;
+}
+
+/**
+ * gst_buffer_add_videolevels_meta:
+ * @buffer: a #GstBuffer
+ * @stats: (transfer none): the statistics to attach
+ *
+ * Attaches a copy of @stats, including its histogram, to @buffer.
+ *
+ * Returns: (transfer none): the #GstVideoLevelsMeta on @buffer.
+ */
+GstVideoLevelsMeta *
+gst_buffer_add_videolevels_meta (GstBuffer * buffer,
+    const GstVideoLevelsStats * stats)
+{
+  GstVideoLevelsMeta *meta;
+
+  g_return_val_if_fail (buffer != NULL, NULL);
+  g_return_val_if_fail (stats != NULL, NULL);
+
+  meta = (GstVideoLevelsMeta *) gst_buffer_add_meta (buffer,
+      GST_VIDEOLEVELS_META_INFO, NULL);
+  if (meta) {
+    meta->stats = *stats;
+    if (stats->n_bins > 0) {
+      meta->stats.histogram = g_new (guint32, stats->n_bins);
+      memcpy (meta->stats.histogram, stats->histogram,
+          stats->n_bins * sizeof (guint32));
+    } else {
+      meta->stats.histogram = NULL;
+    }
+  }
+
+  return meta;
+}
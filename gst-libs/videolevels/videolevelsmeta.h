@@ -0,0 +1,116 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __GST_VIDEO_LEVELS_META_H__
+#define __GST_VIDEO_LEVELS_META_H__
+
+#include <gst/gst.h>
+
+#if defined (_MSC_VER)
+  #define GST_VIDEOLEVELS_EXPORT __declspec(dllexport)
+  #define GST_VIDEOLEVELS_IMPORT __declspec(dllimport)
+#elif defined (__GNUC__)
+  #define GST_VIDEOLEVELS_EXPORT __attribute__((visibility("default")))
+  #define GST_VIDEOLEVELS_IMPORT
+#else
+  #define GST_VIDEOLEVELS_EXPORT
+  #define GST_VIDEOLEVELS_IMPORT
+#endif
+
+#ifdef BUILDING_GST_VIDEOLEVELS
+#define GST_VIDEOLEVELS_API GST_VIDEOLEVELS_EXPORT
+#else
+#define GST_VIDEOLEVELS_API GST_VIDEOLEVELS_IMPORT
+#endif
+
+G_BEGIN_DECLS
+
+#define GST_VIDEOLEVELS_META_MAX_BINS 256
+
+/**
+ * GstVideoLevelsStats:
+ * @lower_input: lower input level applied to the frame
+ * @upper_input: upper input level applied to the frame
+ * @n_samples: number of samples in the histogram (three per pixel for RGB)
+ * @min: smallest sampled value
+ * @max: largest sampled value
+ * @mean: mean sampled value
+ * @percentile_1: value below which 1% of the samples fall
+ * @median: value below which 50% of the samples fall
+ * @percentile_99: value below which 99% of the samples fall
+ * @saturated_low: samples at or below @lower_input
+ * @saturated_high: samples at or above @upper_input
+ * @n_bins: number of entries in @histogram, 0 if not requested
+ * @histogram: (array length=n_bins) (nullable): histogram downsampled to
+ *   @n_bins bins over the input range, %NULL if @n_bins is 0
+ *
+ * Statistics of the sampled region (see the agc-roi-* and histogram-stride-*
+ * properties) of one input frame. Values are in input units, at the
+ * resolution of the internal histogram (4096 bins for >8-bit input).
+ */
+typedef struct {
+  gint lower_input;
+  gint upper_input;
+  guint n_samples;
+  gint min;
+  gint max;
+  gdouble mean;
+  gint percentile_1;
+  gint median;
+  gint percentile_99;
+  guint saturated_low;
+  guint saturated_high;
+  guint n_bins;
+  guint32 *histogram;
+} GstVideoLevelsStats;
+
+/**
+ * GstVideoLevelsMeta:
+ * @meta: parent #GstMeta
+ * @stats: the statistics of the frame
+ *
+ * Levels statistics attached to output buffers by videolevels when the
+ * stats-meta property is set. The histogram, if any, is owned by the meta.
+ * Applications and other plugins link to the gstvideolevels-1.0 library to
+ * read it.
+ */
+typedef struct {
+  GstMeta meta;
+
+  GstVideoLevelsStats stats;
+} GstVideoLevelsMeta;
+
+#define GST_VIDEOLEVELS_META_API_TYPE (gst_videolevels_meta_api_get_type())
+#define GST_VIDEOLEVELS_META_INFO (gst_videolevels_meta_get_info())
+
+#define gst_buffer_get_videolevels_meta(b) \
+  ((GstVideoLevelsMeta*)gst_buffer_get_meta((b),GST_VIDEOLEVELS_META_API_TYPE))
+
+GST_VIDEOLEVELS_API
+GType gst_videolevels_meta_api_get_type (void);
+
+GST_VIDEOLEVELS_API
+const GstMetaInfo * gst_videolevels_meta_get_info (void);
+
+GST_VIDEOLEVELS_API
+GstVideoLevelsMeta * gst_buffer_add_videolevels_meta (GstBuffer * buffer,
+    const GstVideoLevelsStats * stats);
+
+G_END_DECLS
+
+#endif /* __GST_VIDEO_LEVELS_META_H__ */
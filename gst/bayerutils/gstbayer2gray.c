@@ -24,7 +24,8 @@
 /**
 * SECTION:element-bayer2gray
 *
-* Convert grayscale video from one bpp/depth combination to another.
+* Relabel Bayer video as grayscale without touching the pixels. Buffers
+* are passed through in place with a video meta describing the gray frame.
 *
 * <refsect2>
 * <title>Example launch line</title>
@@ -39,6 +40,8 @@
 #endif
 
 #include "gstbayer2gray.h"
+#include "gstbayerdecimate.h"
+#include "gstbayerdemosaic.h"
 
 #include <gst/video/video.h>
 
@@ -102,8 +105,8 @@ static GstCaps *gst_bayer2gray_transform_caps (GstBaseTransform * trans,
     GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps);
 static gboolean gst_bayer2gray_set_caps (GstBaseTransform * btrans,
     GstCaps * incaps, GstCaps * outcaps);
-static GstFlowReturn gst_bayer2gray_transform (GstBaseTransform * btrans,
-    GstBuffer * inbuf, GstBuffer * outbuf);
+static gboolean gst_bayer2gray_decide_allocation (GstBaseTransform * btrans,
+    GstQuery * query);
 static GstFlowReturn gst_bayer2gray_transform_ip (GstBaseTransform * btrans,
     GstBuffer * buf);
 
@@ -175,8 +178,8 @@ gst_bayer2gray_class_init (GstBayer2GrayClass * klass)
       GST_DEBUG_FUNCPTR (gst_bayer2gray_transform_caps);
   gstbasetransform_class->set_caps =
       GST_DEBUG_FUNCPTR (gst_bayer2gray_set_caps);
-  gstbasetransform_class->transform =
-      GST_DEBUG_FUNCPTR (gst_bayer2gray_transform);
+  gstbasetransform_class->decide_allocation =
+      GST_DEBUG_FUNCPTR (gst_bayer2gray_decide_allocation);
   gstbasetransform_class->transform_ip =
       GST_DEBUG_FUNCPTR (gst_bayer2gray_transform_ip);
 }
@@ -186,8 +189,8 @@ gst_bayer2gray_init (GstBayer2Gray * filt)
 {
   GST_DEBUG_OBJECT (filt, "init class instance");
 
-  /* FIXME: fix in-place transform */
-  gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filt), FALSE);
+  /* only the metadata changes, the pixels are never copied */
+  gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filt), TRUE);
 
   gst_bayer2gray_reset (filt);
 }
@@ -270,7 +273,7 @@ gst_bayer2gray_transform_caps (GstBaseTransform * trans,
     gst_structure_set_value (s, "format", gst_structure_get_value (s_other,
             "format"));
 
-    gst_caps_merge (other_caps, c);
+    other_caps = gst_caps_merge (other_caps, c);
   }
 
   gst_caps_unref (gray8_caps);
@@ -296,56 +299,90 @@ gst_bayer2gray_set_caps (GstBaseTransform * btrans, GstCaps * incaps,
     GstCaps * outcaps)
 {
   GstBayer2Gray *filt = GST_BAYER2GRAY (btrans);
-  gboolean res = TRUE;
-  GstVideoInfo vinfo;
+  GstStructure *st;
+  const gchar *format;
 
   GST_DEBUG_OBJECT (filt,
       "set_caps: in '%" GST_PTR_FORMAT "' out '%" GST_PTR_FORMAT "'", incaps,
       outcaps);
 
-  gst_video_info_from_caps (&filt->vinfo, outcaps);
+  if (!gst_video_info_from_caps (&filt->vinfo, outcaps)) {
+    GST_ERROR_OBJECT (filt, "Failed to parse output caps");
+    return FALSE;
+  }
+
+  st = gst_caps_get_structure (incaps, 0);
+  format = gst_structure_get_string (st, "format");
+  if (format != NULL && g_str_has_suffix (format, "16"))
+    filt->stride_in = GST_ROUND_UP_4 (GST_VIDEO_INFO_WIDTH (&filt->vinfo) * 2);
+  else
+    filt->stride_in = GST_ROUND_UP_4 (GST_VIDEO_INFO_WIDTH (&filt->vinfo));
 
-  return res;
+  return TRUE;
 }
 
-static GstFlowReturn
-gst_bayer2gray_transform (GstBaseTransform * btrans,
-    GstBuffer * inbuf, GstBuffer * outbuf)
+static gboolean
+gst_bayer2gray_decide_allocation (GstBaseTransform * btrans, GstQuery * query)
 {
   GstBayer2Gray *filt = GST_BAYER2GRAY (btrans);
-  GstMapInfo minfo_in, minfo_out;
 
-  GST_LOG_OBJECT (filt, "Doing non-inplace transform, copying data (FIX THIS)");
+  filt->use_video_meta = gst_query_find_allocation_meta (query,
+      GST_VIDEO_META_API_TYPE, NULL);
 
-  gst_buffer_map (inbuf, &minfo_in, GST_MAP_READ);
-  gst_buffer_map (outbuf, &minfo_out, GST_MAP_WRITE);
-  memcpy (minfo_out.data, minfo_in.data, minfo_in.size);
-  gst_buffer_unmap (inbuf, &minfo_in);
-  gst_buffer_unmap (outbuf, &minfo_out);
-
-  return GST_FLOW_OK;
+  return
+      GST_BASE_TRANSFORM_CLASS (gst_bayer2gray_parent_class)->decide_allocation
+      (btrans, query);
 }
 
-/* FIXME: inplace transform doesn't work now due to buffer meta issue with
-   videoconvert, or really at least all elements using videofilter base
-   class */
+/**
+ * gst_bayer2gray_transform_ip:
+ * @btrans: #GstBaseTransform
+ * @buf: Bayer buffer, relabeled as gray
+ *
+ * Replaces any video meta on @buf by one describing the gray frame. The
+ * old meta describes the Bayer layout, and video filters downstream map
+ * the buffer with the first video meta they find, so it can't be kept
+ * next to the new one.
+ */
 static GstFlowReturn
 gst_bayer2gray_transform_ip (GstBaseTransform * btrans, GstBuffer * buf)
 {
   GstBayer2Gray *filt = GST_BAYER2GRAY (btrans);
+  GstVideoMeta *meta;
+  gsize offset[GST_VIDEO_MAX_PLANES] = { 0, };
+  gint stride[GST_VIDEO_MAX_PLANES] = { 0, };
 
-  GST_LOG_OBJECT (filt, "in-place transform, doing nothing");
+  GST_LOG_OBJECT (filt, "in-place transform, replacing video meta");
+
+  stride[0] = filt->stride_in;
+  meta = gst_buffer_get_video_meta (buf);
+  if (meta) {
+    offset[0] = meta->offset[0];
+    stride[0] = meta->stride[0];
+  }
+  while ((meta = gst_buffer_get_video_meta (buf)))
+    gst_buffer_remove_meta (buf, GST_META_CAST (meta));
+
+  if (!filt->use_video_meta && (offset[0] != 0 ||
+          stride[0] != GST_VIDEO_INFO_PLANE_STRIDE (&filt->vinfo, 0))) {
+    GST_WARNING_OBJECT (filt, "Downstream doesn't support video meta, frame "
+        "with offset %" G_GSIZE_FORMAT " and stride %d will be misread",
+        offset[0], stride[0]);
+  }
+
+  gst_buffer_add_video_meta_full (buf, GST_VIDEO_FRAME_FLAG_NONE,
+      GST_VIDEO_INFO_FORMAT (&filt->vinfo), GST_VIDEO_INFO_WIDTH (&filt->vinfo),
+      GST_VIDEO_INFO_HEIGHT (&filt->vinfo), 1, offset, stride);
 
-  gst_buffer_add_video_meta (buf, GST_VIDEO_FRAME_FLAG_NONE,
-      filt->vinfo.finfo->format, filt->vinfo.width, filt->vinfo.height);
-  GST_ERROR ("%d,%d,%d", filt->vinfo.finfo->format, filt->vinfo.width,
-      filt->vinfo.height);
   return GST_FLOW_OK;
 }
 
 static void
 gst_bayer2gray_reset (GstBayer2Gray * bayer2gray)
 {
+  gst_video_info_init (&bayer2gray->vinfo);
+  bayer2gray->stride_in = 0;
+  bayer2gray->use_video_meta = FALSE;
 }
 
 /* Register filters that make up the gstgl plugin */
@@ -363,6 +400,20 @@ plugin_init (GstPlugin * plugin)
     return FALSE;
   }
 
+  GST_CAT_INFO (GST_CAT_DEFAULT, "registering bayerdecimate element");
+
+  if (!gst_element_register (plugin, "bayerdecimate", GST_RANK_NONE,
+          GST_TYPE_BAYER_DECIMATE)) {
+    return FALSE;
+  }
+
+  GST_CAT_INFO (GST_CAT_DEFAULT, "registering bayerdemosaic element");
+
+  if (!gst_element_register (plugin, "bayerdemosaic", GST_RANK_NONE,
+          GST_TYPE_BAYER_DEMOSAIC)) {
+    return FALSE;
+  }
+
   return TRUE;
 }
 
@@ -64,6 +64,10 @@ struct _GstBayer2Gray
   gint bpp;
   gint fps_n;
   gint fps_d;
+
+  /* Bayer rows are 4 byte aligned unless upstream sends a video meta */
+  gint stride_in;
+  gboolean use_video_meta;
 };
 
 struct _GstBayer2GrayClass
@@ -0,0 +1,685 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+* SECTION:element-bayerdecimate
+*
+* Reduces the width and height of Bayer or monochrome video by 2 or 4,
+* typically for a preview branch next to a full resolution recording.
+* Blocks of samples are either averaged (binning) or reduced to their first
+* sample. Bayer video is binned per color, so the output is Bayer video
+* with the same CFA pattern, which is far cheaper than demosaicing then
+* scaling the full frame.
+*
+* <refsect2>
+* <title>Example launch line</title>
+* |[
+* gst-launch-1.0 pylonsrc ! bayerdecimate factor=4x4 ! bayer2rgb ! autovideosink
+* ]|
+* </refsect2>
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "gstbayerdecimate.h"
+#include "gstbayerutilsorc.h"
+
+#include <gst/video/video.h>
+
+/* GstBayerDecimate signals and args */
+enum
+{
+  /* FILL ME */
+  LAST_SIGNAL
+};
+
+enum
+{
+  PROP_0,
+  PROP_FACTOR,
+  PROP_METHOD,
+  PROP_LAST
+};
+
+#define DEFAULT_PROP_FACTOR GST_BAYER_DECIMATE_FACTOR_2
+#define DEFAULT_PROP_METHOD GST_BAYER_DECIMATE_METHOD_AVERAGE
+
+#define VIDEO_CAPS_MAKE_BAYER8(format)                       \
+    "video/x-bayer, "                                        \
+    "format = (string) " format ", "                         \
+    "width = " GST_VIDEO_SIZE_RANGE ", "                     \
+    "height = " GST_VIDEO_SIZE_RANGE ", "                    \
+    "framerate = " GST_VIDEO_FPS_RANGE
+
+#define VIDEO_CAPS_MAKE_BAYER16(format)                      \
+    "video/x-bayer, "                                        \
+    "format = (string) " format ", "                         \
+    "endianness = (int) {1234, 4321}, "                      \
+    "bpp = (int) {16, 14, 12, 10}, "                         \
+    "width = " GST_VIDEO_SIZE_RANGE ", "                     \
+    "height = " GST_VIDEO_SIZE_RANGE ", "                    \
+    "framerate = " GST_VIDEO_FPS_RANGE
+
+#define VIDEO_CAPS_BAYER8 VIDEO_CAPS_MAKE_BAYER8("{bggr,grbg,gbrg,rggb}")
+#define VIDEO_CAPS_BAYER16 VIDEO_CAPS_MAKE_BAYER16("{bggr16,grbg16,gbrg16,rggb16}")
+#define VIDEO_CAPS_GRAY GST_VIDEO_CAPS_MAKE ("{ GRAY8, GRAY16_LE, GRAY16_BE }")
+
+/* the capabilities of the inputs and outputs */
+static GstStaticPadTemplate gst_bayer_decimate_sink_template =
+GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (VIDEO_CAPS_BAYER8 ";" VIDEO_CAPS_BAYER16 ";"
+        VIDEO_CAPS_GRAY)
+    );
+
+static GstStaticPadTemplate gst_bayer_decimate_src_template =
+GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (VIDEO_CAPS_BAYER8 ";" VIDEO_CAPS_BAYER16 ";"
+        VIDEO_CAPS_GRAY)
+    );
+
+#define GST_TYPE_BAYER_DECIMATE_FACTOR (gst_bayer_decimate_factor_get_type())
+static GType
+gst_bayer_decimate_factor_get_type (void)
+{
+  static GType bayer_decimate_factor_type = 0;
+  static const GEnumValue bayer_decimate_factor[] = {
+    {GST_BAYER_DECIMATE_FACTOR_2, "Half width and height", "2x2"},
+    {GST_BAYER_DECIMATE_FACTOR_4, "Quarter width and height", "4x4"},
+    {0, NULL, NULL},
+  };
+
+  if (!bayer_decimate_factor_type) {
+    bayer_decimate_factor_type =
+        g_enum_register_static ("GstBayerDecimateFactor",
+        bayer_decimate_factor);
+  }
+  return bayer_decimate_factor_type;
+}
+
+#define GST_TYPE_BAYER_DECIMATE_METHOD (gst_bayer_decimate_method_get_type())
+static GType
+gst_bayer_decimate_method_get_type (void)
+{
+  static GType bayer_decimate_method_type = 0;
+  static const GEnumValue bayer_decimate_method[] = {
+    {GST_BAYER_DECIMATE_METHOD_AVERAGE, "Average the samples of each block",
+        "average"},
+    {GST_BAYER_DECIMATE_METHOD_SKIP, "Keep the first sample of each block",
+        "skip"},
+    {0, NULL, NULL},
+  };
+
+  if (!bayer_decimate_method_type) {
+    bayer_decimate_method_type =
+        g_enum_register_static ("GstBayerDecimateMethod",
+        bayer_decimate_method);
+  }
+  return bayer_decimate_method_type;
+}
+
+/* GObject vmethod declarations */
+static void gst_bayer_decimate_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_bayer_decimate_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+static void gst_bayer_decimate_dispose (GObject * object);
+
+/* GstBaseTransform vmethod declarations */
+static GstCaps *gst_bayer_decimate_transform_caps (GstBaseTransform * trans,
+    GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps);
+static gboolean gst_bayer_decimate_get_unit_size (GstBaseTransform * trans,
+    GstCaps * caps, gsize * size);
+static gboolean gst_bayer_decimate_set_caps (GstBaseTransform * trans,
+    GstCaps * incaps, GstCaps * outcaps);
+static GstFlowReturn gst_bayer_decimate_transform (GstBaseTransform * trans,
+    GstBuffer * inbuf, GstBuffer * outbuf);
+static gboolean gst_bayer_decimate_stop (GstBaseTransform * trans);
+
+/* setup debug */
+GST_DEBUG_CATEGORY_STATIC (bayer_decimate_debug);
+#define GST_CAT_DEFAULT bayer_decimate_debug
+
+G_DEFINE_TYPE (GstBayerDecimate, gst_bayer_decimate, GST_TYPE_BASE_TRANSFORM);
+
+/************************************************************************/
+/* GObject vmethod implementations                                      */
+/************************************************************************/
+
+/**
+ * gst_bayer_decimate_dispose:
+ * @object: #GObject.
+ *
+ */
+static void
+gst_bayer_decimate_dispose (GObject * object)
+{
+  GstBayerDecimate *filt = GST_BAYER_DECIMATE (object);
+
+  GST_DEBUG ("dispose");
+
+  g_free (filt->scratch);
+  filt->scratch = NULL;
+
+  /* chain up to the parent class */
+  G_OBJECT_CLASS (gst_bayer_decimate_parent_class)->dispose (object);
+}
+
+/**
+ * gst_bayer_decimate_class_init:
+ * @object: #GstBayerDecimateClass.
+ *
+ */
+static void
+gst_bayer_decimate_class_init (GstBayerDecimateClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *gstelement_class = GST_ELEMENT_CLASS (klass);
+  GstBaseTransformClass *gstbasetransform_class =
+      GST_BASE_TRANSFORM_CLASS (klass);
+
+  GST_DEBUG_CATEGORY_INIT (bayer_decimate_debug, "bayerdecimate", 0,
+      "Bayer decimate filter");
+
+  GST_DEBUG ("class init");
+
+  /* Register GObject vmethods */
+  gobject_class->dispose = GST_DEBUG_FUNCPTR (gst_bayer_decimate_dispose);
+  gobject_class->set_property =
+      GST_DEBUG_FUNCPTR (gst_bayer_decimate_set_property);
+  gobject_class->get_property =
+      GST_DEBUG_FUNCPTR (gst_bayer_decimate_get_property);
+
+  /* Install GObject properties */
+  g_object_class_install_property (gobject_class, PROP_FACTOR,
+      g_param_spec_enum ("factor", "Factor",
+          "Reduction of the width and height",
+          GST_TYPE_BAYER_DECIMATE_FACTOR, DEFAULT_PROP_FACTOR,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_METHOD,
+      g_param_spec_enum ("method", "Method",
+          "How the samples of each block are combined",
+          GST_TYPE_BAYER_DECIMATE_METHOD, DEFAULT_PROP_METHOD,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_PLAYING));
+
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&gst_bayer_decimate_sink_template));
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&gst_bayer_decimate_src_template));
+
+  gst_element_class_set_static_metadata (gstelement_class,
+      "Bayer decimate", "Filter/Converter/Video/Scaler",
+      "Bins or decimates Bayer or monochrome video by 2 or 4",
+      "Joshua M. Doe <oss@nvl.army.mil>");
+
+  /* Register GstBaseTransform vmethods */
+  gstbasetransform_class->transform_caps =
+      GST_DEBUG_FUNCPTR (gst_bayer_decimate_transform_caps);
+  gstbasetransform_class->get_unit_size =
+      GST_DEBUG_FUNCPTR (gst_bayer_decimate_get_unit_size);
+  gstbasetransform_class->set_caps =
+      GST_DEBUG_FUNCPTR (gst_bayer_decimate_set_caps);
+  gstbasetransform_class->transform =
+      GST_DEBUG_FUNCPTR (gst_bayer_decimate_transform);
+  gstbasetransform_class->stop = GST_DEBUG_FUNCPTR (gst_bayer_decimate_stop);
+}
+
+static void
+gst_bayer_decimate_init (GstBayerDecimate * filt)
+{
+  GST_DEBUG_OBJECT (filt, "init class instance");
+
+  filt->prop_factor = DEFAULT_PROP_FACTOR;
+  filt->method = DEFAULT_PROP_METHOD;
+
+  gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filt), FALSE);
+}
+
+static void
+gst_bayer_decimate_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstBayerDecimate *filt = GST_BAYER_DECIMATE (object);
+
+  GST_DEBUG_OBJECT (filt, "setting property %s", pspec->name);
+
+  switch (prop_id) {
+    case PROP_FACTOR:
+      GST_OBJECT_LOCK (filt);
+      filt->prop_factor = g_value_get_enum (value);
+      GST_OBJECT_UNLOCK (filt);
+      gst_base_transform_reconfigure_src (GST_BASE_TRANSFORM (filt));
+      break;
+    case PROP_METHOD:
+      GST_OBJECT_LOCK (filt);
+      filt->method = g_value_get_enum (value);
+      GST_OBJECT_UNLOCK (filt);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_bayer_decimate_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstBayerDecimate *filt = GST_BAYER_DECIMATE (object);
+
+  GST_DEBUG_OBJECT (filt, "getting property %s", pspec->name);
+
+  switch (prop_id) {
+    case PROP_FACTOR:
+      GST_OBJECT_LOCK (filt);
+      g_value_set_enum (value, filt->prop_factor);
+      GST_OBJECT_UNLOCK (filt);
+      break;
+    case PROP_METHOD:
+      GST_OBJECT_LOCK (filt);
+      g_value_set_enum (value, filt->method);
+      GST_OBJECT_UNLOCK (filt);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+/* output size for an input size, Bayer output keeps whole 2x2 quads */
+static gint
+gst_bayer_decimate_size_out (gint size, gint factor, gboolean is_bayer)
+{
+  if (is_bayer)
+    return MAX (size / (2 * factor) * 2, 2);
+  else
+    return MAX (size / factor, 1);
+}
+
+/* scale width and height of @st, which may be fixed or ranges. Going to
+ * the sink, each output size maps to the range of input sizes producing
+ * it. */
+static void
+gst_bayer_decimate_scale_size (GstStructure * st, gint factor,
+    gboolean to_sink)
+{
+  const gchar *fields[2] = { "width", "height" };
+  gboolean is_bayer = gst_structure_has_name (st, "video/x-bayer");
+  gint block = is_bayer ? 2 * factor : factor;
+  gint i;
+
+  for (i = 0; i < 2; i++) {
+    const GValue *value = gst_structure_get_value (st, fields[i]);
+    gint64 min, max;
+
+    if (value == NULL)
+      continue;
+
+    if (G_VALUE_HOLDS_INT (value)) {
+      min = max = g_value_get_int (value);
+    } else if (GST_VALUE_HOLDS_INT_RANGE (value)) {
+      min = gst_value_get_int_range_min (value);
+      max = gst_value_get_int_range_max (value);
+    } else {
+      continue;
+    }
+
+    if (to_sink) {
+      min = MIN (min * factor, G_MAXINT);
+      max = MIN (max * factor + block - 1, G_MAXINT);
+    } else {
+      min = gst_bayer_decimate_size_out (min, factor, is_bayer);
+      max = gst_bayer_decimate_size_out (max, factor, is_bayer);
+    }
+
+    if (min == max)
+      gst_structure_set (st, fields[i], G_TYPE_INT, (gint) min, NULL);
+    else
+      gst_structure_set (st, fields[i], GST_TYPE_INT_RANGE, (gint) min,
+          (gint) max, NULL);
+  }
+}
+
+static GstCaps *
+gst_bayer_decimate_transform_caps (GstBaseTransform * trans,
+    GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps)
+{
+  GstBayerDecimate *filt = GST_BAYER_DECIMATE (trans);
+  GstCaps *other_caps;
+  gint factor;
+  guint i, n;
+
+  GST_LOG_OBJECT (filt, "transforming caps from %" GST_PTR_FORMAT, caps);
+
+  GST_OBJECT_LOCK (filt);
+  factor = filt->prop_factor;
+  GST_OBJECT_UNLOCK (filt);
+
+  /* only the size changes */
+  other_caps = gst_caps_copy (caps);
+  n = gst_caps_get_size (other_caps);
+  for (i = 0; i < n; ++i) {
+    gst_bayer_decimate_scale_size (gst_caps_get_structure (other_caps, i),
+        factor, direction == GST_PAD_SRC);
+  }
+
+  if (!gst_caps_is_empty (other_caps) && filter_caps) {
+    GstCaps *tmp = gst_caps_intersect_full (filter_caps, other_caps,
+        GST_CAPS_INTERSECT_FIRST);
+    gst_caps_replace (&other_caps, tmp);
+    gst_caps_unref (tmp);
+  }
+
+  GST_LOG_OBJECT (filt, "transformed caps to %" GST_PTR_FORMAT, other_caps);
+
+  return other_caps;
+}
+
+/**
+ * gst_bayer_decimate_get_unit_size:
+ * @trans: #GstBaseTransform
+ * @caps: #GstCaps
+ * @size: frame size in bytes
+ *
+ * Bayer frames use 4 byte aligned rows, like the other Bayer elements.
+ *
+ * Returns: TRUE on success
+ */
+static gboolean
+gst_bayer_decimate_get_unit_size (GstBaseTransform * trans, GstCaps * caps,
+    gsize * size)
+{
+  GstStructure *st = gst_caps_get_structure (caps, 0);
+  GstVideoInfo info;
+
+  if (gst_structure_has_name (st, "video/x-bayer")) {
+    const gchar *format = gst_structure_get_string (st, "format");
+    gint width, height;
+
+    if (format == NULL || !gst_structure_get_int (st, "width", &width) ||
+        !gst_structure_get_int (st, "height", &height))
+      return FALSE;
+
+    if (g_str_has_suffix (format, "16"))
+      *size = GST_ROUND_UP_4 (width * 2) * height;
+    else
+      *size = GST_ROUND_UP_4 (width) * height;
+    return TRUE;
+  }
+
+  if (!gst_video_info_from_caps (&info, caps))
+    return FALSE;
+
+  *size = GST_VIDEO_INFO_SIZE (&info);
+  return TRUE;
+}
+
+static gboolean
+gst_bayer_decimate_set_caps (GstBaseTransform * trans, GstCaps * incaps,
+    GstCaps * outcaps)
+{
+  GstBayerDecimate *filt = GST_BAYER_DECIMATE (trans);
+  GstStructure *st;
+  gint endianness = G_BYTE_ORDER;
+  gint bytes, width_out, height_out, row_size, i;
+
+  GST_DEBUG_OBJECT (filt,
+      "set_caps: in %" GST_PTR_FORMAT " out %" GST_PTR_FORMAT, incaps, outcaps);
+
+  st = gst_caps_get_structure (incaps, 0);
+  filt->is_bayer = gst_structure_has_name (st, "video/x-bayer");
+  if (filt->is_bayer) {
+    const gchar *format = gst_structure_get_string (st, "format");
+
+    if (format == NULL ||
+        !gst_structure_get_int (st, "width", &filt->width_in) ||
+        !gst_structure_get_int (st, "height", &filt->height_in)) {
+      GST_ERROR_OBJECT (filt, "Incomplete Bayer caps");
+      return FALSE;
+    }
+    filt->is_16bit = g_str_has_suffix (format, "16");
+    if (filt->is_16bit) {
+      endianness = G_LITTLE_ENDIAN;
+      gst_structure_get_int (st, "endianness", &endianness);
+    }
+  } else {
+    GstVideoInfo info;
+
+    if (!gst_video_info_from_caps (&info, incaps)) {
+      GST_ERROR_OBJECT (filt, "Failed to parse input caps");
+      return FALSE;
+    }
+    filt->width_in = GST_VIDEO_INFO_WIDTH (&info);
+    filt->height_in = GST_VIDEO_INFO_HEIGHT (&info);
+    filt->is_16bit = GST_VIDEO_INFO_FORMAT (&info) != GST_VIDEO_FORMAT_GRAY8;
+    if (GST_VIDEO_INFO_FORMAT (&info) == GST_VIDEO_FORMAT_GRAY16_LE)
+      endianness = G_LITTLE_ENDIAN;
+    else if (GST_VIDEO_INFO_FORMAT (&info) == GST_VIDEO_FORMAT_GRAY16_BE)
+      endianness = G_BIG_ENDIAN;
+  }
+  filt->swap = filt->is_16bit && endianness != G_BYTE_ORDER;
+
+  st = gst_caps_get_structure (outcaps, 0);
+  if (!gst_structure_get_int (st, "width", &filt->width_out) ||
+      !gst_structure_get_int (st, "height", &filt->height_out)) {
+    GST_ERROR_OBJECT (filt, "Incomplete output caps");
+    return FALSE;
+  }
+
+  /* the factor the caps were negotiated with */
+  for (filt->factor = 2; filt->factor <= 4; filt->factor *= 2) {
+    width_out = gst_bayer_decimate_size_out (filt->width_in, filt->factor,
+        filt->is_bayer);
+    height_out = gst_bayer_decimate_size_out (filt->height_in, filt->factor,
+        filt->is_bayer);
+    if (width_out == filt->width_out && height_out == filt->height_out &&
+        filt->width_in >= filt->width_out * filt->factor &&
+        filt->height_in >= filt->height_out * filt->factor)
+      break;
+  }
+  if (filt->factor > 4) {
+    GST_ERROR_OBJECT (filt, "Can't decimate %dx%d to %dx%d", filt->width_in,
+        filt->height_in, filt->width_out, filt->height_out);
+    return FALSE;
+  }
+
+  bytes = filt->is_16bit ? 2 : 1;
+  filt->stride_in = GST_ROUND_UP_4 (filt->width_in * bytes);
+  filt->stride_out = GST_ROUND_UP_4 (filt->width_out * bytes);
+
+  row_size = GST_ROUND_UP_8 (filt->width_in * bytes);
+  g_free (filt->scratch);
+  filt->scratch = g_malloc (G_N_ELEMENTS (filt->rows) * row_size);
+  for (i = 0; i < G_N_ELEMENTS (filt->rows); i++)
+    filt->rows[i] = filt->scratch + i * row_size;
+
+  return TRUE;
+}
+
+/* halves a row of @n_out units, a unit being a sample, or a pair of
+ * samples for Bayer video so only samples of the same color are combined */
+static void
+gst_bayer_decimate_hbin (GstBayerDecimate * filt,
+    GstBayerDecimateMethod method, guint8 * dst, const guint8 * src,
+    gint n_out)
+{
+  if (method == GST_BAYER_DECIMATE_METHOD_SKIP) {
+    if (filt->is_bayer && filt->is_16bit)
+      bayerutils_orc_hbin_skip_u32 ((guint32 *) dst, (const guint32 *) src,
+          n_out);
+    else if (filt->is_bayer || filt->is_16bit)
+      bayerutils_orc_hbin_skip_u16 ((guint16 *) dst, (const guint16 *) src,
+          n_out);
+    else
+      bayerutils_orc_hbin_skip_u8 (dst, src, n_out);
+  } else {
+    if (filt->is_bayer && filt->is_16bit)
+      bayerutils_orc_hbin_avg_pair_u16 ((guint16 *) dst,
+          (const guint16 *) src, n_out);
+    else if (filt->is_bayer)
+      bayerutils_orc_hbin_avg_pair_u8 (dst, src, n_out);
+    else if (filt->is_16bit)
+      bayerutils_orc_hbin_avg_u16 ((guint16 *) dst, (const guint16 *) src,
+          n_out);
+    else
+      bayerutils_orc_hbin_avg_u8 (dst, src, n_out);
+  }
+}
+
+/* averages @n samples of two rows */
+static void
+gst_bayer_decimate_vbin (GstBayerDecimate * filt, guint8 * dst,
+    const guint8 * src1, const guint8 * src2, gint n)
+{
+  if (filt->is_16bit)
+    bayerutils_orc_avg_u16 ((guint16 *) dst, (const guint16 *) src1,
+        (const guint16 *) src2, n);
+  else
+    bayerutils_orc_avg_u8 (dst, src1, src2, n);
+}
+
+static GstFlowReturn
+gst_bayer_decimate_transform (GstBaseTransform * trans, GstBuffer * inbuf,
+    GstBuffer * outbuf)
+{
+  GstBayerDecimate *filt = GST_BAYER_DECIMATE (trans);
+  GstBayerDecimateMethod method;
+  GstMapInfo minfo_in, minfo_out;
+  GstVideoMeta *meta;
+  const guint8 *in_data;
+  const gint f = filt->factor;
+  const gint bytes = filt->is_16bit ? 2 : 1;
+  const gint unit = filt->is_bayer ? 2 : 1;
+  const gint n_out = filt->width_out / unit;
+  const gint n_in = n_out * f;
+  gint in_stride, y, k;
+  gsize offset = 0;
+
+  GST_LOG_OBJECT (filt, "Performing non-inplace transform");
+
+  if (!gst_buffer_map (inbuf, &minfo_in, GST_MAP_READ)) {
+    GST_ELEMENT_ERROR (filt, STREAM, FAILED, ("Failed to map buffer"),
+        (NULL));
+    return GST_FLOW_ERROR;
+  }
+
+  in_stride = filt->stride_in;
+  meta = gst_buffer_get_video_meta (inbuf);
+  if (meta) {
+    offset = meta->offset[0];
+    in_stride = meta->stride[0];
+  }
+  if (offset + (gsize) in_stride * (filt->height_in - 1) +
+      filt->width_in * bytes > minfo_in.size) {
+    gst_buffer_unmap (inbuf, &minfo_in);
+    GST_ELEMENT_ERROR (filt, STREAM, FAILED, (NULL),
+        ("Buffer of %" G_GSIZE_FORMAT " bytes is too small for the frame",
+            minfo_in.size));
+    return GST_FLOW_ERROR;
+  }
+  in_data = minfo_in.data + offset;
+
+  if (!gst_buffer_map (outbuf, &minfo_out, GST_MAP_WRITE)) {
+    gst_buffer_unmap (inbuf, &minfo_in);
+    GST_ELEMENT_ERROR (filt, STREAM, FAILED, ("Failed to map buffer"),
+        (NULL));
+    return GST_FLOW_ERROR;
+  }
+
+  GST_OBJECT_LOCK (filt);
+  method = filt->method;
+  GST_OBJECT_UNLOCK (filt);
+
+  for (y = 0; y < filt->height_out; y++) {
+    guint8 *out_row = minfo_out.data + y * filt->stride_out;
+    guint8 *dst = out_row;
+    const guint8 *src;
+    gint y_in;
+
+    /* first input row of the block, Bayer blocks interleave two rows of
+     * each color phase */
+    if (filt->is_bayer)
+      y_in = (y / 2) * 2 * f + (y & 1);
+    else
+      y_in = y * f;
+
+    if (method == GST_BAYER_DECIMATE_METHOD_SKIP) {
+      src = in_data + y_in * in_stride;
+    } else {
+      const guint8 *rows[4];
+      const gint row_step = filt->is_bayer ? 2 : 1;
+      const gint n_samples = n_in * unit;
+
+      for (k = 0; k < f; k++) {
+        rows[k] = in_data + (y_in + k * row_step) * in_stride;
+        if (filt->swap) {
+          bayerutils_orc_unpack_u16_swap ((guint16 *) filt->rows[k],
+              (const guint16 *) rows[k], n_samples);
+          rows[k] = filt->rows[k];
+        }
+      }
+
+      gst_bayer_decimate_vbin (filt, filt->rows[4], rows[0], rows[1],
+          n_samples);
+      if (f == 4) {
+        gst_bayer_decimate_vbin (filt, filt->rows[5], rows[2], rows[3],
+            n_samples);
+        gst_bayer_decimate_vbin (filt, filt->rows[4], filt->rows[4],
+            filt->rows[5], n_samples);
+      }
+      src = filt->rows[4];
+
+      if (filt->swap)
+        dst = filt->rows[6];
+    }
+
+    if (f == 4) {
+      gst_bayer_decimate_hbin (filt, method, filt->rows[5], src, n_out * 2);
+      src = filt->rows[5];
+    }
+    gst_bayer_decimate_hbin (filt, method, dst, src, n_out);
+
+    if (dst != out_row)
+      bayerutils_orc_unpack_u16_swap ((guint16 *) out_row,
+          (const guint16 *) dst, filt->width_out);
+  }
+
+  gst_buffer_unmap (outbuf, &minfo_out);
+  gst_buffer_unmap (inbuf, &minfo_in);
+
+  return GST_FLOW_OK;
+}
+
+static gboolean
+gst_bayer_decimate_stop (GstBaseTransform * trans)
+{
+  GstBayerDecimate *filt = GST_BAYER_DECIMATE (trans);
+
+  g_free (filt->scratch);
+  filt->scratch = NULL;
+
+  return TRUE;
+}
@@ -0,0 +1,107 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __GST_BAYER_DECIMATE_H__
+#define __GST_BAYER_DECIMATE_H__
+
+#include <gst/base/gstbasetransform.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_BAYER_DECIMATE \
+  (gst_bayer_decimate_get_type())
+#define GST_BAYER_DECIMATE(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_BAYER_DECIMATE,GstBayerDecimate))
+#define GST_BAYER_DECIMATE_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_BAYER_DECIMATE,GstBayerDecimateClass))
+#define GST_IS_BAYER_DECIMATE(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_BAYER_DECIMATE))
+#define GST_IS_BAYER_DECIMATE_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_BAYER_DECIMATE))
+
+typedef struct _GstBayerDecimate GstBayerDecimate;
+typedef struct _GstBayerDecimateClass GstBayerDecimateClass;
+
+/**
+* GstBayerDecimateFactor:
+* @GST_BAYER_DECIMATE_FACTOR_2: keep one pixel per 2x2 block
+* @GST_BAYER_DECIMATE_FACTOR_4: keep one pixel per 4x4 block
+*
+* Reduction of the width and height.
+*/
+typedef enum {
+  GST_BAYER_DECIMATE_FACTOR_2 = 2,
+  GST_BAYER_DECIMATE_FACTOR_4 = 4
+} GstBayerDecimateFactor;
+
+/**
+* GstBayerDecimateMethod:
+* @GST_BAYER_DECIMATE_METHOD_AVERAGE: average the samples of each block
+* @GST_BAYER_DECIMATE_METHOD_SKIP: keep the first sample of each block
+*
+* How the samples of a block are combined. For Bayer video only samples of
+* the same color are combined, so the output keeps the input CFA pattern.
+*/
+typedef enum {
+  GST_BAYER_DECIMATE_METHOD_AVERAGE,
+  GST_BAYER_DECIMATE_METHOD_SKIP
+} GstBayerDecimateMethod;
+
+/**
+* GstBayerDecimate:
+* @element: the parent element.
+*
+*
+* The opaque GstBayerDecimate data structure.
+*/
+struct _GstBayerDecimate
+{
+  GstBaseTransform element;
+
+  /* negotiated format */
+  gboolean is_bayer;
+  gboolean is_16bit;
+  /* 16-bit samples are not in host order */
+  gboolean swap;
+  gint width_in;
+  gint height_in;
+  gint stride_in;
+  gint width_out;
+  gint height_out;
+  gint stride_out;
+  gint factor;
+
+  /* properties */
+  GstBayerDecimateFactor prop_factor;
+  GstBayerDecimateMethod method;
+
+  /* byteswapped input rows, then three work rows */
+  guint8 *scratch;
+  guint8 *rows[7];
+};
+
+struct _GstBayerDecimateClass
+{
+  GstBaseTransformClass parent_class;
+};
+
+GType gst_bayer_decimate_get_type(void);
+
+G_END_DECLS
+
+#endif /* __GST_BAYER_DECIMATE_H__ */
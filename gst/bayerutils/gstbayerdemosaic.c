@@ -0,0 +1,924 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+* SECTION:element-bayerdemosaic
+*
+* Interpolates 8 or 16-bit Bayer video into RGB. The missing color samples
+* are reconstructed either bilinearly, or with the gradient-corrected
+* filters of Malvar, He and Cutler which keep edges sharper for little
+* extra cost. The half method outputs one pixel per 2x2 quad instead, at
+* half the width and height, which is well suited to preview branches.
+*
+* 16-bit Bayer uses the bpp and endianness fields of the caps, and is
+* output as ARGB64 scaled to the full 16-bit range, or shifted down to 8
+* bits. Frames can be split into stripes of rows processed in parallel.
+*
+* <refsect2>
+* <title>Example launch line</title>
+* |[
+* gst-launch-1.0 pylonsrc ! bayerdemosaic method=malvar n-threads=0 ! videoconvert ! autovideosink
+* ]|
+* </refsect2>
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "gstbayerdemosaic.h"
+#include "gstbayerutilsorc.h"
+#include "genicampixelformat.h"
+
+#include <gst/video/video.h>
+
+/* GstBayerDemosaic signals and args */
+enum
+{
+  /* FILL ME */
+  LAST_SIGNAL
+};
+
+enum
+{
+  PROP_0,
+  PROP_METHOD,
+  PROP_N_THREADS,
+  PROP_LAST
+};
+
+#define DEFAULT_PROP_METHOD GST_BAYER_DEMOSAIC_METHOD_BILINEAR
+#define DEFAULT_PROP_N_THREADS 1
+
+#define BAYER8_FORMATS "{ bggr, grbg, gbrg, rggb }"
+#define BAYER16_FORMATS "{ bggr16, grbg16, gbrg16, rggb16 }"
+#define RGB8_FORMATS \
+    "{ BGRx, RGBx, xRGB, xBGR, BGRA, RGBA, ARGB, ABGR, RGB, BGR }"
+#define RGB16_FORMATS "ARGB64"
+
+/* the capabilities of the inputs and outputs */
+static GstStaticPadTemplate gst_bayer_demosaic_sink_template =
+    GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER8 (BAYER8_FORMATS) ";"
+        GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER16 (BAYER16_FORMATS,
+            "{ 1234, 4321 }"))
+    );
+
+static GstStaticPadTemplate gst_bayer_demosaic_src_template =
+    GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (RGB8_FORMATS) ";"
+        GST_VIDEO_CAPS_MAKE (RGB16_FORMATS))
+    );
+
+#define GST_TYPE_BAYER_DEMOSAIC_METHOD (gst_bayer_demosaic_method_get_type())
+static GType
+gst_bayer_demosaic_method_get_type (void)
+{
+  static GType bayer_demosaic_method_type = 0;
+  static const GEnumValue bayer_demosaic_method[] = {
+    {GST_BAYER_DEMOSAIC_METHOD_BILINEAR, "Bilinear interpolation",
+        "bilinear"},
+    {GST_BAYER_DEMOSAIC_METHOD_MALVAR,
+        "Gradient-corrected interpolation (Malvar-He-Cutler)", "malvar"},
+    {GST_BAYER_DEMOSAIC_METHOD_HALF,
+        "Half resolution, one pixel per 2x2 quad", "half"},
+    {0, NULL, NULL},
+  };
+
+  if (!bayer_demosaic_method_type) {
+    bayer_demosaic_method_type =
+        g_enum_register_static ("GstBayerDemosaicMethod",
+        bayer_demosaic_method);
+  }
+  return bayer_demosaic_method_type;
+}
+
+/* GObject vmethod declarations */
+static void gst_bayer_demosaic_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_bayer_demosaic_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+static void gst_bayer_demosaic_dispose (GObject * object);
+
+/* GstBaseTransform vmethod declarations */
+static GstCaps *gst_bayer_demosaic_transform_caps (GstBaseTransform * trans,
+    GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps);
+static gboolean gst_bayer_demosaic_get_unit_size (GstBaseTransform * trans,
+    GstCaps * caps, gsize * size);
+static gboolean gst_bayer_demosaic_set_caps (GstBaseTransform * trans,
+    GstCaps * incaps, GstCaps * outcaps);
+static GstFlowReturn gst_bayer_demosaic_transform (GstBaseTransform * trans,
+    GstBuffer * inbuf, GstBuffer * outbuf);
+static gboolean gst_bayer_demosaic_stop (GstBaseTransform * trans);
+
+/* GstBayerDemosaic method declarations */
+static void gst_bayer_demosaic_free_stripes (GstBayerDemosaic * filt);
+
+/* setup debug */
+GST_DEBUG_CATEGORY_STATIC (bayer_demosaic_debug);
+#define GST_CAT_DEFAULT bayer_demosaic_debug
+
+G_DEFINE_TYPE (GstBayerDemosaic, gst_bayer_demosaic, GST_TYPE_BASE_TRANSFORM);
+
+/************************************************************************/
+/* GObject vmethod implementations                                      */
+/************************************************************************/
+
+/**
+ * gst_bayer_demosaic_dispose:
+ * @object: #GObject.
+ *
+ */
+static void
+gst_bayer_demosaic_dispose (GObject * object)
+{
+  GstBayerDemosaic *filt = GST_BAYER_DEMOSAIC (object);
+
+  GST_DEBUG ("dispose");
+
+  gst_bayer_demosaic_free_stripes (filt);
+
+  /* chain up to the parent class */
+  G_OBJECT_CLASS (gst_bayer_demosaic_parent_class)->dispose (object);
+}
+
+/**
+ * gst_bayer_demosaic_class_init:
+ * @object: #GstBayerDemosaicClass.
+ *
+ */
+static void
+gst_bayer_demosaic_class_init (GstBayerDemosaicClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *gstelement_class = GST_ELEMENT_CLASS (klass);
+  GstBaseTransformClass *gstbasetransform_class =
+      GST_BASE_TRANSFORM_CLASS (klass);
+
+  GST_DEBUG_CATEGORY_INIT (bayer_demosaic_debug, "bayerdemosaic", 0,
+      "Bayer demosaic filter");
+
+  GST_DEBUG ("class init");
+
+  /* Register GObject vmethods */
+  gobject_class->dispose = GST_DEBUG_FUNCPTR (gst_bayer_demosaic_dispose);
+  gobject_class->set_property =
+      GST_DEBUG_FUNCPTR (gst_bayer_demosaic_set_property);
+  gobject_class->get_property =
+      GST_DEBUG_FUNCPTR (gst_bayer_demosaic_get_property);
+
+  /* Install GObject properties */
+  g_object_class_install_property (gobject_class, PROP_METHOD,
+      g_param_spec_enum ("method", "Method",
+          "Interpolation of the missing color samples",
+          GST_TYPE_BAYER_DEMOSAIC_METHOD, DEFAULT_PROP_METHOD,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS |
+          GST_PARAM_MUTABLE_PLAYING));
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Number of threads to split each frame across (0 = number of "
+          "processors)", 0, G_MAXINT, DEFAULT_PROP_N_THREADS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&gst_bayer_demosaic_sink_template));
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&gst_bayer_demosaic_src_template));
+
+  gst_element_class_set_static_metadata (gstelement_class,
+      "Bayer demosaic", "Filter/Converter/Video",
+      "Interpolates 8 or 16-bit Bayer video into RGB",
+      "Joshua M. Doe <oss@nvl.army.mil>");
+
+  /* Register GstBaseTransform vmethods */
+  gstbasetransform_class->transform_caps =
+      GST_DEBUG_FUNCPTR (gst_bayer_demosaic_transform_caps);
+  gstbasetransform_class->get_unit_size =
+      GST_DEBUG_FUNCPTR (gst_bayer_demosaic_get_unit_size);
+  gstbasetransform_class->set_caps =
+      GST_DEBUG_FUNCPTR (gst_bayer_demosaic_set_caps);
+  gstbasetransform_class->transform =
+      GST_DEBUG_FUNCPTR (gst_bayer_demosaic_transform);
+  gstbasetransform_class->stop = GST_DEBUG_FUNCPTR (gst_bayer_demosaic_stop);
+}
+
+static void
+gst_bayer_demosaic_init (GstBayerDemosaic * filt)
+{
+  GST_DEBUG_OBJECT (filt, "init class instance");
+
+  filt->method = DEFAULT_PROP_METHOD;
+  filt->n_threads = DEFAULT_PROP_N_THREADS;
+
+  gst_video_info_init (&filt->info_out);
+  gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filt), FALSE);
+}
+
+static void
+gst_bayer_demosaic_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstBayerDemosaic *filt = GST_BAYER_DEMOSAIC (object);
+
+  GST_DEBUG_OBJECT (filt, "setting property %s", pspec->name);
+
+  switch (prop_id) {
+    case PROP_METHOD:
+    {
+      GstBayerDemosaicMethod method = g_value_get_enum (value);
+      gboolean resize;
+
+      GST_OBJECT_LOCK (filt);
+      resize = (method == GST_BAYER_DEMOSAIC_METHOD_HALF) !=
+          (filt->method == GST_BAYER_DEMOSAIC_METHOD_HALF);
+      filt->method = method;
+      GST_OBJECT_UNLOCK (filt);
+
+      /* the output size depends on the method */
+      if (resize)
+        gst_base_transform_reconfigure_src (GST_BASE_TRANSFORM (filt));
+      break;
+    }
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (filt);
+      filt->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (filt);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_bayer_demosaic_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec)
+{
+  GstBayerDemosaic *filt = GST_BAYER_DEMOSAIC (object);
+
+  GST_DEBUG_OBJECT (filt, "getting property %s", pspec->name);
+
+  switch (prop_id) {
+    case PROP_METHOD:
+      GST_OBJECT_LOCK (filt);
+      g_value_set_enum (value, filt->method);
+      GST_OBJECT_UNLOCK (filt);
+      break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (filt);
+      g_value_set_uint (value, filt->n_threads);
+      GST_OBJECT_UNLOCK (filt);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+/* halve (or double when @to_bayer) width and height of @st, which may be
+ * fixed or ranges */
+static void
+gst_bayer_demosaic_scale_size (GstStructure * st, gboolean to_bayer)
+{
+  const gchar *fields[2] = { "width", "height" };
+  gint i;
+
+  for (i = 0; i < 2; i++) {
+    const GValue *value = gst_structure_get_value (st, fields[i]);
+    gint64 min, max;
+
+    if (value == NULL)
+      continue;
+
+    if (G_VALUE_HOLDS_INT (value)) {
+      min = max = g_value_get_int (value);
+    } else if (GST_VALUE_HOLDS_INT_RANGE (value)) {
+      min = gst_value_get_int_range_min (value);
+      max = gst_value_get_int_range_max (value);
+    } else {
+      continue;
+    }
+
+    if (to_bayer) {
+      min = MIN (min * 2, G_MAXINT);
+      max = MIN (max * 2, G_MAXINT);
+    } else {
+      min = MAX (min / 2, 1);
+      max = MAX (max / 2, 1);
+    }
+
+    if (min == max)
+      gst_structure_set (st, fields[i], G_TYPE_INT, (gint) min, NULL);
+    else
+      gst_structure_set (st, fields[i], GST_TYPE_INT_RANGE, (gint) min,
+          (gint) max, NULL);
+  }
+}
+
+/* copy of @c named @name, with the format fields of @fmt_caps and without
+ * the format fields of the other side */
+static GstCaps *
+gst_bayer_demosaic_convert_structure (GstCaps * c, const gchar * name,
+    GstCaps * fmt_caps, gboolean scale, gboolean to_bayer)
+{
+  GstCaps *res = gst_caps_copy (c);
+  GstStructure *st = gst_caps_get_structure (res, 0);
+  GstStructure *fmt_st = gst_caps_get_structure (fmt_caps, 0);
+  const gchar *fields[3] = { "format", "bpp", "endianness" };
+  gint i;
+
+  gst_structure_set_name (st, name);
+  gst_structure_remove_fields (st, "format", "bpp", "endianness", NULL);
+  for (i = 0; i < 3; i++) {
+    if (gst_structure_has_field (fmt_st, fields[i]))
+      gst_structure_set_value (st, fields[i],
+          gst_structure_get_value (fmt_st, fields[i]));
+  }
+
+  if (scale)
+    gst_bayer_demosaic_scale_size (st, to_bayer);
+
+  return res;
+}
+
+static GstCaps *
+gst_bayer_demosaic_transform_caps (GstBaseTransform * trans,
+    GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps)
+{
+  GstBayerDemosaic *filt = GST_BAYER_DEMOSAIC (trans);
+  GstCaps *normalized_caps, *other_caps;
+  GstCaps *bayer8_caps, *bayer16_caps, *rgb8_caps, *rgb16_caps;
+  gboolean half;
+  guint i, n;
+
+  GST_LOG_OBJECT (filt, "transforming caps from %" GST_PTR_FORMAT, caps);
+
+  GST_OBJECT_LOCK (filt);
+  half = filt->method == GST_BAYER_DEMOSAIC_METHOD_HALF;
+  GST_OBJECT_UNLOCK (filt);
+
+  other_caps = gst_caps_new_empty ();
+  normalized_caps = gst_caps_normalize (gst_caps_ref (caps));
+  bayer8_caps =
+      gst_caps_from_string (GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER8
+      (BAYER8_FORMATS));
+  bayer16_caps =
+      gst_caps_from_string (GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER16
+      (BAYER16_FORMATS, "{ 1234, 4321 }"));
+  rgb8_caps = gst_caps_from_string (GST_VIDEO_CAPS_MAKE (RGB8_FORMATS));
+  rgb16_caps = gst_caps_from_string (GST_VIDEO_CAPS_MAKE (RGB16_FORMATS));
+
+  n = gst_caps_get_size (normalized_caps);
+  for (i = 0; i < n; ++i) {
+    GstCaps *c = gst_caps_copy_nth (normalized_caps, i);
+    const gchar *format =
+        gst_structure_get_string (gst_caps_get_structure (c, 0), "format");
+    GstCaps *same_depth, *other_depth;
+
+    if (direction == GST_PAD_SINK) {
+      /* we're on Bayer side, return RGB caps, same depth first */
+      gboolean deep = format != NULL && g_str_has_suffix (format, "16");
+      same_depth = gst_bayer_demosaic_convert_structure (c, "video/x-raw",
+          deep ? rgb16_caps : rgb8_caps, half, FALSE);
+      other_depth = gst_bayer_demosaic_convert_structure (c, "video/x-raw",
+          deep ? rgb8_caps : rgb16_caps, half, FALSE);
+    } else {
+      /* we're on RGB side, return Bayer caps, same depth first */
+      gboolean deep = g_strcmp0 (format, RGB16_FORMATS) == 0;
+      same_depth = gst_bayer_demosaic_convert_structure (c, "video/x-bayer",
+          deep ? bayer16_caps : bayer8_caps, half, TRUE);
+      other_depth = gst_bayer_demosaic_convert_structure (c, "video/x-bayer",
+          deep ? bayer8_caps : bayer16_caps, half, TRUE);
+    }
+
+    other_caps = gst_caps_merge (other_caps, same_depth);
+    other_caps = gst_caps_merge (other_caps, other_depth);
+    gst_caps_unref (c);
+  }
+
+  gst_caps_unref (bayer8_caps);
+  gst_caps_unref (bayer16_caps);
+  gst_caps_unref (rgb8_caps);
+  gst_caps_unref (rgb16_caps);
+  gst_caps_unref (normalized_caps);
+
+  if (!gst_caps_is_empty (other_caps) && filter_caps) {
+    GstCaps *tmp = gst_caps_intersect_full (filter_caps, other_caps,
+        GST_CAPS_INTERSECT_FIRST);
+    gst_caps_replace (&other_caps, tmp);
+    gst_caps_unref (tmp);
+  }
+
+  GST_LOG_OBJECT (filt, "transformed caps to %" GST_PTR_FORMAT, other_caps);
+
+  return other_caps;
+}
+
+/**
+ * gst_bayer_demosaic_get_unit_size:
+ * @trans: #GstBaseTransform
+ * @caps: #GstCaps
+ * @size: frame size in bytes
+ *
+ * Bayer frames use 4 byte aligned rows, like the other Bayer elements.
+ *
+ * Returns: TRUE on success
+ */
+static gboolean
+gst_bayer_demosaic_get_unit_size (GstBaseTransform * trans, GstCaps * caps,
+    gsize * size)
+{
+  GstStructure *st = gst_caps_get_structure (caps, 0);
+  GstVideoInfo info;
+
+  if (gst_structure_has_name (st, "video/x-bayer")) {
+    const gchar *format = gst_structure_get_string (st, "format");
+    gint width, height;
+
+    if (format == NULL || !gst_structure_get_int (st, "width", &width) ||
+        !gst_structure_get_int (st, "height", &height))
+      return FALSE;
+
+    if (g_str_has_suffix (format, "16"))
+      *size = GST_ROUND_UP_4 (width * 2) * height;
+    else
+      *size = GST_ROUND_UP_4 (width) * height;
+    return TRUE;
+  }
+
+  if (!gst_video_info_from_caps (&info, caps))
+    return FALSE;
+
+  *size = GST_VIDEO_INFO_SIZE (&info);
+  return TRUE;
+}
+
+static gboolean
+gst_bayer_demosaic_set_caps (GstBaseTransform * trans, GstCaps * incaps,
+    GstCaps * outcaps)
+{
+  GstBayerDemosaic *filt = GST_BAYER_DEMOSAIC (trans);
+  GstStructure *st;
+  const gchar *format;
+
+  GST_DEBUG_OBJECT (filt,
+      "set_caps: in %" GST_PTR_FORMAT " out %" GST_PTR_FORMAT, incaps, outcaps);
+
+  st = gst_caps_get_structure (incaps, 0);
+  format = gst_structure_get_string (st, "format");
+  if (format == NULL || !gst_structure_get_int (st, "width", &filt->width) ||
+      !gst_structure_get_int (st, "height", &filt->height)) {
+    GST_ERROR_OBJECT (filt, "Incomplete Bayer caps");
+    return FALSE;
+  }
+
+  if (!gst_video_info_from_caps (&filt->info_out, outcaps)) {
+    GST_ERROR_OBJECT (filt, "Failed to parse output caps");
+    return FALSE;
+  }
+
+  /* the CFA phase must be the same on every row pair, and the borders are
+   * mirrored two samples deep */
+  if (filt->width % 2 || filt->height % 2 || filt->width < 4 ||
+      filt->height < 4) {
+    GST_ERROR_OBJECT (filt, "Bayer frame must have an even size of at "
+        "least 4x4, not %dx%d", filt->width, filt->height);
+    return FALSE;
+  }
+
+  if (g_str_has_prefix (format, "rggb")) {
+    filt->row0_green_first = FALSE;
+    filt->row0_red = TRUE;
+  } else if (g_str_has_prefix (format, "bggr")) {
+    filt->row0_green_first = FALSE;
+    filt->row0_red = FALSE;
+  } else if (g_str_has_prefix (format, "grbg")) {
+    filt->row0_green_first = TRUE;
+    filt->row0_red = TRUE;
+  } else if (g_str_has_prefix (format, "gbrg")) {
+    filt->row0_green_first = TRUE;
+    filt->row0_red = FALSE;
+  } else {
+    GST_ERROR_OBJECT (filt, "Unknown Bayer format %s", format);
+    return FALSE;
+  }
+
+  filt->is_16bit = g_str_has_suffix (format, "16");
+  filt->bpp = filt->is_16bit ? 16 : 8;
+  filt->endianness = G_LITTLE_ENDIAN;
+  if (filt->is_16bit) {
+    gst_structure_get_int (st, "bpp", &filt->bpp);
+    gst_structure_get_int (st, "endianness", &filt->endianness);
+  }
+  filt->stride_in =
+      GST_ROUND_UP_4 (filt->width * (filt->is_16bit ? 2 : 1));
+
+  filt->half = GST_VIDEO_INFO_WIDTH (&filt->info_out) * 2 == filt->width;
+
+  filt->swap_rb = FALSE;
+  switch (GST_VIDEO_INFO_FORMAT (&filt->info_out)) {
+    case GST_VIDEO_FORMAT_BGRx:
+    case GST_VIDEO_FORMAT_BGRA:
+      filt->swap_rb = TRUE;
+    case GST_VIDEO_FORMAT_RGBx:
+    case GST_VIDEO_FORMAT_RGBA:
+      filt->pack = GST_BAYER_DEMOSAIC_PACK_RGBX;
+      break;
+    case GST_VIDEO_FORMAT_xBGR:
+    case GST_VIDEO_FORMAT_ABGR:
+      filt->swap_rb = TRUE;
+    case GST_VIDEO_FORMAT_xRGB:
+    case GST_VIDEO_FORMAT_ARGB:
+      filt->pack = GST_BAYER_DEMOSAIC_PACK_XRGB;
+      break;
+    case GST_VIDEO_FORMAT_BGR:
+      filt->swap_rb = TRUE;
+    case GST_VIDEO_FORMAT_RGB:
+      filt->pack = GST_BAYER_DEMOSAIC_PACK_RGB;
+      break;
+    case GST_VIDEO_FORMAT_ARGB64:
+      filt->pack = GST_BAYER_DEMOSAIC_PACK_ARGB64;
+      break;
+    default:
+      GST_ERROR_OBJECT (filt, "Unsupported output format %s",
+          GST_VIDEO_INFO_NAME (&filt->info_out));
+      return FALSE;
+  }
+
+  /* ARGB64 is scaled to the full range, 8-bit output keeps the top bits */
+  if (filt->pack == GST_BAYER_DEMOSAIC_PACK_ARGB64)
+    filt->pack_shift = 16 - filt->bpp;
+  else
+    filt->pack_shift = filt->bpp - 8;
+
+  return TRUE;
+}
+
+/**
+ * gst_bayer_demosaic_unpack_row:
+ * @stripe: #GstBayerDemosaicStripe
+ * @y: input row, may be up to two rows outside of the frame
+ * @dst: padded destination row
+ *
+ * Converts an input row to native 16-bit samples, starting two samples into
+ * @dst. Rows and columns outside of the frame are mirrored around the
+ * first and last ones, which keeps the CFA phase.
+ */
+static void
+gst_bayer_demosaic_unpack_row (GstBayerDemosaicStripe * stripe, gint y,
+    guint16 * dst)
+{
+  GstBayerDemosaic *filt = stripe->filt;
+  const gint w = filt->width;
+  const guint8 *src;
+
+  if (y < 0)
+    y = -y;
+  else if (y >= filt->height)
+    y = 2 * filt->height - 2 - y;
+  src = stripe->in_data + y * stripe->in_stride;
+
+  if (!filt->is_16bit)
+    bayerutils_orc_unpack_u8 (dst + 2, src, w);
+  else if (filt->endianness == G_BYTE_ORDER)
+    memcpy (dst + 2, src, w * 2);
+  else
+    bayerutils_orc_unpack_u16_swap (dst + 2, (const guint16 *) src, w);
+
+  dst[0] = dst[4];
+  dst[1] = dst[3];
+  dst[w + 2] = dst[w];
+  dst[w + 3] = dst[w + 1];
+}
+
+static void
+gst_bayer_demosaic_pack_row (GstBayerDemosaic * filt, guint8 * dst,
+    const guint16 * r, const guint16 * g, const guint16 * b, gint width)
+{
+  const guint16 *c1 = filt->swap_rb ? b : r;
+  const guint16 *c3 = filt->swap_rb ? r : b;
+  const gint shift = filt->pack_shift;
+  gint x;
+
+  switch (filt->pack) {
+    case GST_BAYER_DEMOSAIC_PACK_RGBX:
+      bayerutils_orc_pack_rgbx (dst, c1, g, c3, shift, width);
+      break;
+    case GST_BAYER_DEMOSAIC_PACK_XRGB:
+      bayerutils_orc_pack_xrgb (dst, c1, g, c3, shift, width);
+      break;
+    case GST_BAYER_DEMOSAIC_PACK_RGB:
+      /* ORC has no 24-bit stores */
+      for (x = 0; x < width; x++) {
+        dst[3 * x + 0] = MIN (c1[x] >> shift, 255);
+        dst[3 * x + 1] = MIN (g[x] >> shift, 255);
+        dst[3 * x + 2] = MIN (c3[x] >> shift, 255);
+      }
+      break;
+    case GST_BAYER_DEMOSAIC_PACK_ARGB64:
+      bayerutils_orc_pack_argb64 ((guint16 *) dst, r, g, b, shift, width);
+      break;
+    default:
+      g_assert_not_reached ();
+  }
+}
+
+/**
+ * gst_bayer_demosaic_interpolate_stripe:
+ * @data: #GstBayerDemosaicStripe
+ *
+ * Interpolates the output rows of one stripe. For each row the input rows
+ * around it are averaged vertically, then horizontally, and a pair kernel
+ * picks or combines these averages for the two pixels of each CFA pair.
+ */
+static void
+gst_bayer_demosaic_interpolate_stripe (gpointer data)
+{
+  GstBayerDemosaicStripe *stripe = data;
+  GstBayerDemosaic *filt = stripe->filt;
+  const gint w = filt->width;
+  const gint max = (1 << filt->bpp) - 1;
+  gint y;
+
+  /* fill the ring with the rows above and including the first one */
+  for (y = stripe->y_start - 2; y < stripe->y_start + 2; y++)
+    gst_bayer_demosaic_unpack_row (stripe, y, stripe->rows[(y + 5) % 5]);
+
+  for (y = stripe->y_start; y < stripe->y_end; y++) {
+    const guint16 *m, *up1, *down1;
+    const gboolean odd = y & 1;
+    const gboolean green_first = filt->row0_green_first != odd;
+    const gboolean red = filt->row0_red != odd;
+    guint16 *own = red ? stripe->r : stripe->b;
+    guint16 *other = red ? stripe->b : stripe->r;
+
+    gst_bayer_demosaic_unpack_row (stripe, y + 2, stripe->rows[(y + 7) % 5]);
+    m = stripe->rows[(y + 5) % 5];
+    up1 = stripe->rows[(y + 4) % 5];
+    down1 = stripe->rows[(y + 6) % 5];
+
+    bayerutils_orc_avg_u16 (stripe->a1, up1, down1, w + 4);
+    bayerutils_orc_avg_u16 (stripe->h1, m + 1, m + 3, w);
+    bayerutils_orc_avg_u16 (stripe->d, stripe->a1 + 1, stripe->a1 + 3, w);
+
+    if (stripe->method == GST_BAYER_DEMOSAIC_METHOD_MALVAR) {
+      const guint16 *up2 = stripe->rows[(y + 3) % 5];
+      const guint16 *down2 = stripe->rows[(y + 7) % 5];
+
+      bayerutils_orc_avg_u16 (stripe->a2, up2 + 2, down2 + 2, w);
+      bayerutils_orc_avg_u16 (stripe->h2, m, m + 4, w);
+      (green_first ? bayerutils_orc_malvar_gfirst :
+          bayerutils_orc_malvar_cfirst) ((guint32 *) own,
+          (guint32 *) stripe->g, (guint32 *) other,
+          (const guint32 *) (m + 2), (const guint32 *) stripe->h1,
+          (const guint32 *) stripe->h2, (const guint32 *) (stripe->a1 + 2),
+          (const guint32 *) stripe->a2, (const guint32 *) stripe->d, max,
+          w / 2);
+    } else {
+      (green_first ? bayerutils_orc_bilinear_gfirst :
+          bayerutils_orc_bilinear_cfirst) ((guint32 *) own,
+          (guint32 *) stripe->g, (guint32 *) other,
+          (const guint32 *) (m + 2), (const guint32 *) stripe->h1,
+          (const guint32 *) (stripe->a1 + 2), (const guint32 *) stripe->d,
+          w / 2);
+    }
+
+    gst_bayer_demosaic_pack_row (filt,
+        stripe->out_data + y * stripe->out_stride, stripe->r, stripe->g,
+        stripe->b, w);
+  }
+}
+
+/**
+ * gst_bayer_demosaic_half_stripe:
+ * @data: #GstBayerDemosaicStripe
+ *
+ * Outputs one pixel per 2x2 quad, averaging its two green samples.
+ */
+static void
+gst_bayer_demosaic_half_stripe (gpointer data)
+{
+  GstBayerDemosaicStripe *stripe = data;
+  GstBayerDemosaic *filt = stripe->filt;
+  const gint w = filt->width;
+  guint16 *own = filt->row0_red ? stripe->r : stripe->b;
+  guint16 *other = filt->row0_red ? stripe->b : stripe->r;
+  gint y;
+
+  for (y = stripe->y_start; y < stripe->y_end; y++) {
+    gst_bayer_demosaic_unpack_row (stripe, 2 * y, stripe->rows[0]);
+    gst_bayer_demosaic_unpack_row (stripe, 2 * y + 1, stripe->rows[1]);
+
+    (filt->row0_green_first ? bayerutils_orc_bin_gfirst :
+        bayerutils_orc_bin_cfirst) (own, stripe->g, other,
+        (const guint32 *) (stripe->rows[0] + 2),
+        (const guint32 *) (stripe->rows[1] + 2), w / 2);
+
+    gst_bayer_demosaic_pack_row (filt,
+        stripe->out_data + y * stripe->out_stride, stripe->r, stripe->g,
+        stripe->b, w / 2);
+  }
+}
+
+static void
+gst_bayer_demosaic_free_stripes (GstBayerDemosaic * filt)
+{
+  gint i, n;
+
+  if (filt->runner == NULL)
+    return;
+
+  n = gst_vision_task_runner_get_n_threads (filt->runner);
+  for (i = 0; i < n; i++)
+    g_free (filt->stripes[i].scratch);
+  g_free (filt->stripes);
+  g_free (filt->stripe_data);
+  gst_vision_task_runner_free (filt->runner);
+
+  filt->stripes = NULL;
+  filt->stripe_data = NULL;
+  filt->runner = NULL;
+  filt->stripes_width = 0;
+}
+
+/**
+ * gst_bayer_demosaic_setup_stripes:
+ * @filt: #GstBayerDemosaic
+ *
+ * (Re)create the worker threads and scratch rows if the number of threads
+ * or the width changed
+ */
+static void
+gst_bayer_demosaic_setup_stripes (GstBayerDemosaic * filt)
+{
+  const gint w = filt->width;
+  const gint pw = w + 4;
+  guint n_threads;
+  gint i, j;
+
+  GST_OBJECT_LOCK (filt);
+  n_threads = filt->n_threads;
+  GST_OBJECT_UNLOCK (filt);
+
+  if (n_threads == 0)
+    n_threads = g_get_num_processors ();
+
+  if (filt->runner != NULL &&
+      gst_vision_task_runner_get_n_threads (filt->runner) == n_threads &&
+      filt->stripes_width == w)
+    return;
+
+  gst_bayer_demosaic_free_stripes (filt);
+
+  GST_DEBUG_OBJECT (filt, "Using %u threads", n_threads);
+
+  filt->runner = gst_vision_task_runner_new (n_threads);
+  filt->stripes = g_new0 (GstBayerDemosaicStripe, n_threads);
+  filt->stripe_data = g_new (gpointer, n_threads);
+  for (i = 0; i < n_threads; i++) {
+    GstBayerDemosaicStripe *stripe = &filt->stripes[i];
+    guint16 *p;
+
+    /* six padded rows, then seven unpadded ones */
+    stripe->scratch = g_new (guint16, 6 * pw + 7 * w);
+    p = stripe->scratch;
+    for (j = 0; j < 5; j++, p += pw)
+      stripe->rows[j] = p;
+    stripe->a1 = p;
+    p += pw;
+    stripe->a2 = p;
+    p += w;
+    stripe->h1 = p;
+    p += w;
+    stripe->h2 = p;
+    p += w;
+    stripe->d = p;
+    p += w;
+    stripe->r = p;
+    p += w;
+    stripe->g = p;
+    p += w;
+    stripe->b = p;
+
+    stripe->filt = filt;
+    filt->stripe_data[i] = stripe;
+  }
+  filt->stripes_width = w;
+}
+
+static GstFlowReturn
+gst_bayer_demosaic_transform (GstBaseTransform * trans, GstBuffer * inbuf,
+    GstBuffer * outbuf)
+{
+  GstBayerDemosaic *filt = GST_BAYER_DEMOSAIC (trans);
+  GstBayerDemosaicMethod method;
+  GstVideoFrame out_frame;
+  GstVideoMeta *meta;
+  GstMapInfo minfo;
+  const guint8 *in_data;
+  gint in_stride, out_height, i, n;
+  gsize offset = 0;
+  GTimer *timer = NULL;
+
+  GST_LOG_OBJECT (filt, "Performing non-inplace transform");
+
+#if 0
+  timer = g_timer_new ();
+#endif
+
+  if (!gst_buffer_map (inbuf, &minfo, GST_MAP_READ)) {
+    GST_ELEMENT_ERROR (filt, STREAM, FAILED, ("Failed to map buffer"),
+        (NULL));
+    return GST_FLOW_ERROR;
+  }
+
+  in_stride = filt->stride_in;
+  meta = gst_buffer_get_video_meta (inbuf);
+  if (meta) {
+    offset = meta->offset[0];
+    in_stride = meta->stride[0];
+  }
+  if (offset + (gsize) in_stride * (filt->height - 1) +
+      filt->width * (filt->is_16bit ? 2 : 1) > minfo.size) {
+    gst_buffer_unmap (inbuf, &minfo);
+    GST_ELEMENT_ERROR (filt, STREAM, FAILED, (NULL),
+        ("Buffer of %" G_GSIZE_FORMAT " bytes is too small for the frame",
+            minfo.size));
+    return GST_FLOW_ERROR;
+  }
+  in_data = minfo.data + offset;
+
+  if (!gst_video_frame_map (&out_frame, &filt->info_out, outbuf,
+          GST_MAP_WRITE)) {
+    gst_buffer_unmap (inbuf, &minfo);
+    GST_ELEMENT_ERROR (filt, STREAM, FAILED, ("Failed to map buffer"),
+        (NULL));
+    return GST_FLOW_ERROR;
+  }
+
+  GST_OBJECT_LOCK (filt);
+  method = filt->method;
+  GST_OBJECT_UNLOCK (filt);
+
+  gst_bayer_demosaic_setup_stripes (filt);
+  n = gst_vision_task_runner_get_n_threads (filt->runner);
+  out_height = GST_VIDEO_FRAME_HEIGHT (&out_frame);
+  for (i = 0; i < n; i++) {
+    GstBayerDemosaicStripe *stripe = &filt->stripes[i];
+
+    stripe->method = method;
+    stripe->y_start = out_height * i / n;
+    stripe->y_end = out_height * (i + 1) / n;
+    stripe->in_data = in_data;
+    stripe->in_stride = in_stride;
+    stripe->out_data = GST_VIDEO_FRAME_PLANE_DATA (&out_frame, 0);
+    stripe->out_stride = GST_VIDEO_FRAME_PLANE_STRIDE (&out_frame, 0);
+  }
+
+  /* the negotiated size wins over a method changed since */
+  gst_vision_task_runner_run (filt->runner,
+      filt->half ? gst_bayer_demosaic_half_stripe :
+      gst_bayer_demosaic_interpolate_stripe, filt->stripe_data);
+
+  gst_video_frame_unmap (&out_frame);
+  gst_buffer_unmap (inbuf, &minfo);
+
+#if 0
+  GST_LOG_OBJECT (filt, "Processing took %.3f ms", g_timer_elapsed (timer,
+          NULL) * 1000);
+  g_timer_destroy (timer);
+#endif
+
+  return GST_FLOW_OK;
+}
+
+static gboolean
+gst_bayer_demosaic_stop (GstBaseTransform * trans)
+{
+  GstBayerDemosaic *filt = GST_BAYER_DEMOSAIC (trans);
+
+  gst_bayer_demosaic_free_stripes (filt);
+
+  return TRUE;
+}
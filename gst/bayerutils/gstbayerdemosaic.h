@@ -0,0 +1,150 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __GST_BAYER_DEMOSAIC_H__
+#define __GST_BAYER_DEMOSAIC_H__
+
+#include <gst/base/gstbasetransform.h>
+#include <gst/video/video.h>
+
+#include "gstvisiontaskrunner.h"
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_BAYER_DEMOSAIC \
+  (gst_bayer_demosaic_get_type())
+#define GST_BAYER_DEMOSAIC(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_BAYER_DEMOSAIC,GstBayerDemosaic))
+#define GST_BAYER_DEMOSAIC_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_BAYER_DEMOSAIC,GstBayerDemosaicClass))
+#define GST_IS_BAYER_DEMOSAIC(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_BAYER_DEMOSAIC))
+#define GST_IS_BAYER_DEMOSAIC_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_BAYER_DEMOSAIC))
+
+typedef struct _GstBayerDemosaic GstBayerDemosaic;
+typedef struct _GstBayerDemosaicClass GstBayerDemosaicClass;
+typedef struct _GstBayerDemosaicStripe GstBayerDemosaicStripe;
+
+/**
+* GstBayerDemosaicMethod:
+* @GST_BAYER_DEMOSAIC_METHOD_BILINEAR: average of the nearest samples
+* @GST_BAYER_DEMOSAIC_METHOD_MALVAR: gradient-corrected bilinear
+*   interpolation (Malvar, He and Cutler)
+* @GST_BAYER_DEMOSAIC_METHOD_HALF: one pixel per 2x2 quad, at half the
+*   width and height
+*
+* Interpolation used to reconstruct the missing color samples.
+*/
+typedef enum {
+  GST_BAYER_DEMOSAIC_METHOD_BILINEAR,
+  GST_BAYER_DEMOSAIC_METHOD_MALVAR,
+  GST_BAYER_DEMOSAIC_METHOD_HALF
+} GstBayerDemosaicMethod;
+
+/**
+* GstBayerDemosaicPack:
+*
+* How the red, green and blue rows are interleaved into the output.
+*/
+typedef enum {
+  GST_BAYER_DEMOSAIC_PACK_RGBX,
+  GST_BAYER_DEMOSAIC_PACK_XRGB,
+  GST_BAYER_DEMOSAIC_PACK_RGB,
+  GST_BAYER_DEMOSAIC_PACK_ARGB64
+} GstBayerDemosaicPack;
+
+/* one stripe of output rows, with its own scratch rows so stripes can be
+ * processed in parallel */
+struct _GstBayerDemosaicStripe
+{
+  GstBayerDemosaic *filt;
+  GstBayerDemosaicMethod method;
+  gint y_start;
+  gint y_end;
+
+  const guint8 *in_data;
+  gint in_stride;
+  guint8 *out_data;
+  gint out_stride;
+
+  /* last five input rows, padded by two mirrored samples on each side */
+  guint16 *rows[5];
+  /* vertical and horizontal averages around the current row */
+  guint16 *a1;
+  guint16 *a2;
+  guint16 *h1;
+  guint16 *h2;
+  guint16 *d;
+  /* interpolated color rows */
+  guint16 *r;
+  guint16 *g;
+  guint16 *b;
+  guint16 *scratch;
+};
+
+/**
+* GstBayerDemosaic:
+* @element: the parent element.
+*
+*
+* The opaque GstBayerDemosaic data structure.
+*/
+struct _GstBayerDemosaic
+{
+  GstBaseTransform element;
+
+  /* input format */
+  gint width;
+  gint height;
+  gint bpp;
+  gint endianness;
+  gboolean is_16bit;
+  gint stride_in;
+  /* first row starts with green, and its other color is red */
+  gboolean row0_green_first;
+  gboolean row0_red;
+
+  /* output format */
+  GstVideoInfo info_out;
+  GstBayerDemosaicPack pack;
+  gboolean swap_rb;
+  gint pack_shift;
+  gboolean half;
+
+  /* properties */
+  GstBayerDemosaicMethod method;
+  guint n_threads;
+
+  /* threading */
+  GstVisionTaskRunner *runner;
+  GstBayerDemosaicStripe *stripes;
+  gpointer *stripe_data;
+  gint stripes_width;
+};
+
+struct _GstBayerDemosaicClass
+{
+  GstBaseTransformClass parent_class;
+};
+
+GType gst_bayer_demosaic_get_type(void);
+
+G_END_DECLS
+
+#endif /* __GST_BAYER_DEMOSAIC_H__ */
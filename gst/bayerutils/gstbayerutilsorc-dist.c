@@ -0,0 +1,4702 @@
+#include "gstbayerutilsorc-dist.h"
+/* autogenerated from gstbayerutilsorc.orc */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifndef _ORC_INTEGER_TYPEDEFS_
+#define _ORC_INTEGER_TYPEDEFS_
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#include <stdint.h>
+typedef int8_t orc_int8;
+typedef int16_t orc_int16;
+typedef int32_t orc_int32;
+typedef int64_t orc_int64;
+typedef uint8_t orc_uint8;
+typedef uint16_t orc_uint16;
+typedef uint32_t orc_uint32;
+typedef uint64_t orc_uint64;
+#define ORC_UINT64_C(x) UINT64_C(x)
+#elif defined(_MSC_VER)
+typedef signed __int8 orc_int8;
+typedef signed __int16 orc_int16;
+typedef signed __int32 orc_int32;
+typedef signed __int64 orc_int64;
+typedef unsigned __int8 orc_uint8;
+typedef unsigned __int16 orc_uint16;
+typedef unsigned __int32 orc_uint32;
+typedef unsigned __int64 orc_uint64;
+#define ORC_UINT64_C(x) (x##Ui64)
+#define inline __inline
+#else
+#include <limits.h>
+typedef signed char orc_int8;
+typedef short orc_int16;
+typedef int orc_int32;
+typedef unsigned char orc_uint8;
+typedef unsigned short orc_uint16;
+typedef unsigned int orc_uint32;
+#if INT_MAX == LONG_MAX
+typedef long long orc_int64;
+typedef unsigned long long orc_uint64;
+#define ORC_UINT64_C(x) (x##ULL)
+#else
+typedef long orc_int64;
+typedef unsigned long orc_uint64;
+#define ORC_UINT64_C(x) (x##UL)
+#endif
+#endif
+typedef union { orc_int16 i; orc_int8 x2[2]; } orc_union16;
+typedef union { orc_int32 i; float f; orc_int16 x2[2]; orc_int8 x4[4]; } orc_union32;
+typedef union { orc_int64 i; double f; orc_int32 x2[2]; float x2f[2]; orc_int16 x4[4]; } orc_union64;
+#endif
+#ifndef ORC_RESTRICT
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define ORC_RESTRICT restrict
+#elif defined(__GNUC__) && __GNUC__ >= 4
+#define ORC_RESTRICT __restrict__
+#else
+#define ORC_RESTRICT
+#endif
+#endif
+
+#ifndef ORC_INTERNAL
+#if defined(__SUNPRO_C) && (__SUNPRO_C >= 0x590)
+#define ORC_INTERNAL __attribute__((visibility("hidden")))
+#elif defined(__SUNPRO_C) && (__SUNPRO_C >= 0x550)
+#define ORC_INTERNAL __hidden
+#elif defined (__GNUC__)
+#define ORC_INTERNAL __attribute__((visibility("hidden")))
+#else
+#define ORC_INTERNAL
+#endif
+#endif
+
+
+#ifndef DISABLE_ORC
+#include <orc/orc.h>
+#endif
+void bayerutils_orc_unpack_u8 (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n);
+void bayerutils_orc_unpack_u16_swap (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n);
+void bayerutils_orc_avg_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n);
+void bayerutils_orc_bilinear_cfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int n);
+void bayerutils_orc_bilinear_gfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int n);
+void bayerutils_orc_malvar_cfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, const guint32 * ORC_RESTRICT s5, const guint32 * ORC_RESTRICT s6, int p1, int n);
+void bayerutils_orc_malvar_gfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, const guint32 * ORC_RESTRICT s5, const guint32 * ORC_RESTRICT s6, int p1, int n);
+void bayerutils_orc_bin_cfirst (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int n);
+void bayerutils_orc_bin_gfirst (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int n);
+void bayerutils_orc_pack_rgbx (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n);
+void bayerutils_orc_pack_xrgb (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n);
+void bayerutils_orc_pack_argb64 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n);
+void bayerutils_orc_avg_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2, int n);
+void bayerutils_orc_hbin_avg_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n);
+void bayerutils_orc_hbin_avg_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n);
+void bayerutils_orc_hbin_avg_pair_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n);
+void bayerutils_orc_hbin_avg_pair_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n);
+void bayerutils_orc_hbin_skip_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n);
+void bayerutils_orc_hbin_skip_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n);
+void bayerutils_orc_hbin_skip_u32 (guint32 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int n);
+
+
+/* begin Orc C target preamble */
+#define ORC_CLAMP(x,a,b) ((x)<(a) ? (a) : ((x)>(b) ? (b) : (x)))
+#define ORC_ABS(a) ((a)<0 ? -(a) : (a))
+#define ORC_MIN(a,b) ((a)<(b) ? (a) : (b))
+#define ORC_MAX(a,b) ((a)>(b) ? (a) : (b))
+#define ORC_SB_MAX 127
+#define ORC_SB_MIN (-1-ORC_SB_MAX)
+#define ORC_UB_MAX 255
+#define ORC_UB_MIN 0
+#define ORC_SW_MAX 32767
+#define ORC_SW_MIN (-1-ORC_SW_MAX)
+#define ORC_UW_MAX 65535
+#define ORC_UW_MIN 0
+#define ORC_SL_MAX 2147483647
+#define ORC_SL_MIN (-1-ORC_SL_MAX)
+#define ORC_UL_MAX 4294967295U
+#define ORC_UL_MIN 0
+#define ORC_CLAMP_SB(x) ORC_CLAMP(x,ORC_SB_MIN,ORC_SB_MAX)
+#define ORC_CLAMP_UB(x) ORC_CLAMP(x,ORC_UB_MIN,ORC_UB_MAX)
+#define ORC_CLAMP_SW(x) ORC_CLAMP(x,ORC_SW_MIN,ORC_SW_MAX)
+#define ORC_CLAMP_UW(x) ORC_CLAMP(x,ORC_UW_MIN,ORC_UW_MAX)
+#define ORC_CLAMP_SL(x) ORC_CLAMP(x,ORC_SL_MIN,ORC_SL_MAX)
+#define ORC_CLAMP_UL(x) ORC_CLAMP(x,ORC_UL_MIN,ORC_UL_MAX)
+#define ORC_SWAP_W(x) ((((x)&0xffU)<<8) | (((x)&0xff00U)>>8))
+#define ORC_SWAP_L(x) ((((x)&0xffU)<<24) | (((x)&0xff00U)<<8) | (((x)&0xff0000U)>>8) | (((x)&0xff000000U)>>24))
+#define ORC_SWAP_Q(x) ((((x)&ORC_UINT64_C(0xff))<<56) | (((x)&ORC_UINT64_C(0xff00))<<40) | (((x)&ORC_UINT64_C(0xff0000))<<24) | (((x)&ORC_UINT64_C(0xff000000))<<8) | (((x)&ORC_UINT64_C(0xff00000000))>>8) | (((x)&ORC_UINT64_C(0xff0000000000))>>24) | (((x)&ORC_UINT64_C(0xff000000000000))>>40) | (((x)&ORC_UINT64_C(0xff00000000000000))>>56))
+#define ORC_PTR_OFFSET(ptr,offset) ((void *)(((unsigned char *)(ptr)) + (offset)))
+#define ORC_DENORMAL(x) ((x) & ((((x)&0x7f800000) == 0) ? 0xff800000 : 0xffffffff))
+#define ORC_ISNAN(x) ((((x)&0x7f800000) == 0x7f800000) && (((x)&0x007fffff) != 0))
+#define ORC_DENORMAL_DOUBLE(x) ((x) & ((((x)&ORC_UINT64_C(0x7ff0000000000000)) == 0) ? ORC_UINT64_C(0xfff0000000000000) : ORC_UINT64_C(0xffffffffffffffff)))
+#define ORC_ISNAN_DOUBLE(x) ((((x)&ORC_UINT64_C(0x7ff0000000000000)) == ORC_UINT64_C(0x7ff0000000000000)) && (((x)&ORC_UINT64_C(0x000fffffffffffff)) != 0))
+#ifndef ORC_RESTRICT
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define ORC_RESTRICT restrict
+#elif defined(__GNUC__) && __GNUC__ >= 4
+#define ORC_RESTRICT __restrict__
+#else
+#define ORC_RESTRICT
+#endif
+#endif
+/* end Orc C target preamble */
+
+
+
+/* bayerutils_orc_unpack_u8 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_unpack_u8 (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_int8 * ORC_RESTRICT ptr4;
+  orc_int8 var33;
+  orc_union16 var34;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_int8 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var33 = ptr4[i];
+    /* 1: convubw */
+    var34.i = (orc_uint8)var33;
+    /* 2: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_unpack_u8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_int8 * ORC_RESTRICT ptr4;
+  orc_int8 var33;
+  orc_union16 var34;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_int8 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var33 = ptr4[i];
+    /* 1: convubw */
+    var34.i = (orc_uint8)var33;
+    /* 2: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_unpack_u8 (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_unpack_u8");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_unpack_u8);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 1, "s1");
+
+      orc_program_append_2 (p, "convubw", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_unpack_u16_swap */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_unpack_u16_swap (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union16 var34;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_union16 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: swapw */
+    var34.i = ORC_SWAP_W (var33.i);
+    /* 2: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_unpack_u16_swap (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union16 var34;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: swapw */
+    var34.i = ORC_SWAP_W (var33.i);
+    /* 2: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_unpack_u16_swap (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_unpack_u16_swap");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_unpack_u16_swap);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 2, "s1");
+
+      orc_program_append_2 (p, "swapw", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_avg_u16 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_avg_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_union16 *)s1;
+  ptr5 = (orc_union16 *)s2;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: loadw */
+    var34 = ptr5[i];
+    /* 2: avguw */
+    var35.i = ((orc_uint16)var33.i + (orc_uint16)var34.i + 1) >> 1;
+    /* 3: storew */
+    ptr0[i] = var35;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_avg_u16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+  ptr5 = (orc_union16 *)ex->arrays[5];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: loadw */
+    var34 = ptr5[i];
+    /* 2: avguw */
+    var35.i = ((orc_uint16)var33.i + (orc_uint16)var34.i + 1) >> 1;
+    /* 3: storew */
+    ptr0[i] = var35;
+  }
+
+}
+
+void
+bayerutils_orc_avg_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_avg_u16");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_avg_u16);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+
+      orc_program_append_2 (p, "avguw", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_S2, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_bilinear_cfirst */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_bilinear_cfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int n){
+  int i;
+  orc_union32 * ORC_RESTRICT ptr0;
+  orc_union32 * ORC_RESTRICT ptr1;
+  orc_union32 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  const orc_union32 * ORC_RESTRICT ptr6;
+  const orc_union32 * ORC_RESTRICT ptr7;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+  orc_union16 var42;
+
+  ptr0 = (orc_union32 *)d1;
+  ptr1 = (orc_union32 *)d2;
+  ptr2 = (orc_union32 *)d3;
+  ptr4 = (orc_union32 *)s1;
+  ptr5 = (orc_union32 *)s2;
+  ptr6 = (orc_union32 *)s3;
+  ptr7 = (orc_union32 *)s4;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr5[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var40.i = _src.x2[0];
+    }
+    /* 2: loadl */
+    var35 = ptr6[i];
+    /* 3: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var41.i = _src.x2[0];
+    }
+    /* 4: avguw */
+    var42.i = ((orc_uint16)var40.i + (orc_uint16)var41.i + 1) >> 1;
+    /* 5: loadl */
+    var33 = ptr4[i];
+    /* 6: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var40.i = _src.x2[0];
+    }
+    /* 7: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var41.i = _src.x2[1];
+    }
+    /* 8: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var41.i;
+     var37.i = _dest.i;
+    }
+    /* 9: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var40.i = _src.x2[1];
+    }
+    /* 10: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var42.i;
+     _dest.x2[1] = var40.i;
+     var38.i = _dest.i;
+    }
+    /* 11: loadl */
+    var36 = ptr7[i];
+    /* 12: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var40.i = _src.x2[0];
+    }
+    /* 13: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var41.i = _src.x2[1];
+    }
+    /* 14: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var41.i;
+     var39.i = _dest.i;
+    }
+    /* 15: storel */
+    ptr0[i] = var37;
+    /* 16: storel */
+    ptr1[i] = var38;
+    /* 17: storel */
+    ptr2[i] = var39;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_bilinear_cfirst (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 * ORC_RESTRICT ptr0;
+  orc_union32 * ORC_RESTRICT ptr1;
+  orc_union32 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  const orc_union32 * ORC_RESTRICT ptr6;
+  const orc_union32 * ORC_RESTRICT ptr7;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+  orc_union16 var42;
+
+  ptr0 = (orc_union32 *)ex->arrays[0];
+  ptr1 = (orc_union32 *)ex->arrays[1];
+  ptr2 = (orc_union32 *)ex->arrays[2];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+  ptr5 = (orc_union32 *)ex->arrays[5];
+  ptr6 = (orc_union32 *)ex->arrays[6];
+  ptr7 = (orc_union32 *)ex->arrays[7];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr5[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var40.i = _src.x2[0];
+    }
+    /* 2: loadl */
+    var35 = ptr6[i];
+    /* 3: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var41.i = _src.x2[0];
+    }
+    /* 4: avguw */
+    var42.i = ((orc_uint16)var40.i + (orc_uint16)var41.i + 1) >> 1;
+    /* 5: loadl */
+    var33 = ptr4[i];
+    /* 6: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var40.i = _src.x2[0];
+    }
+    /* 7: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var41.i = _src.x2[1];
+    }
+    /* 8: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var41.i;
+     var37.i = _dest.i;
+    }
+    /* 9: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var40.i = _src.x2[1];
+    }
+    /* 10: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var42.i;
+     _dest.x2[1] = var40.i;
+     var38.i = _dest.i;
+    }
+    /* 11: loadl */
+    var36 = ptr7[i];
+    /* 12: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var40.i = _src.x2[0];
+    }
+    /* 13: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var41.i = _src.x2[1];
+    }
+    /* 14: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var41.i;
+     var39.i = _dest.i;
+    }
+    /* 15: storel */
+    ptr0[i] = var37;
+    /* 16: storel */
+    ptr1[i] = var38;
+    /* 17: storel */
+    ptr2[i] = var39;
+  }
+
+}
+
+void
+bayerutils_orc_bilinear_cfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_bilinear_cfirst");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_bilinear_cfirst);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_destination (p, 4, "d2");
+      orc_program_add_destination (p, 4, "d3");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_source (p, 4, "s3");
+      orc_program_add_source (p, 4, "s4");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avguw", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D2, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D3, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+  ex->arrays[ORC_VAR_S3] = (void *)s3;
+  ex->arrays[ORC_VAR_S4] = (void *)s4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_bilinear_gfirst */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_bilinear_gfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int n){
+  int i;
+  orc_union32 * ORC_RESTRICT ptr0;
+  orc_union32 * ORC_RESTRICT ptr1;
+  orc_union32 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  const orc_union32 * ORC_RESTRICT ptr6;
+  const orc_union32 * ORC_RESTRICT ptr7;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+  orc_union16 var42;
+
+  ptr0 = (orc_union32 *)d1;
+  ptr1 = (orc_union32 *)d2;
+  ptr2 = (orc_union32 *)d3;
+  ptr4 = (orc_union32 *)s1;
+  ptr5 = (orc_union32 *)s2;
+  ptr6 = (orc_union32 *)s3;
+  ptr7 = (orc_union32 *)s4;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr5[i];
+    /* 1: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var40.i = _src.x2[1];
+    }
+    /* 2: loadl */
+    var35 = ptr6[i];
+    /* 3: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var41.i = _src.x2[1];
+    }
+    /* 4: avguw */
+    var42.i = ((orc_uint16)var40.i + (orc_uint16)var41.i + 1) >> 1;
+    /* 5: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var40.i = _src.x2[0];
+    }
+    /* 6: loadl */
+    var33 = ptr4[i];
+    /* 7: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var41.i = _src.x2[1];
+    }
+    /* 8: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var41.i;
+     var37.i = _dest.i;
+    }
+    /* 9: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var40.i = _src.x2[0];
+    }
+    /* 10: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var42.i;
+     var38.i = _dest.i;
+    }
+    /* 11: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var40.i = _src.x2[0];
+    }
+    /* 12: loadl */
+    var36 = ptr7[i];
+    /* 13: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var41.i = _src.x2[1];
+    }
+    /* 14: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var41.i;
+     var39.i = _dest.i;
+    }
+    /* 15: storel */
+    ptr0[i] = var37;
+    /* 16: storel */
+    ptr1[i] = var38;
+    /* 17: storel */
+    ptr2[i] = var39;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_bilinear_gfirst (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 * ORC_RESTRICT ptr0;
+  orc_union32 * ORC_RESTRICT ptr1;
+  orc_union32 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  const orc_union32 * ORC_RESTRICT ptr6;
+  const orc_union32 * ORC_RESTRICT ptr7;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+  orc_union16 var42;
+
+  ptr0 = (orc_union32 *)ex->arrays[0];
+  ptr1 = (orc_union32 *)ex->arrays[1];
+  ptr2 = (orc_union32 *)ex->arrays[2];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+  ptr5 = (orc_union32 *)ex->arrays[5];
+  ptr6 = (orc_union32 *)ex->arrays[6];
+  ptr7 = (orc_union32 *)ex->arrays[7];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var34 = ptr5[i];
+    /* 1: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var40.i = _src.x2[1];
+    }
+    /* 2: loadl */
+    var35 = ptr6[i];
+    /* 3: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var41.i = _src.x2[1];
+    }
+    /* 4: avguw */
+    var42.i = ((orc_uint16)var40.i + (orc_uint16)var41.i + 1) >> 1;
+    /* 5: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var40.i = _src.x2[0];
+    }
+    /* 6: loadl */
+    var33 = ptr4[i];
+    /* 7: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var41.i = _src.x2[1];
+    }
+    /* 8: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var41.i;
+     var37.i = _dest.i;
+    }
+    /* 9: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var40.i = _src.x2[0];
+    }
+    /* 10: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var42.i;
+     var38.i = _dest.i;
+    }
+    /* 11: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var40.i = _src.x2[0];
+    }
+    /* 12: loadl */
+    var36 = ptr7[i];
+    /* 13: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var41.i = _src.x2[1];
+    }
+    /* 14: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var40.i;
+     _dest.x2[1] = var41.i;
+     var39.i = _dest.i;
+    }
+    /* 15: storel */
+    ptr0[i] = var37;
+    /* 16: storel */
+    ptr1[i] = var38;
+    /* 17: storel */
+    ptr2[i] = var39;
+  }
+
+}
+
+void
+bayerutils_orc_bilinear_gfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_bilinear_gfirst");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_bilinear_gfirst);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_destination (p, 4, "d2");
+      orc_program_add_destination (p, 4, "d3");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_source (p, 4, "s3");
+      orc_program_add_source (p, 4, "s4");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avguw", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D2, ORC_VAR_T1, ORC_VAR_T3, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_S4, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D3, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+  ex->arrays[ORC_VAR_S3] = (void *)s3;
+  ex->arrays[ORC_VAR_S4] = (void *)s4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_malvar_cfirst */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_malvar_cfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, const guint32 * ORC_RESTRICT s5, const guint32 * ORC_RESTRICT s6, int p1, int n){
+  int i;
+  orc_union32 * ORC_RESTRICT ptr0;
+  orc_union32 * ORC_RESTRICT ptr1;
+  orc_union32 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  const orc_union32 * ORC_RESTRICT ptr6;
+  const orc_union32 * ORC_RESTRICT ptr7;
+  const orc_union32 * ORC_RESTRICT ptr8;
+  const orc_union32 * ORC_RESTRICT ptr9;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union16 var51;
+  orc_union16 var52;
+  orc_union32 var53;
+  orc_union32 var54;
+  orc_union32 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+  orc_union32 var59;
+  orc_union32 var60;
+
+  ptr0 = (orc_union32 *)d1;
+  ptr1 = (orc_union32 *)d2;
+  ptr2 = (orc_union32 *)d3;
+  ptr4 = (orc_union32 *)s1;
+  ptr5 = (orc_union32 *)s2;
+  ptr6 = (orc_union32 *)s3;
+  ptr7 = (orc_union32 *)s4;
+  ptr8 = (orc_union32 *)s5;
+  ptr9 = (orc_union32 *)s6;
+
+  /* 0: loadpl */
+  var40.i = 0;
+  /* 1: loadpl */
+  var41.i = 1;
+  /* 2: loadpl */
+  var42.i = 2;
+  /* 3: loadpl */
+  var43.i = 3;
+  /* 4: loadpl */
+  var44.i = 4;
+  /* 5: loadpl */
+  var39.i = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 6: loadl */
+    var33 = ptr4[i];
+    /* 7: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[0];
+    }
+    /* 8: convuwl */
+    var53.i = (orc_uint16)var48.i;
+    /* 9: loadl */
+    var34 = ptr5[i];
+    /* 10: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var48.i = _src.x2[0];
+    }
+    /* 11: convuwl */
+    var54.i = (orc_uint16)var48.i;
+    /* 12: loadl */
+    var35 = ptr6[i];
+    /* 13: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var48.i = _src.x2[0];
+    }
+    /* 14: convuwl */
+    var55.i = (orc_uint16)var48.i;
+    /* 15: loadl */
+    var36 = ptr7[i];
+    /* 16: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var48.i = _src.x2[0];
+    }
+    /* 17: convuwl */
+    var56.i = (orc_uint16)var48.i;
+    /* 18: loadl */
+    var37 = ptr8[i];
+    /* 19: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var37.i;
+     var48.i = _src.x2[0];
+    }
+    /* 20: convuwl */
+    var57.i = (orc_uint16)var48.i;
+    /* 21: loadl */
+    var38 = ptr9[i];
+    /* 22: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var38.i;
+     var48.i = _src.x2[0];
+    }
+    /* 23: convuwl */
+    var58.i = (orc_uint16)var48.i;
+    /* 24: addl */
+    var59.i = ((orc_uint32)var53.i) + ((orc_uint32)var54.i);
+    /* 25: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var56.i);
+    /* 26: shll */
+    var59.i = ((orc_uint32)var59.i) << var41.i;
+    /* 27: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var55.i);
+    /* 28: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var57.i);
+    /* 29: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var42.i);
+    /* 30: shrsl */
+    var59.i = var59.i >> var42.i;
+    /* 31: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 32: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 33: convlw */
+    var49.i = var59.i;
+    /* 34: addl */
+    var60.i = ((orc_uint32)var55.i) + ((orc_uint32)var57.i);
+    /* 35: shll */
+    var59.i = ((orc_uint32)var60.i) << var41.i;
+    /* 36: addl */
+    var60.i = ((orc_uint32)var60.i) + ((orc_uint32)var59.i);
+    /* 37: shll */
+    var59.i = ((orc_uint32)var53.i) << var41.i;
+    /* 38: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 39: shll */
+    var59.i = ((orc_uint32)var59.i) << var41.i;
+    /* 40: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 41: shll */
+    var60.i = ((orc_uint32)var58.i) << var43.i;
+    /* 42: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 43: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 44: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 45: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 46: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 47: convlw */
+    var50.i = var59.i;
+    /* 48: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[1];
+    }
+    /* 49: convuwl */
+    var53.i = (orc_uint16)var48.i;
+    /* 50: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var48.i = _src.x2[1];
+    }
+    /* 51: convuwl */
+    var54.i = (orc_uint16)var48.i;
+    /* 52: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var48.i = _src.x2[1];
+    }
+    /* 53: convuwl */
+    var55.i = (orc_uint16)var48.i;
+    /* 54: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var48.i = _src.x2[1];
+    }
+    /* 55: convuwl */
+    var56.i = (orc_uint16)var48.i;
+    /* 56: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var37.i;
+     var48.i = _src.x2[1];
+    }
+    /* 57: convuwl */
+    var57.i = (orc_uint16)var48.i;
+    /* 58: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var38.i;
+     var48.i = _src.x2[1];
+    }
+    /* 59: convuwl */
+    var58.i = (orc_uint16)var48.i;
+    /* 60: shll */
+    var59.i = ((orc_uint32)var53.i) << var42.i;
+    /* 61: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 62: shll */
+    var60.i = ((orc_uint32)var54.i) << var43.i;
+    /* 63: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 64: shll */
+    var60.i = ((orc_uint32)var55.i) << var41.i;
+    /* 65: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 66: shll */
+    var60.i = ((orc_uint32)var58.i) << var42.i;
+    /* 67: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 68: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var57.i);
+    /* 69: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 70: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 71: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 72: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 73: convlw */
+    var51.i = var59.i;
+    /* 74: shll */
+    var59.i = ((orc_uint32)var53.i) << var42.i;
+    /* 75: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 76: shll */
+    var60.i = ((orc_uint32)var56.i) << var43.i;
+    /* 77: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 78: shll */
+    var60.i = ((orc_uint32)var57.i) << var41.i;
+    /* 79: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 80: shll */
+    var60.i = ((orc_uint32)var58.i) << var42.i;
+    /* 81: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 82: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var55.i);
+    /* 83: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 84: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 85: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 86: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 87: convlw */
+    var52.i = var59.i;
+    /* 88: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[0];
+    }
+    /* 89: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var48.i;
+     _dest.x2[1] = var51.i;
+     var45.i = _dest.i;
+    }
+    /* 90: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[1];
+    }
+    /* 91: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var49.i;
+     _dest.x2[1] = var48.i;
+     var46.i = _dest.i;
+    }
+    /* 92: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var50.i;
+     _dest.x2[1] = var52.i;
+     var47.i = _dest.i;
+    }
+    /* 93: storel */
+    ptr0[i] = var45;
+    /* 94: storel */
+    ptr1[i] = var46;
+    /* 95: storel */
+    ptr2[i] = var47;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_malvar_cfirst (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 * ORC_RESTRICT ptr0;
+  orc_union32 * ORC_RESTRICT ptr1;
+  orc_union32 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  const orc_union32 * ORC_RESTRICT ptr6;
+  const orc_union32 * ORC_RESTRICT ptr7;
+  const orc_union32 * ORC_RESTRICT ptr8;
+  const orc_union32 * ORC_RESTRICT ptr9;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union16 var51;
+  orc_union16 var52;
+  orc_union32 var53;
+  orc_union32 var54;
+  orc_union32 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+  orc_union32 var59;
+  orc_union32 var60;
+
+  ptr0 = (orc_union32 *)ex->arrays[0];
+  ptr1 = (orc_union32 *)ex->arrays[1];
+  ptr2 = (orc_union32 *)ex->arrays[2];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+  ptr5 = (orc_union32 *)ex->arrays[5];
+  ptr6 = (orc_union32 *)ex->arrays[6];
+  ptr7 = (orc_union32 *)ex->arrays[7];
+  ptr8 = (orc_union32 *)ex->arrays[8];
+  ptr9 = (orc_union32 *)ex->arrays[9];
+
+  /* 0: loadpl */
+  var40.i = 0;
+  /* 1: loadpl */
+  var41.i = 1;
+  /* 2: loadpl */
+  var42.i = 2;
+  /* 3: loadpl */
+  var43.i = 3;
+  /* 4: loadpl */
+  var44.i = 4;
+  /* 5: loadpl */
+  var39.i = ex->params[24];
+
+  for (i = 0; i < n; i++) {
+    /* 6: loadl */
+    var33 = ptr4[i];
+    /* 7: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[0];
+    }
+    /* 8: convuwl */
+    var53.i = (orc_uint16)var48.i;
+    /* 9: loadl */
+    var34 = ptr5[i];
+    /* 10: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var48.i = _src.x2[0];
+    }
+    /* 11: convuwl */
+    var54.i = (orc_uint16)var48.i;
+    /* 12: loadl */
+    var35 = ptr6[i];
+    /* 13: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var48.i = _src.x2[0];
+    }
+    /* 14: convuwl */
+    var55.i = (orc_uint16)var48.i;
+    /* 15: loadl */
+    var36 = ptr7[i];
+    /* 16: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var48.i = _src.x2[0];
+    }
+    /* 17: convuwl */
+    var56.i = (orc_uint16)var48.i;
+    /* 18: loadl */
+    var37 = ptr8[i];
+    /* 19: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var37.i;
+     var48.i = _src.x2[0];
+    }
+    /* 20: convuwl */
+    var57.i = (orc_uint16)var48.i;
+    /* 21: loadl */
+    var38 = ptr9[i];
+    /* 22: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var38.i;
+     var48.i = _src.x2[0];
+    }
+    /* 23: convuwl */
+    var58.i = (orc_uint16)var48.i;
+    /* 24: addl */
+    var59.i = ((orc_uint32)var53.i) + ((orc_uint32)var54.i);
+    /* 25: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var56.i);
+    /* 26: shll */
+    var59.i = ((orc_uint32)var59.i) << var41.i;
+    /* 27: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var55.i);
+    /* 28: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var57.i);
+    /* 29: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var42.i);
+    /* 30: shrsl */
+    var59.i = var59.i >> var42.i;
+    /* 31: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 32: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 33: convlw */
+    var49.i = var59.i;
+    /* 34: addl */
+    var60.i = ((orc_uint32)var55.i) + ((orc_uint32)var57.i);
+    /* 35: shll */
+    var59.i = ((orc_uint32)var60.i) << var41.i;
+    /* 36: addl */
+    var60.i = ((orc_uint32)var60.i) + ((orc_uint32)var59.i);
+    /* 37: shll */
+    var59.i = ((orc_uint32)var53.i) << var41.i;
+    /* 38: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 39: shll */
+    var59.i = ((orc_uint32)var59.i) << var41.i;
+    /* 40: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 41: shll */
+    var60.i = ((orc_uint32)var58.i) << var43.i;
+    /* 42: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 43: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 44: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 45: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 46: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 47: convlw */
+    var50.i = var59.i;
+    /* 48: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[1];
+    }
+    /* 49: convuwl */
+    var53.i = (orc_uint16)var48.i;
+    /* 50: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var48.i = _src.x2[1];
+    }
+    /* 51: convuwl */
+    var54.i = (orc_uint16)var48.i;
+    /* 52: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var48.i = _src.x2[1];
+    }
+    /* 53: convuwl */
+    var55.i = (orc_uint16)var48.i;
+    /* 54: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var48.i = _src.x2[1];
+    }
+    /* 55: convuwl */
+    var56.i = (orc_uint16)var48.i;
+    /* 56: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var37.i;
+     var48.i = _src.x2[1];
+    }
+    /* 57: convuwl */
+    var57.i = (orc_uint16)var48.i;
+    /* 58: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var38.i;
+     var48.i = _src.x2[1];
+    }
+    /* 59: convuwl */
+    var58.i = (orc_uint16)var48.i;
+    /* 60: shll */
+    var59.i = ((orc_uint32)var53.i) << var42.i;
+    /* 61: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 62: shll */
+    var60.i = ((orc_uint32)var54.i) << var43.i;
+    /* 63: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 64: shll */
+    var60.i = ((orc_uint32)var55.i) << var41.i;
+    /* 65: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 66: shll */
+    var60.i = ((orc_uint32)var58.i) << var42.i;
+    /* 67: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 68: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var57.i);
+    /* 69: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 70: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 71: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 72: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 73: convlw */
+    var51.i = var59.i;
+    /* 74: shll */
+    var59.i = ((orc_uint32)var53.i) << var42.i;
+    /* 75: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 76: shll */
+    var60.i = ((orc_uint32)var56.i) << var43.i;
+    /* 77: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 78: shll */
+    var60.i = ((orc_uint32)var57.i) << var41.i;
+    /* 79: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 80: shll */
+    var60.i = ((orc_uint32)var58.i) << var42.i;
+    /* 81: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 82: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var55.i);
+    /* 83: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 84: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 85: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 86: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 87: convlw */
+    var52.i = var59.i;
+    /* 88: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[0];
+    }
+    /* 89: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var48.i;
+     _dest.x2[1] = var51.i;
+     var45.i = _dest.i;
+    }
+    /* 90: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[1];
+    }
+    /* 91: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var49.i;
+     _dest.x2[1] = var48.i;
+     var46.i = _dest.i;
+    }
+    /* 92: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var50.i;
+     _dest.x2[1] = var52.i;
+     var47.i = _dest.i;
+    }
+    /* 93: storel */
+    ptr0[i] = var45;
+    /* 94: storel */
+    ptr1[i] = var46;
+    /* 95: storel */
+    ptr2[i] = var47;
+  }
+
+}
+
+void
+bayerutils_orc_malvar_cfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, const guint32 * ORC_RESTRICT s5, const guint32 * ORC_RESTRICT s6, int p1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_malvar_cfirst");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_malvar_cfirst);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_destination (p, 4, "d2");
+      orc_program_add_destination (p, 4, "d3");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_source (p, 4, "s3");
+      orc_program_add_source (p, 4, "s4");
+      orc_program_add_source (p, 4, "s5");
+      orc_program_add_source (p, 4, "s6");
+      orc_program_add_constant (p, 4, 0x00000000, "c1");
+      orc_program_add_constant (p, 4, 0x00000001, "c2");
+      orc_program_add_constant (p, 4, 0x00000002, "c3");
+      orc_program_add_constant (p, 4, 0x00000003, "c4");
+      orc_program_add_constant (p, 4, 0x00000004, "c5");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+      orc_program_add_temporary (p, 2, "t4");
+      orc_program_add_temporary (p, 2, "t5");
+      orc_program_add_temporary (p, 4, "t6");
+      orc_program_add_temporary (p, 4, "t7");
+      orc_program_add_temporary (p, 4, "t8");
+      orc_program_add_temporary (p, 4, "t9");
+      orc_program_add_temporary (p, 4, "t10");
+      orc_program_add_temporary (p, 4, "t11");
+      orc_program_add_temporary (p, 4, "t12");
+      orc_program_add_temporary (p, 4, "t13");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T6, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T7, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T8, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T9, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S5, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T10, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S6, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T11, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_T7, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T9, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T8, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T10, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "maxsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T2, ORC_VAR_T12, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T13, ORC_VAR_T8, ORC_VAR_T10, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T13, ORC_VAR_T13, ORC_VAR_T12, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T11, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "maxsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T3, ORC_VAR_T12, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T6, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T7, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T8, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T9, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S5, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T10, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S6, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T11, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T7, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T8, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T11, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T10, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "maxsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T4, ORC_VAR_T12, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T9, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T10, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T11, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T8, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "maxsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T5, ORC_VAR_T12, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_T4, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D2, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D3, ORC_VAR_T3, ORC_VAR_T5, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+  ex->arrays[ORC_VAR_S3] = (void *)s3;
+  ex->arrays[ORC_VAR_S4] = (void *)s4;
+  ex->arrays[ORC_VAR_S5] = (void *)s5;
+  ex->arrays[ORC_VAR_S6] = (void *)s6;
+  ex->params[ORC_VAR_P1] = p1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_malvar_gfirst */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_malvar_gfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, const guint32 * ORC_RESTRICT s5, const guint32 * ORC_RESTRICT s6, int p1, int n){
+  int i;
+  orc_union32 * ORC_RESTRICT ptr0;
+  orc_union32 * ORC_RESTRICT ptr1;
+  orc_union32 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  const orc_union32 * ORC_RESTRICT ptr6;
+  const orc_union32 * ORC_RESTRICT ptr7;
+  const orc_union32 * ORC_RESTRICT ptr8;
+  const orc_union32 * ORC_RESTRICT ptr9;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union16 var51;
+  orc_union16 var52;
+  orc_union32 var53;
+  orc_union32 var54;
+  orc_union32 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+  orc_union32 var59;
+  orc_union32 var60;
+
+  ptr0 = (orc_union32 *)d1;
+  ptr1 = (orc_union32 *)d2;
+  ptr2 = (orc_union32 *)d3;
+  ptr4 = (orc_union32 *)s1;
+  ptr5 = (orc_union32 *)s2;
+  ptr6 = (orc_union32 *)s3;
+  ptr7 = (orc_union32 *)s4;
+  ptr8 = (orc_union32 *)s5;
+  ptr9 = (orc_union32 *)s6;
+
+  /* 0: loadpl */
+  var40.i = 0;
+  /* 1: loadpl */
+  var41.i = 1;
+  /* 2: loadpl */
+  var42.i = 2;
+  /* 3: loadpl */
+  var43.i = 3;
+  /* 4: loadpl */
+  var44.i = 4;
+  /* 5: loadpl */
+  var39.i = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 6: loadl */
+    var33 = ptr4[i];
+    /* 7: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[0];
+    }
+    /* 8: convuwl */
+    var53.i = (orc_uint16)var48.i;
+    /* 9: loadl */
+    var34 = ptr5[i];
+    /* 10: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var48.i = _src.x2[0];
+    }
+    /* 11: convuwl */
+    var54.i = (orc_uint16)var48.i;
+    /* 12: loadl */
+    var35 = ptr6[i];
+    /* 13: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var48.i = _src.x2[0];
+    }
+    /* 14: convuwl */
+    var55.i = (orc_uint16)var48.i;
+    /* 15: loadl */
+    var36 = ptr7[i];
+    /* 16: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var48.i = _src.x2[0];
+    }
+    /* 17: convuwl */
+    var56.i = (orc_uint16)var48.i;
+    /* 18: loadl */
+    var37 = ptr8[i];
+    /* 19: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var37.i;
+     var48.i = _src.x2[0];
+    }
+    /* 20: convuwl */
+    var57.i = (orc_uint16)var48.i;
+    /* 21: loadl */
+    var38 = ptr9[i];
+    /* 22: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var38.i;
+     var48.i = _src.x2[0];
+    }
+    /* 23: convuwl */
+    var58.i = (orc_uint16)var48.i;
+    /* 24: shll */
+    var59.i = ((orc_uint32)var53.i) << var42.i;
+    /* 25: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 26: shll */
+    var60.i = ((orc_uint32)var54.i) << var43.i;
+    /* 27: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 28: shll */
+    var60.i = ((orc_uint32)var55.i) << var41.i;
+    /* 29: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 30: shll */
+    var60.i = ((orc_uint32)var58.i) << var42.i;
+    /* 31: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 32: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var57.i);
+    /* 33: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 34: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 35: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 36: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 37: convlw */
+    var51.i = var59.i;
+    /* 38: shll */
+    var59.i = ((orc_uint32)var53.i) << var42.i;
+    /* 39: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 40: shll */
+    var60.i = ((orc_uint32)var56.i) << var43.i;
+    /* 41: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 42: shll */
+    var60.i = ((orc_uint32)var57.i) << var41.i;
+    /* 43: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 44: shll */
+    var60.i = ((orc_uint32)var58.i) << var42.i;
+    /* 45: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 46: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var55.i);
+    /* 47: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 48: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 49: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 50: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 51: convlw */
+    var52.i = var59.i;
+    /* 52: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[1];
+    }
+    /* 53: convuwl */
+    var53.i = (orc_uint16)var48.i;
+    /* 54: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var48.i = _src.x2[1];
+    }
+    /* 55: convuwl */
+    var54.i = (orc_uint16)var48.i;
+    /* 56: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var48.i = _src.x2[1];
+    }
+    /* 57: convuwl */
+    var55.i = (orc_uint16)var48.i;
+    /* 58: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var48.i = _src.x2[1];
+    }
+    /* 59: convuwl */
+    var56.i = (orc_uint16)var48.i;
+    /* 60: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var37.i;
+     var48.i = _src.x2[1];
+    }
+    /* 61: convuwl */
+    var57.i = (orc_uint16)var48.i;
+    /* 62: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var38.i;
+     var48.i = _src.x2[1];
+    }
+    /* 63: convuwl */
+    var58.i = (orc_uint16)var48.i;
+    /* 64: addl */
+    var59.i = ((orc_uint32)var53.i) + ((orc_uint32)var54.i);
+    /* 65: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var56.i);
+    /* 66: shll */
+    var59.i = ((orc_uint32)var59.i) << var41.i;
+    /* 67: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var55.i);
+    /* 68: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var57.i);
+    /* 69: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var42.i);
+    /* 70: shrsl */
+    var59.i = var59.i >> var42.i;
+    /* 71: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 72: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 73: convlw */
+    var49.i = var59.i;
+    /* 74: addl */
+    var60.i = ((orc_uint32)var55.i) + ((orc_uint32)var57.i);
+    /* 75: shll */
+    var59.i = ((orc_uint32)var60.i) << var41.i;
+    /* 76: addl */
+    var60.i = ((orc_uint32)var60.i) + ((orc_uint32)var59.i);
+    /* 77: shll */
+    var59.i = ((orc_uint32)var53.i) << var41.i;
+    /* 78: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 79: shll */
+    var59.i = ((orc_uint32)var59.i) << var41.i;
+    /* 80: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 81: shll */
+    var60.i = ((orc_uint32)var58.i) << var43.i;
+    /* 82: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 83: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 84: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 85: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 86: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 87: convlw */
+    var50.i = var59.i;
+    /* 88: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[1];
+    }
+    /* 89: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var51.i;
+     _dest.x2[1] = var48.i;
+     var45.i = _dest.i;
+    }
+    /* 90: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[0];
+    }
+    /* 91: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var48.i;
+     _dest.x2[1] = var49.i;
+     var46.i = _dest.i;
+    }
+    /* 92: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var52.i;
+     _dest.x2[1] = var50.i;
+     var47.i = _dest.i;
+    }
+    /* 93: storel */
+    ptr0[i] = var45;
+    /* 94: storel */
+    ptr1[i] = var46;
+    /* 95: storel */
+    ptr2[i] = var47;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_malvar_gfirst (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 * ORC_RESTRICT ptr0;
+  orc_union32 * ORC_RESTRICT ptr1;
+  orc_union32 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  const orc_union32 * ORC_RESTRICT ptr6;
+  const orc_union32 * ORC_RESTRICT ptr7;
+  const orc_union32 * ORC_RESTRICT ptr8;
+  const orc_union32 * ORC_RESTRICT ptr9;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union32 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union16 var51;
+  orc_union16 var52;
+  orc_union32 var53;
+  orc_union32 var54;
+  orc_union32 var55;
+  orc_union32 var56;
+  orc_union32 var57;
+  orc_union32 var58;
+  orc_union32 var59;
+  orc_union32 var60;
+
+  ptr0 = (orc_union32 *)ex->arrays[0];
+  ptr1 = (orc_union32 *)ex->arrays[1];
+  ptr2 = (orc_union32 *)ex->arrays[2];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+  ptr5 = (orc_union32 *)ex->arrays[5];
+  ptr6 = (orc_union32 *)ex->arrays[6];
+  ptr7 = (orc_union32 *)ex->arrays[7];
+  ptr8 = (orc_union32 *)ex->arrays[8];
+  ptr9 = (orc_union32 *)ex->arrays[9];
+
+  /* 0: loadpl */
+  var40.i = 0;
+  /* 1: loadpl */
+  var41.i = 1;
+  /* 2: loadpl */
+  var42.i = 2;
+  /* 3: loadpl */
+  var43.i = 3;
+  /* 4: loadpl */
+  var44.i = 4;
+  /* 5: loadpl */
+  var39.i = ex->params[24];
+
+  for (i = 0; i < n; i++) {
+    /* 6: loadl */
+    var33 = ptr4[i];
+    /* 7: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[0];
+    }
+    /* 8: convuwl */
+    var53.i = (orc_uint16)var48.i;
+    /* 9: loadl */
+    var34 = ptr5[i];
+    /* 10: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var48.i = _src.x2[0];
+    }
+    /* 11: convuwl */
+    var54.i = (orc_uint16)var48.i;
+    /* 12: loadl */
+    var35 = ptr6[i];
+    /* 13: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var48.i = _src.x2[0];
+    }
+    /* 14: convuwl */
+    var55.i = (orc_uint16)var48.i;
+    /* 15: loadl */
+    var36 = ptr7[i];
+    /* 16: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var48.i = _src.x2[0];
+    }
+    /* 17: convuwl */
+    var56.i = (orc_uint16)var48.i;
+    /* 18: loadl */
+    var37 = ptr8[i];
+    /* 19: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var37.i;
+     var48.i = _src.x2[0];
+    }
+    /* 20: convuwl */
+    var57.i = (orc_uint16)var48.i;
+    /* 21: loadl */
+    var38 = ptr9[i];
+    /* 22: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var38.i;
+     var48.i = _src.x2[0];
+    }
+    /* 23: convuwl */
+    var58.i = (orc_uint16)var48.i;
+    /* 24: shll */
+    var59.i = ((orc_uint32)var53.i) << var42.i;
+    /* 25: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 26: shll */
+    var60.i = ((orc_uint32)var54.i) << var43.i;
+    /* 27: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 28: shll */
+    var60.i = ((orc_uint32)var55.i) << var41.i;
+    /* 29: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 30: shll */
+    var60.i = ((orc_uint32)var58.i) << var42.i;
+    /* 31: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 32: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var57.i);
+    /* 33: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 34: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 35: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 36: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 37: convlw */
+    var51.i = var59.i;
+    /* 38: shll */
+    var59.i = ((orc_uint32)var53.i) << var42.i;
+    /* 39: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 40: shll */
+    var60.i = ((orc_uint32)var56.i) << var43.i;
+    /* 41: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 42: shll */
+    var60.i = ((orc_uint32)var57.i) << var41.i;
+    /* 43: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 44: shll */
+    var60.i = ((orc_uint32)var58.i) << var42.i;
+    /* 45: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 46: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var55.i);
+    /* 47: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 48: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 49: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 50: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 51: convlw */
+    var52.i = var59.i;
+    /* 52: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[1];
+    }
+    /* 53: convuwl */
+    var53.i = (orc_uint16)var48.i;
+    /* 54: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var48.i = _src.x2[1];
+    }
+    /* 55: convuwl */
+    var54.i = (orc_uint16)var48.i;
+    /* 56: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var48.i = _src.x2[1];
+    }
+    /* 57: convuwl */
+    var55.i = (orc_uint16)var48.i;
+    /* 58: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var48.i = _src.x2[1];
+    }
+    /* 59: convuwl */
+    var56.i = (orc_uint16)var48.i;
+    /* 60: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var37.i;
+     var48.i = _src.x2[1];
+    }
+    /* 61: convuwl */
+    var57.i = (orc_uint16)var48.i;
+    /* 62: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var38.i;
+     var48.i = _src.x2[1];
+    }
+    /* 63: convuwl */
+    var58.i = (orc_uint16)var48.i;
+    /* 64: addl */
+    var59.i = ((orc_uint32)var53.i) + ((orc_uint32)var54.i);
+    /* 65: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var56.i);
+    /* 66: shll */
+    var59.i = ((orc_uint32)var59.i) << var41.i;
+    /* 67: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var55.i);
+    /* 68: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var57.i);
+    /* 69: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var42.i);
+    /* 70: shrsl */
+    var59.i = var59.i >> var42.i;
+    /* 71: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 72: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 73: convlw */
+    var49.i = var59.i;
+    /* 74: addl */
+    var60.i = ((orc_uint32)var55.i) + ((orc_uint32)var57.i);
+    /* 75: shll */
+    var59.i = ((orc_uint32)var60.i) << var41.i;
+    /* 76: addl */
+    var60.i = ((orc_uint32)var60.i) + ((orc_uint32)var59.i);
+    /* 77: shll */
+    var59.i = ((orc_uint32)var53.i) << var41.i;
+    /* 78: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var53.i);
+    /* 79: shll */
+    var59.i = ((orc_uint32)var59.i) << var41.i;
+    /* 80: subl */
+    var59.i = ((orc_uint32)var59.i) - ((orc_uint32)var60.i);
+    /* 81: shll */
+    var60.i = ((orc_uint32)var58.i) << var43.i;
+    /* 82: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var60.i);
+    /* 83: addl */
+    var59.i = ((orc_uint32)var59.i) + ((orc_uint32)var44.i);
+    /* 84: shrsl */
+    var59.i = var59.i >> var43.i;
+    /* 85: maxsl */
+    var59.i = ORC_MAX (var59.i, var40.i);
+    /* 86: minsl */
+    var59.i = ORC_MIN (var59.i, var39.i);
+    /* 87: convlw */
+    var50.i = var59.i;
+    /* 88: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[1];
+    }
+    /* 89: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var51.i;
+     _dest.x2[1] = var48.i;
+     var45.i = _dest.i;
+    }
+    /* 90: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var48.i = _src.x2[0];
+    }
+    /* 91: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var48.i;
+     _dest.x2[1] = var49.i;
+     var46.i = _dest.i;
+    }
+    /* 92: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var52.i;
+     _dest.x2[1] = var50.i;
+     var47.i = _dest.i;
+    }
+    /* 93: storel */
+    ptr0[i] = var45;
+    /* 94: storel */
+    ptr1[i] = var46;
+    /* 95: storel */
+    ptr2[i] = var47;
+  }
+
+}
+
+void
+bayerutils_orc_malvar_gfirst (guint32 * ORC_RESTRICT d1, guint32 * ORC_RESTRICT d2, guint32 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, const guint32 * ORC_RESTRICT s3, const guint32 * ORC_RESTRICT s4, const guint32 * ORC_RESTRICT s5, const guint32 * ORC_RESTRICT s6, int p1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_malvar_gfirst");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_malvar_gfirst);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_destination (p, 4, "d2");
+      orc_program_add_destination (p, 4, "d3");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_source (p, 4, "s3");
+      orc_program_add_source (p, 4, "s4");
+      orc_program_add_source (p, 4, "s5");
+      orc_program_add_source (p, 4, "s6");
+      orc_program_add_constant (p, 4, 0x00000000, "c1");
+      orc_program_add_constant (p, 4, 0x00000001, "c2");
+      orc_program_add_constant (p, 4, 0x00000002, "c3");
+      orc_program_add_constant (p, 4, 0x00000003, "c4");
+      orc_program_add_constant (p, 4, 0x00000004, "c5");
+      orc_program_add_parameter (p, 4, "p1");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+      orc_program_add_temporary (p, 2, "t4");
+      orc_program_add_temporary (p, 2, "t5");
+      orc_program_add_temporary (p, 4, "t6");
+      orc_program_add_temporary (p, 4, "t7");
+      orc_program_add_temporary (p, 4, "t8");
+      orc_program_add_temporary (p, 4, "t9");
+      orc_program_add_temporary (p, 4, "t10");
+      orc_program_add_temporary (p, 4, "t11");
+      orc_program_add_temporary (p, 4, "t12");
+      orc_program_add_temporary (p, 4, "t13");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T6, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T7, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T8, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T9, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S5, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T10, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S6, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T11, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T7, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T8, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T11, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T10, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "maxsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T4, ORC_VAR_T12, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T9, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T10, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T11, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T8, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "maxsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T5, ORC_VAR_T12, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T6, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T7, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T8, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S4, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T9, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S5, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T10, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S6, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T11, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_T7, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T9, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T8, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T10, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "maxsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T2, ORC_VAR_T12, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T13, ORC_VAR_T8, ORC_VAR_T10, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T13, ORC_VAR_T13, ORC_VAR_T12, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T6, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "subl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T13, ORC_VAR_T11, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_T13, ORC_VAR_D1);
+      orc_program_append_2 (p, "addl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "maxsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minsl", 0, ORC_VAR_T12, ORC_VAR_T12, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T3, ORC_VAR_T12, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T4, ORC_VAR_T1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D2, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D3, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+  ex->arrays[ORC_VAR_S3] = (void *)s3;
+  ex->arrays[ORC_VAR_S4] = (void *)s4;
+  ex->arrays[ORC_VAR_S5] = (void *)s5;
+  ex->arrays[ORC_VAR_S6] = (void *)s6;
+  ex->params[ORC_VAR_P1] = p1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_bin_cfirst */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_bin_cfirst (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  orc_union16 * ORC_RESTRICT ptr1;
+  orc_union16 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr1 = (orc_union16 *)d2;
+  ptr2 = (orc_union16 *)d3;
+  ptr4 = (orc_union32 *)s1;
+  ptr5 = (orc_union32 *)s2;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var38.i = _src.x2[1];
+    }
+    /* 3: loadl */
+    var34 = ptr5[i];
+    /* 4: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var39.i = _src.x2[0];
+    }
+    /* 5: avguw */
+    var36.i = ((orc_uint16)var38.i + (orc_uint16)var39.i + 1) >> 1;
+    /* 6: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var37.i = _src.x2[1];
+    }
+    /* 7: storew */
+    ptr0[i] = var35;
+    /* 8: storew */
+    ptr1[i] = var36;
+    /* 9: storew */
+    ptr2[i] = var37;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_bin_cfirst (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  orc_union16 * ORC_RESTRICT ptr1;
+  orc_union16 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr1 = (orc_union16 *)ex->arrays[1];
+  ptr2 = (orc_union16 *)ex->arrays[2];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+  ptr5 = (orc_union32 *)ex->arrays[5];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var38.i = _src.x2[1];
+    }
+    /* 3: loadl */
+    var34 = ptr5[i];
+    /* 4: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var39.i = _src.x2[0];
+    }
+    /* 5: avguw */
+    var36.i = ((orc_uint16)var38.i + (orc_uint16)var39.i + 1) >> 1;
+    /* 6: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var37.i = _src.x2[1];
+    }
+    /* 7: storew */
+    ptr0[i] = var35;
+    /* 8: storew */
+    ptr1[i] = var36;
+    /* 9: storew */
+    ptr2[i] = var37;
+  }
+
+}
+
+void
+bayerutils_orc_bin_cfirst (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_bin_cfirst");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_bin_cfirst);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_destination (p, 2, "d2");
+      orc_program_add_destination (p, 2, "d3");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avguw", 0, ORC_VAR_D2, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_D3, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_bin_gfirst */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_bin_gfirst (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  orc_union16 * ORC_RESTRICT ptr1;
+  orc_union16 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr1 = (orc_union16 *)d2;
+  ptr2 = (orc_union16 *)d3;
+  ptr4 = (orc_union32 *)s1;
+  ptr5 = (orc_union32 *)s2;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[1];
+    }
+    /* 2: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var38.i = _src.x2[0];
+    }
+    /* 3: loadl */
+    var34 = ptr5[i];
+    /* 4: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var39.i = _src.x2[1];
+    }
+    /* 5: avguw */
+    var36.i = ((orc_uint16)var38.i + (orc_uint16)var39.i + 1) >> 1;
+    /* 6: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var37.i = _src.x2[0];
+    }
+    /* 7: storew */
+    ptr0[i] = var35;
+    /* 8: storew */
+    ptr1[i] = var36;
+    /* 9: storew */
+    ptr2[i] = var37;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_bin_gfirst (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  orc_union16 * ORC_RESTRICT ptr1;
+  orc_union16 * ORC_RESTRICT ptr2;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  const orc_union32 * ORC_RESTRICT ptr5;
+  orc_union32 var33;
+  orc_union32 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr1 = (orc_union16 *)ex->arrays[1];
+  ptr2 = (orc_union16 *)ex->arrays[2];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+  ptr5 = (orc_union32 *)ex->arrays[5];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[1];
+    }
+    /* 2: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var38.i = _src.x2[0];
+    }
+    /* 3: loadl */
+    var34 = ptr5[i];
+    /* 4: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var39.i = _src.x2[1];
+    }
+    /* 5: avguw */
+    var36.i = ((orc_uint16)var38.i + (orc_uint16)var39.i + 1) >> 1;
+    /* 6: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var34.i;
+     var37.i = _src.x2[0];
+    }
+    /* 7: storew */
+    ptr0[i] = var35;
+    /* 8: storew */
+    ptr1[i] = var36;
+    /* 9: storew */
+    ptr2[i] = var37;
+  }
+
+}
+
+void
+bayerutils_orc_bin_gfirst (guint16 * ORC_RESTRICT d1, guint16 * ORC_RESTRICT d2, guint16 * ORC_RESTRICT d3, const guint32 * ORC_RESTRICT s1, const guint32 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_bin_gfirst");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_bin_gfirst);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_destination (p, 2, "d2");
+      orc_program_add_destination (p, 2, "d3");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_source (p, 4, "s2");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avguw", 0, ORC_VAR_D2, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_D3, ORC_VAR_S2, ORC_VAR_D1, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_D2] = d2;
+  ex->arrays[ORC_VAR_D3] = d3;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_pack_rgbx */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_pack_rgbx (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n){
+  int i;
+  orc_union32 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  const orc_union16 * ORC_RESTRICT ptr6;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_int8 var37;
+  orc_union32 var38;
+  orc_union16 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+  orc_int8 var42;
+  orc_union16 var43;
+  orc_union16 var44;
+
+  ptr0 = (orc_union32 *)d1;
+  ptr4 = (orc_union16 *)s1;
+  ptr5 = (orc_union16 *)s2;
+  ptr6 = (orc_union16 *)s3;
+
+  /* 0: loadpb */
+  var37 = 255;
+  /* 1: loadpw */
+  var36.i = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 2: loadw */
+    var33 = ptr4[i];
+    /* 3: shruw */
+    var39.i = ((orc_uint16)var33.i) >> var36.i;
+    /* 4: convuuswb */
+    var40 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 5: loadw */
+    var34 = ptr5[i];
+    /* 6: shruw */
+    var39.i = ((orc_uint16)var34.i) >> var36.i;
+    /* 7: convuuswb */
+    var41 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 8: loadw */
+    var35 = ptr6[i];
+    /* 9: shruw */
+    var39.i = ((orc_uint16)var35.i) >> var36.i;
+    /* 10: convuuswb */
+    var42 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 11: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var40;
+     _dest.x2[1] = var41;
+     var43.i = _dest.i;
+    }
+    /* 12: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var42;
+     _dest.x2[1] = var37;
+     var44.i = _dest.i;
+    }
+    /* 13: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var43.i;
+     _dest.x2[1] = var44.i;
+     var38.i = _dest.i;
+    }
+    /* 14: storel */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_pack_rgbx (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  const orc_union16 * ORC_RESTRICT ptr6;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_int8 var37;
+  orc_union32 var38;
+  orc_union16 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+  orc_int8 var42;
+  orc_union16 var43;
+  orc_union16 var44;
+
+  ptr0 = (orc_union32 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+  ptr5 = (orc_union16 *)ex->arrays[5];
+  ptr6 = (orc_union16 *)ex->arrays[6];
+
+  /* 0: loadpb */
+  var37 = 255;
+  /* 1: loadpw */
+  var36.i = ex->params[24];
+
+  for (i = 0; i < n; i++) {
+    /* 2: loadw */
+    var33 = ptr4[i];
+    /* 3: shruw */
+    var39.i = ((orc_uint16)var33.i) >> var36.i;
+    /* 4: convuuswb */
+    var40 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 5: loadw */
+    var34 = ptr5[i];
+    /* 6: shruw */
+    var39.i = ((orc_uint16)var34.i) >> var36.i;
+    /* 7: convuuswb */
+    var41 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 8: loadw */
+    var35 = ptr6[i];
+    /* 9: shruw */
+    var39.i = ((orc_uint16)var35.i) >> var36.i;
+    /* 10: convuuswb */
+    var42 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 11: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var40;
+     _dest.x2[1] = var41;
+     var43.i = _dest.i;
+    }
+    /* 12: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var42;
+     _dest.x2[1] = var37;
+     var44.i = _dest.i;
+    }
+    /* 13: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var43.i;
+     _dest.x2[1] = var44.i;
+     var38.i = _dest.i;
+    }
+    /* 14: storel */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+bayerutils_orc_pack_rgbx (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_pack_rgbx");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_pack_rgbx);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 1, 0x000000ff, "c1");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 1, "t2");
+      orc_program_add_temporary (p, 1, "t3");
+      orc_program_add_temporary (p, 1, "t4");
+      orc_program_add_temporary (p, 2, "t5");
+      orc_program_add_temporary (p, 2, "t6");
+
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T4, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_T5, ORC_VAR_T2, ORC_VAR_T3, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_T6, ORC_VAR_T4, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T5, ORC_VAR_T6, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+  ex->arrays[ORC_VAR_S3] = (void *)s3;
+  ex->params[ORC_VAR_P1] = p1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_pack_xrgb */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_pack_xrgb (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n){
+  int i;
+  orc_union32 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  const orc_union16 * ORC_RESTRICT ptr6;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_int8 var37;
+  orc_union32 var38;
+  orc_union16 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+  orc_int8 var42;
+  orc_union16 var43;
+  orc_union16 var44;
+
+  ptr0 = (orc_union32 *)d1;
+  ptr4 = (orc_union16 *)s1;
+  ptr5 = (orc_union16 *)s2;
+  ptr6 = (orc_union16 *)s3;
+
+  /* 0: loadpb */
+  var37 = 255;
+  /* 1: loadpw */
+  var36.i = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 2: loadw */
+    var33 = ptr4[i];
+    /* 3: shruw */
+    var39.i = ((orc_uint16)var33.i) >> var36.i;
+    /* 4: convuuswb */
+    var40 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 5: loadw */
+    var34 = ptr5[i];
+    /* 6: shruw */
+    var39.i = ((orc_uint16)var34.i) >> var36.i;
+    /* 7: convuuswb */
+    var41 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 8: loadw */
+    var35 = ptr6[i];
+    /* 9: shruw */
+    var39.i = ((orc_uint16)var35.i) >> var36.i;
+    /* 10: convuuswb */
+    var42 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 11: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var37;
+     _dest.x2[1] = var40;
+     var43.i = _dest.i;
+    }
+    /* 12: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var41;
+     _dest.x2[1] = var42;
+     var44.i = _dest.i;
+    }
+    /* 13: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var43.i;
+     _dest.x2[1] = var44.i;
+     var38.i = _dest.i;
+    }
+    /* 14: storel */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_pack_xrgb (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  const orc_union16 * ORC_RESTRICT ptr6;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_int8 var37;
+  orc_union32 var38;
+  orc_union16 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+  orc_int8 var42;
+  orc_union16 var43;
+  orc_union16 var44;
+
+  ptr0 = (orc_union32 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+  ptr5 = (orc_union16 *)ex->arrays[5];
+  ptr6 = (orc_union16 *)ex->arrays[6];
+
+  /* 0: loadpb */
+  var37 = 255;
+  /* 1: loadpw */
+  var36.i = ex->params[24];
+
+  for (i = 0; i < n; i++) {
+    /* 2: loadw */
+    var33 = ptr4[i];
+    /* 3: shruw */
+    var39.i = ((orc_uint16)var33.i) >> var36.i;
+    /* 4: convuuswb */
+    var40 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 5: loadw */
+    var34 = ptr5[i];
+    /* 6: shruw */
+    var39.i = ((orc_uint16)var34.i) >> var36.i;
+    /* 7: convuuswb */
+    var41 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 8: loadw */
+    var35 = ptr6[i];
+    /* 9: shruw */
+    var39.i = ((orc_uint16)var35.i) >> var36.i;
+    /* 10: convuuswb */
+    var42 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 11: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var37;
+     _dest.x2[1] = var40;
+     var43.i = _dest.i;
+    }
+    /* 12: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var41;
+     _dest.x2[1] = var42;
+     var44.i = _dest.i;
+    }
+    /* 13: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var43.i;
+     _dest.x2[1] = var44.i;
+     var38.i = _dest.i;
+    }
+    /* 14: storel */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+bayerutils_orc_pack_xrgb (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_pack_xrgb");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_pack_xrgb);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 1, 0x000000ff, "c1");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 1, "t2");
+      orc_program_add_temporary (p, 1, "t3");
+      orc_program_add_temporary (p, 1, "t4");
+      orc_program_add_temporary (p, 2, "t5");
+      orc_program_add_temporary (p, 2, "t6");
+
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T4, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_T5, ORC_VAR_C1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_T6, ORC_VAR_T3, ORC_VAR_T4, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T5, ORC_VAR_T6, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+  ex->arrays[ORC_VAR_S3] = (void *)s3;
+  ex->params[ORC_VAR_P1] = p1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_pack_argb64 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_pack_argb64 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n){
+  int i;
+  orc_union64 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  const orc_union16 * ORC_RESTRICT ptr6;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union64 var38;
+  orc_union16 var39;
+  orc_union16 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+
+  ptr0 = (orc_union64 *)d1;
+  ptr4 = (orc_union16 *)s1;
+  ptr5 = (orc_union16 *)s2;
+  ptr6 = (orc_union16 *)s3;
+
+  /* 0: loadpw */
+  var37.i = 65535;
+  /* 1: loadpw */
+  var36.i = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 2: loadw */
+    var33 = ptr4[i];
+    /* 3: shlw */
+    var39.i = ((orc_uint16)var33.i) << var36.i;
+    /* 4: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var37.i;
+     _dest.x2[1] = var39.i;
+     var41.i = _dest.i;
+    }
+    /* 5: loadw */
+    var34 = ptr5[i];
+    /* 6: shlw */
+    var39.i = ((orc_uint16)var34.i) << var36.i;
+    /* 7: loadw */
+    var35 = ptr6[i];
+    /* 8: shlw */
+    var40.i = ((orc_uint16)var35.i) << var36.i;
+    /* 9: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var39.i;
+     _dest.x2[1] = var40.i;
+     var42.i = _dest.i;
+    }
+    /* 10: mergelq */
+    {
+     orc_union64 _dest;
+     _dest.x2[0] = var41.i;
+     _dest.x2[1] = var42.i;
+     var38.i = _dest.i;
+    }
+    /* 11: storeq */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_pack_argb64 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  const orc_union16 * ORC_RESTRICT ptr6;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union64 var38;
+  orc_union16 var39;
+  orc_union16 var40;
+  orc_union32 var41;
+  orc_union32 var42;
+
+  ptr0 = (orc_union64 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+  ptr5 = (orc_union16 *)ex->arrays[5];
+  ptr6 = (orc_union16 *)ex->arrays[6];
+
+  /* 0: loadpw */
+  var37.i = 65535;
+  /* 1: loadpw */
+  var36.i = ex->params[24];
+
+  for (i = 0; i < n; i++) {
+    /* 2: loadw */
+    var33 = ptr4[i];
+    /* 3: shlw */
+    var39.i = ((orc_uint16)var33.i) << var36.i;
+    /* 4: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var37.i;
+     _dest.x2[1] = var39.i;
+     var41.i = _dest.i;
+    }
+    /* 5: loadw */
+    var34 = ptr5[i];
+    /* 6: shlw */
+    var39.i = ((orc_uint16)var34.i) << var36.i;
+    /* 7: loadw */
+    var35 = ptr6[i];
+    /* 8: shlw */
+    var40.i = ((orc_uint16)var35.i) << var36.i;
+    /* 9: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var39.i;
+     _dest.x2[1] = var40.i;
+     var42.i = _dest.i;
+    }
+    /* 10: mergelq */
+    {
+     orc_union64 _dest;
+     _dest.x2[0] = var41.i;
+     _dest.x2[1] = var42.i;
+     var38.i = _dest.i;
+    }
+    /* 11: storeq */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+bayerutils_orc_pack_argb64 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_pack_argb64");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_pack_argb64);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 2, 0x0000ffff, "c1");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+      orc_program_add_temporary (p, 4, "t4");
+
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_T1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T2, ORC_VAR_S3, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T4, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T3, ORC_VAR_T4, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+  ex->arrays[ORC_VAR_S3] = (void *)s3;
+  ex->params[ORC_VAR_P1] = p1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_avg_u8 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_avg_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2, int n){
+  int i;
+  orc_int8 * ORC_RESTRICT ptr0;
+  const orc_int8 * ORC_RESTRICT ptr4;
+  const orc_int8 * ORC_RESTRICT ptr5;
+  orc_int8 var33;
+  orc_int8 var34;
+  orc_int8 var35;
+
+  ptr0 = (orc_int8 *)d1;
+  ptr4 = (orc_int8 *)s1;
+  ptr5 = (orc_int8 *)s2;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var33 = ptr4[i];
+    /* 1: loadb */
+    var34 = ptr5[i];
+    /* 2: avgub */
+    var35 = ((orc_uint8)var33 + (orc_uint8)var34 + 1) >> 1;
+    /* 3: storeb */
+    ptr0[i] = var35;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_avg_u8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_int8 * ORC_RESTRICT ptr0;
+  const orc_int8 * ORC_RESTRICT ptr4;
+  const orc_int8 * ORC_RESTRICT ptr5;
+  orc_int8 var33;
+  orc_int8 var34;
+  orc_int8 var35;
+
+  ptr0 = (orc_int8 *)ex->arrays[0];
+  ptr4 = (orc_int8 *)ex->arrays[4];
+  ptr5 = (orc_int8 *)ex->arrays[5];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadb */
+    var33 = ptr4[i];
+    /* 1: loadb */
+    var34 = ptr5[i];
+    /* 2: avgub */
+    var35 = ((orc_uint8)var33 + (orc_uint8)var34 + 1) >> 1;
+    /* 3: storeb */
+    ptr0[i] = var35;
+  }
+
+}
+
+void
+bayerutils_orc_avg_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, const guint8 * ORC_RESTRICT s2, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_avg_u8");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_avg_u8);
+      orc_program_add_destination (p, 1, "d1");
+      orc_program_add_source (p, 1, "s1");
+      orc_program_add_source (p, 1, "s2");
+
+      orc_program_append_2 (p, "avgub", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_S2, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_hbin_avg_u8 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_hbin_avg_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_int8 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_int8 var34;
+  orc_int8 var35;
+  orc_int8 var36;
+
+  ptr0 = (orc_int8 *)d1;
+  ptr4 = (orc_union16 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var35 = _src.x2[0];
+    }
+    /* 2: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var36 = _src.x2[1];
+    }
+    /* 3: avgub */
+    var34 = ((orc_uint8)var35 + (orc_uint8)var36 + 1) >> 1;
+    /* 4: storeb */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_hbin_avg_u8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_int8 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_int8 var34;
+  orc_int8 var35;
+  orc_int8 var36;
+
+  ptr0 = (orc_int8 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var35 = _src.x2[0];
+    }
+    /* 2: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var36 = _src.x2[1];
+    }
+    /* 3: avgub */
+    var34 = ((orc_uint8)var35 + (orc_uint8)var36 + 1) >> 1;
+    /* 4: storeb */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_hbin_avg_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_hbin_avg_u8");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_hbin_avg_u8);
+      orc_program_add_destination (p, 1, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_temporary (p, 1, "t1");
+      orc_program_add_temporary (p, 1, "t2");
+
+      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avgub", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_hbin_avg_u16 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_hbin_avg_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_union32 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var36.i = _src.x2[1];
+    }
+    /* 3: avguw */
+    var34.i = ((orc_uint16)var35.i + (orc_uint16)var36.i + 1) >> 1;
+    /* 4: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_hbin_avg_u16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var36.i = _src.x2[1];
+    }
+    /* 3: avguw */
+    var34.i = ((orc_uint16)var35.i + (orc_uint16)var36.i + 1) >> 1;
+    /* 4: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_hbin_avg_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_hbin_avg_u16");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_hbin_avg_u16);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avguw", 0, ORC_VAR_D1, ORC_VAR_T1, ORC_VAR_T2, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_hbin_avg_pair_u8 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_hbin_avg_pair_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_int8 var37;
+  orc_int8 var38;
+  orc_int8 var39;
+  orc_int8 var40;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_union32 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var36.i = _src.x2[1];
+    }
+    /* 3: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var35.i;
+     var37 = _src.x2[0];
+    }
+    /* 4: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var36.i;
+     var38 = _src.x2[0];
+    }
+    /* 5: avgub */
+    var39 = ((orc_uint8)var37 + (orc_uint8)var38 + 1) >> 1;
+    /* 6: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var35.i;
+     var37 = _src.x2[1];
+    }
+    /* 7: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var36.i;
+     var38 = _src.x2[1];
+    }
+    /* 8: avgub */
+    var40 = ((orc_uint8)var37 + (orc_uint8)var38 + 1) >> 1;
+    /* 9: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var39;
+     _dest.x2[1] = var40;
+     var34.i = _dest.i;
+    }
+    /* 10: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_hbin_avg_pair_u8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_int8 var37;
+  orc_int8 var38;
+  orc_int8 var39;
+  orc_int8 var40;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[0];
+    }
+    /* 2: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var36.i = _src.x2[1];
+    }
+    /* 3: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var35.i;
+     var37 = _src.x2[0];
+    }
+    /* 4: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var36.i;
+     var38 = _src.x2[0];
+    }
+    /* 5: avgub */
+    var39 = ((orc_uint8)var37 + (orc_uint8)var38 + 1) >> 1;
+    /* 6: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var35.i;
+     var37 = _src.x2[1];
+    }
+    /* 7: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var36.i;
+     var38 = _src.x2[1];
+    }
+    /* 8: avgub */
+    var40 = ((orc_uint8)var37 + (orc_uint8)var38 + 1) >> 1;
+    /* 9: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var39;
+     _dest.x2[1] = var40;
+     var34.i = _dest.i;
+    }
+    /* 10: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_hbin_avg_pair_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_hbin_avg_pair_u8");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_hbin_avg_pair_u8);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 4, "s1");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 1, "t3");
+      orc_program_add_temporary (p, 1, "t4");
+      orc_program_add_temporary (p, 1, "t5");
+      orc_program_add_temporary (p, 1, "t6");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T4, ORC_VAR_T2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avgub", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_T4, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T4, ORC_VAR_T2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avgub", 0, ORC_VAR_T6, ORC_VAR_T3, ORC_VAR_T4, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_D1, ORC_VAR_T5, ORC_VAR_T6, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_hbin_avg_pair_u16 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_hbin_avg_pair_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_union32 * ORC_RESTRICT ptr0;
+  const orc_union64 * ORC_RESTRICT ptr4;
+  orc_union64 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union16 var40;
+
+  ptr0 = (orc_union32 *)d1;
+  ptr4 = (orc_union64 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var33 = ptr4[i];
+    /* 1: select0ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[0];
+    }
+    /* 2: select1ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var36.i = _src.x2[1];
+    }
+    /* 3: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var37.i = _src.x2[0];
+    }
+    /* 4: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var38.i = _src.x2[0];
+    }
+    /* 5: avguw */
+    var39.i = ((orc_uint16)var37.i + (orc_uint16)var38.i + 1) >> 1;
+    /* 6: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var37.i = _src.x2[1];
+    }
+    /* 7: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var38.i = _src.x2[1];
+    }
+    /* 8: avguw */
+    var40.i = ((orc_uint16)var37.i + (orc_uint16)var38.i + 1) >> 1;
+    /* 9: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var39.i;
+     _dest.x2[1] = var40.i;
+     var34.i = _dest.i;
+    }
+    /* 10: storel */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_hbin_avg_pair_u16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 * ORC_RESTRICT ptr0;
+  const orc_union64 * ORC_RESTRICT ptr4;
+  orc_union64 var33;
+  orc_union32 var34;
+  orc_union32 var35;
+  orc_union32 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union16 var40;
+
+  ptr0 = (orc_union32 *)ex->arrays[0];
+  ptr4 = (orc_union64 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var33 = ptr4[i];
+    /* 1: select0ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var35.i = _src.x2[0];
+    }
+    /* 2: select1ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var36.i = _src.x2[1];
+    }
+    /* 3: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var37.i = _src.x2[0];
+    }
+    /* 4: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var38.i = _src.x2[0];
+    }
+    /* 5: avguw */
+    var39.i = ((orc_uint16)var37.i + (orc_uint16)var38.i + 1) >> 1;
+    /* 6: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var35.i;
+     var37.i = _src.x2[1];
+    }
+    /* 7: select1lw */
+    {
+     orc_union32 _src;
+     _src.i = var36.i;
+     var38.i = _src.x2[1];
+    }
+    /* 8: avguw */
+    var40.i = ((orc_uint16)var37.i + (orc_uint16)var38.i + 1) >> 1;
+    /* 9: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var39.i;
+     _dest.x2[1] = var40.i;
+     var34.i = _dest.i;
+    }
+    /* 10: storel */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_hbin_avg_pair_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_hbin_avg_pair_u16");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_hbin_avg_pair_u16);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+      orc_program_add_temporary (p, 2, "t4");
+      orc_program_add_temporary (p, 2, "t5");
+      orc_program_add_temporary (p, 2, "t6");
+
+      orc_program_append_2 (p, "select0ql", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1ql", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_T4, ORC_VAR_T2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avguw", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_T4, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1lw", 0, ORC_VAR_T4, ORC_VAR_T2, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "avguw", 0, ORC_VAR_T6, ORC_VAR_T3, ORC_VAR_T4, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_D1, ORC_VAR_T5, ORC_VAR_T6, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_hbin_skip_u8 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_hbin_skip_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_int8 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_int8 var34;
+
+  ptr0 = (orc_int8 *)d1;
+  ptr4 = (orc_union16 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var34 = _src.x2[0];
+    }
+    /* 2: storeb */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_hbin_skip_u8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_int8 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_int8 var34;
+
+  ptr0 = (orc_int8 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadw */
+    var33 = ptr4[i];
+    /* 1: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var34 = _src.x2[0];
+    }
+    /* 2: storeb */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_hbin_skip_u8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_hbin_skip_u8");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_hbin_skip_u8);
+      orc_program_add_destination (p, 1, "d1");
+      orc_program_add_source (p, 2, "s1");
+
+      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_hbin_skip_u16 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_hbin_skip_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union16 var34;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_union32 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var34.i = _src.x2[0];
+    }
+    /* 2: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_hbin_skip_u16 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union32 * ORC_RESTRICT ptr4;
+  orc_union32 var33;
+  orc_union16 var34;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_union32 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadl */
+    var33 = ptr4[i];
+    /* 1: select0lw */
+    {
+     orc_union32 _src;
+     _src.i = var33.i;
+     var34.i = _src.x2[0];
+    }
+    /* 2: storew */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_hbin_skip_u16 (guint16 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_hbin_skip_u16");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_hbin_skip_u16);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 4, "s1");
+
+      orc_program_append_2 (p, "select0lw", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* bayerutils_orc_hbin_skip_u32 */
+#ifdef DISABLE_ORC
+void
+bayerutils_orc_hbin_skip_u32 (guint32 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int n){
+  int i;
+  orc_union32 * ORC_RESTRICT ptr0;
+  const orc_union64 * ORC_RESTRICT ptr4;
+  orc_union64 var33;
+  orc_union32 var34;
+
+  ptr0 = (orc_union32 *)d1;
+  ptr4 = (orc_union64 *)s1;
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var33 = ptr4[i];
+    /* 1: select0ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var34.i = _src.x2[0];
+    }
+    /* 2: storel */
+    ptr0[i] = var34;
+  }
+
+}
+
+#else
+static void
+_backup_bayerutils_orc_hbin_skip_u32 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union32 * ORC_RESTRICT ptr0;
+  const orc_union64 * ORC_RESTRICT ptr4;
+  orc_union64 var33;
+  orc_union32 var34;
+
+  ptr0 = (orc_union32 *)ex->arrays[0];
+  ptr4 = (orc_union64 *)ex->arrays[4];
+
+
+  for (i = 0; i < n; i++) {
+    /* 0: loadq */
+    var33 = ptr4[i];
+    /* 1: select0ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var34.i = _src.x2[0];
+    }
+    /* 2: storel */
+    ptr0[i] = var34;
+  }
+
+}
+
+void
+bayerutils_orc_hbin_skip_u32 (guint32 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "bayerutils_orc_hbin_skip_u32");
+      orc_program_set_backup_function (p, _backup_bayerutils_orc_hbin_skip_u32);
+      orc_program_add_destination (p, 4, "d1");
+      orc_program_add_source (p, 8, "s1");
+
+      orc_program_append_2 (p, "select0ql", 0, ORC_VAR_D1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
@@ -26,6 +26,11 @@
 *
 * Convert grayscale video from one bpp/depth combination to another.
 *
+* Planar input (I420, YV12, Y42B, Y444, GBR) is not copied: the output
+* buffer wraps the plane of the selected component, described by a video
+* meta when its stride differs from the default GRAY8 one. Subsampled
+* chroma planes are output at their own size.
+*
 * <refsect2>
 * <title>Example launch line</title>
 * |[
@@ -39,10 +44,11 @@
 #endif
 
 #include "gstextractcolor.h"
+#include "gstsplitcolor.h"
 
 #include <gst/video/video.h>
 
-#include "gstextractcolororc-dist.h"
+#include "gstextractcolororc.h"
 
 /* GstExtractColor signals and args */
 enum
@@ -62,6 +68,7 @@ enum
 
 #define RGB8_FORMATS "{ RGBx, BGRx, xRGB, xBGR, RGBA, BGRA, ARGB, ABGR, RGB, BGR }"
 #define RGB16_FORMATS "ARGB64"
+#define PLANAR_FORMATS "{ I420, YV12, Y42B, Y444, GBR }"
 
 /* the capabilities of the inputs and outputs */
 static GstStaticPadTemplate gst_extract_color_sink_template =
@@ -69,7 +76,8 @@ static GstStaticPadTemplate gst_extract_color_sink_template =
     GST_PAD_SINK,
     GST_PAD_ALWAYS,
     GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (RGB8_FORMATS) ";"
-        GST_VIDEO_CAPS_MAKE (RGB16_FORMATS))
+        GST_VIDEO_CAPS_MAKE (RGB16_FORMATS) ";"
+        GST_VIDEO_CAPS_MAKE (PLANAR_FORMATS))
     );
 
 static GstStaticPadTemplate gst_extract_color_src_template =
@@ -90,6 +98,9 @@ gst_extract_color_component_get_type (void)
     {GST_EXTRACT_COLOR_COMPONENT_RED, "extract red component", "red"},
     {GST_EXTRACT_COLOR_COMPONENT_GREEN, "extract green component", "green"},
     {GST_EXTRACT_COLOR_COMPONENT_BLUE, "extract blue component", "blue"},
+    {GST_EXTRACT_COLOR_COMPONENT_Y, "extract luma component", "y"},
+    {GST_EXTRACT_COLOR_COMPONENT_U, "extract U component", "u"},
+    {GST_EXTRACT_COLOR_COMPONENT_V, "extract V component", "v"},
     {0, NULL, NULL},
   };
 
@@ -111,6 +122,12 @@ static void gst_extract_color_dispose (GObject * object);
 /* GstBaseTransform vmethod declarations */
 static GstCaps *gst_extract_color_transform_caps (GstBaseTransform * trans,
     GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps);
+static gboolean gst_extract_color_decide_allocation (GstBaseTransform * trans,
+    GstQuery * query);
+static GstFlowReturn gst_extract_color_prepare_output_buffer (GstBaseTransform
+    * trans, GstBuffer * inbuf, GstBuffer ** outbuf);
+static GstFlowReturn gst_extract_color_transform (GstBaseTransform * trans,
+    GstBuffer * inbuf, GstBuffer * outbuf);
 
 /* GstVideoFilter vmethod declarations */
 static gboolean gst_extract_color_set_info (GstVideoFilter * filter,
@@ -121,6 +138,8 @@ static GstFlowReturn gst_extract_color_transform_frame (GstVideoFilter * filter,
 
 /* GstExtractColor method declarations */
 static void gst_extract_color_reset (GstExtractColor * filter);
+static gint gst_extract_color_get_comp (GstExtractColor * filt,
+    const GstVideoFormatInfo * finfo);
 
 /* setup debug */
 GST_DEBUG_CATEGORY_STATIC (extract_color_debug);
@@ -190,12 +209,18 @@ gst_extract_color_class_init (GstExtractColorClass * klass)
 
   gst_element_class_set_static_metadata (gstelement_class,
       "Extract color filter", "Filter/Effect/Video",
-      "Extracts single color component from RGB video",
+      "Extracts single color component from RGB or YUV video",
       "Joshua M. Doe <oss@nvl.army.mil>");
 
   /* Register GstBaseTransform vmethods */
   gstbasetransform_class->transform_caps =
       GST_DEBUG_FUNCPTR (gst_extract_color_transform_caps);
+  gstbasetransform_class->decide_allocation =
+      GST_DEBUG_FUNCPTR (gst_extract_color_decide_allocation);
+  gstbasetransform_class->prepare_output_buffer =
+      GST_DEBUG_FUNCPTR (gst_extract_color_prepare_output_buffer);
+  gstbasetransform_class->transform =
+      GST_DEBUG_FUNCPTR (gst_extract_color_transform);
 
   gstvideofilter_class->set_info =
       GST_DEBUG_FUNCPTR (gst_extract_color_set_info);
@@ -224,8 +249,15 @@ gst_extract_color_set_property (GObject * object, guint prop_id,
 
   switch (prop_id) {
     case PROP_COMPONENT:
-      filt->component = g_value_get_enum (value);
+    {
+      GstExtractColorComponent component = g_value_get_enum (value);
+      if (component != filt->component) {
+        filt->component = component;
+        /* chroma planes of subsampled formats have a different size */
+        gst_base_transform_reconfigure_src (GST_BASE_TRANSFORM (filt));
+      }
       break;
+    }
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -250,61 +282,226 @@ gst_extract_color_get_property (GObject * object, guint prop_id, GValue * value,
   }
 }
 
+/**
+ * gst_extract_color_get_comp:
+ * @filt: #GstExtractColor
+ * @finfo: format of the color input
+ *
+ * Returns: index of the selected component in @finfo, or -1 if the
+ * component does not exist in that format
+ */
+static gint
+gst_extract_color_get_comp (GstExtractColor * filt,
+    const GstVideoFormatInfo * finfo)
+{
+  switch (filt->component) {
+    case GST_EXTRACT_COLOR_COMPONENT_RED:
+    case GST_EXTRACT_COLOR_COMPONENT_GREEN:
+    case GST_EXTRACT_COLOR_COMPONENT_BLUE:
+      if (!GST_VIDEO_FORMAT_INFO_IS_RGB (finfo))
+        return -1;
+      return filt->component - GST_EXTRACT_COLOR_COMPONENT_RED;
+    case GST_EXTRACT_COLOR_COMPONENT_Y:
+    case GST_EXTRACT_COLOR_COMPONENT_U:
+    case GST_EXTRACT_COLOR_COMPONENT_V:
+      if (!GST_VIDEO_FORMAT_INFO_IS_YUV (finfo))
+        return -1;
+      return filt->component - GST_EXTRACT_COLOR_COMPONENT_Y;
+    default:
+      g_assert_not_reached ();
+      return -1;
+  }
+}
+
+/* convert width and height of @st between the full frame and the plane of
+ * component @comp, which is smaller for subsampled chroma */
+static void
+gst_extract_color_scale_size (GstStructure * st,
+    const GstVideoFormatInfo * finfo, gint comp, gboolean to_plane)
+{
+  const gchar *fields[2] = { "width", "height" };
+  const gint subs[2] = { GST_VIDEO_FORMAT_INFO_W_SUB (finfo, comp),
+    GST_VIDEO_FORMAT_INFO_H_SUB (finfo, comp)
+  };
+  gint i;
+
+  for (i = 0; i < 2; i++) {
+    const GValue *value = gst_structure_get_value (st, fields[i]);
+    gint64 min, max;
+
+    if (subs[i] == 0 || value == NULL)
+      continue;
+
+    if (G_VALUE_HOLDS_INT (value)) {
+      min = max = g_value_get_int (value);
+    } else if (GST_VALUE_HOLDS_INT_RANGE (value)) {
+      min = gst_value_get_int_range_min (value);
+      max = gst_value_get_int_range_max (value);
+    } else {
+      continue;
+    }
+
+    if (to_plane) {
+      min = GST_VIDEO_SUB_SCALE (subs[i], min);
+      max = GST_VIDEO_SUB_SCALE (subs[i], max);
+    } else {
+      /* every frame size whose plane rounds up to the given one */
+      min = MAX (((min - 1) << subs[i]) + 1, 1);
+      max = MIN (max << subs[i], G_MAXINT);
+    }
+
+    if (min == max)
+      gst_structure_set (st, fields[i], G_TYPE_INT, (gint) min, NULL);
+    else
+      gst_structure_set (st, fields[i], GST_TYPE_INT_RANGE, (gint) min,
+          (gint) max, NULL);
+  }
+}
+
+/* every color format whose selected component has the depth of @gray */
+static GstCaps *
+gst_extract_color_caps_from_gray (GstExtractColor * filt, GstCaps * gray)
+{
+  const gchar *gray_format;
+  GstCaps *color_caps, *formats_caps;
+  GValue formats = G_VALUE_INIT;
+  guint depth, i, n;
+
+  gray_format = gst_structure_get_string (gst_caps_get_structure (gray, 0),
+      "format");
+  depth = g_strcmp0 (gray_format, "GRAY8") == 0 ? 8 :
+      g_strcmp0 (gray_format, "GRAY16_LE") == 0 ? 16 : 0;
+
+  color_caps = gst_caps_new_empty ();
+  formats_caps = gst_caps_normalize (gst_static_pad_template_get_caps
+      (&gst_extract_color_sink_template));
+  g_value_init (&formats, GST_TYPE_LIST);
+
+  n = gst_caps_get_size (formats_caps);
+  for (i = 0; i < n; ++i) {
+    const GValue *format_value =
+        gst_structure_get_value (gst_caps_get_structure (formats_caps, i),
+        "format");
+    const GstVideoFormatInfo *finfo =
+        gst_video_format_get_info (gst_video_format_from_string
+        (g_value_get_string (format_value)));
+    gint comp = gst_extract_color_get_comp (filt, finfo);
+
+    if (comp < 0 || (depth != 0 &&
+            GST_VIDEO_FORMAT_INFO_DEPTH (finfo, comp) != depth))
+      continue;
+
+    if (GST_VIDEO_FORMAT_INFO_W_SUB (finfo, comp) ||
+        GST_VIDEO_FORMAT_INFO_H_SUB (finfo, comp)) {
+      GstCaps *c = gst_caps_copy (gray);
+      GstStructure *st = gst_caps_get_structure (c, 0);
+
+      gst_structure_set_value (st, "format", format_value);
+      gst_extract_color_scale_size (st, finfo, comp, FALSE);
+      color_caps = gst_caps_merge (color_caps, c);
+    } else {
+      gst_value_list_append_value (&formats, format_value);
+    }
+  }
+
+  /* formats whose component is full size share a single structure, ahead
+   * of the subsampled ones */
+  if (gst_value_list_get_size (&formats) > 0) {
+    GstCaps *c = gst_caps_copy (gray);
+
+    if (gst_value_list_get_size (&formats) == 1)
+      gst_structure_set_value (gst_caps_get_structure (c, 0), "format",
+          gst_value_list_get_value (&formats, 0));
+    else
+      gst_structure_set_value (gst_caps_get_structure (c, 0), "format",
+          &formats);
+    color_caps = gst_caps_merge (c, color_caps);
+  }
+
+  g_value_unset (&formats);
+  gst_caps_unref (formats_caps);
+
+  return color_caps;
+}
+
+/* the gray format matching the depth of the selected component of @color */
+static GstCaps *
+gst_extract_color_caps_to_gray (GstExtractColor * filt, GstCaps * color)
+{
+  GstStructure *st;
+  const gchar *color_format;
+  const GstVideoFormatInfo *finfo;
+  GstCaps *gray;
+  gint comp;
+
+  gray = gst_caps_copy (color);
+  st = gst_caps_get_structure (gray, 0);
+
+  color_format = gst_structure_get_string (st, "format");
+  if (color_format == NULL) {
+    GstCaps *tmpl =
+        gst_static_pad_template_get_caps (&gst_extract_color_src_template);
+    GstCaps *both = gst_caps_normalize (tmpl);
+    GValue formats = G_VALUE_INIT;
+    guint i;
+
+    g_value_init (&formats, GST_TYPE_LIST);
+    for (i = 0; i < gst_caps_get_size (both); ++i)
+      gst_value_list_append_value (&formats,
+          gst_structure_get_value (gst_caps_get_structure (both, i),
+              "format"));
+    gst_structure_set_value (st, "format", &formats);
+    g_value_unset (&formats);
+    gst_caps_unref (both);
+    return gray;
+  }
+
+  finfo = gst_video_format_get_info (gst_video_format_from_string
+      (color_format));
+  comp = finfo ? gst_extract_color_get_comp (filt, finfo) : -1;
+  if (comp < 0) {
+    gst_caps_unref (gray);
+    return gst_caps_new_empty ();
+  }
+
+  gst_structure_set (st, "format", G_TYPE_STRING,
+      GST_VIDEO_FORMAT_INFO_DEPTH (finfo, comp) > 8 ? "GRAY16_LE" : "GRAY8",
+      NULL);
+  gst_extract_color_scale_size (st, finfo, comp, TRUE);
+
+  return gray;
+}
+
 GstCaps *
 gst_extract_color_transform_caps (GstBaseTransform * trans,
     GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps)
 {
   GstExtractColor *filt = GST_EXTRACT_COLOR (trans);
   GstCaps *normalized_caps, *other_caps;
-  GstCaps *rgb8_caps, *rgb16_caps, *gray8_caps, *gray16_caps;
   guint i, n;
 
   GST_LOG_OBJECT (filt, "transforming caps from %" GST_PTR_FORMAT, caps);
 
   other_caps = gst_caps_new_empty ();
   normalized_caps = gst_caps_normalize (gst_caps_ref (caps));
-  gray8_caps = gst_caps_from_string (GST_VIDEO_CAPS_MAKE ("GRAY8"));
-  gray16_caps = gst_caps_from_string (GST_VIDEO_CAPS_MAKE ("GRAY16_LE"));
-  rgb8_caps = gst_caps_from_string (GST_VIDEO_CAPS_MAKE (RGB8_FORMATS));
-  rgb16_caps = gst_caps_from_string (GST_VIDEO_CAPS_MAKE (RGB16_FORMATS));
 
   n = gst_caps_get_size (normalized_caps);
   for (i = 0; i < n; ++i) {
     GstCaps *c = gst_caps_copy_nth (normalized_caps, i);
-    GstCaps *tgt_caps = NULL;
-    const GValue *format_value;
-    if (i > 0 && gst_caps_is_subset (other_caps, c))
-      continue;
 
     if (direction == GST_PAD_SRC) {
       /* we're on gray side, return color caps */
-      if (gst_caps_is_subset (c, gray8_caps)) {
-        tgt_caps = rgb8_caps;
-      } else {
-        tgt_caps = rgb16_caps;
-      }
+      other_caps = gst_caps_merge (other_caps,
+          gst_extract_color_caps_from_gray (filt, c));
     } else {
       /* we're on color side, return gray caps */
-      if (gst_caps_is_subset (c, rgb8_caps)) {
-        tgt_caps = gray8_caps;
-      } else {
-        tgt_caps = gray16_caps;
-      }
+      other_caps = gst_caps_merge (other_caps,
+          gst_extract_color_caps_to_gray (filt, c));
     }
 
-    format_value =
-        gst_structure_get_value (gst_caps_get_structure (tgt_caps, 0),
-        "format");
-    gst_structure_set_value (gst_caps_get_structure (c, 0), "format",
-        format_value);
-
-    gst_caps_merge (other_caps, c);
+    gst_caps_unref (c);
   }
 
-  gst_caps_unref (gray8_caps);
-  gst_caps_unref (gray16_caps);
-  gst_caps_unref (rgb8_caps);
-  gst_caps_unref (rgb16_caps);
   gst_caps_unref (normalized_caps);
 
   if (!gst_caps_is_empty (other_caps) && filter_caps) {
@@ -329,19 +526,159 @@ gst_extract_color_set_info (GstVideoFilter * filter, GstCaps * incaps,
   GST_DEBUG_OBJECT (filt,
       "set_caps: in %" GST_PTR_FORMAT " out %" GST_PTR_FORMAT, incaps, outcaps);
 
+  if (gst_extract_color_get_comp (filt, in_info->finfo) < 0) {
+    GST_ERROR_OBJECT (filt, "Selected component is not part of %s",
+        GST_VIDEO_INFO_NAME (in_info));
+    return FALSE;
+  }
+
   memcpy (&filt->info_in, in_info, sizeof (GstVideoInfo));
   memcpy (&filt->info_out, out_info, sizeof (GstVideoInfo));
 
+  filt->zero_copy = GST_VIDEO_INFO_N_PLANES (in_info) > 1;
+
   return res;
 }
 
+static gboolean
+gst_extract_color_decide_allocation (GstBaseTransform * trans,
+    GstQuery * query)
+{
+  GstExtractColor *filt = GST_EXTRACT_COLOR (trans);
+
+  /* needed to push planes whose stride is not the GRAY8 default */
+  filt->use_video_meta = gst_query_find_allocation_meta (query,
+      GST_VIDEO_META_API_TYPE, NULL);
+
+  return
+      GST_BASE_TRANSFORM_CLASS (gst_extract_color_parent_class)->
+      decide_allocation (trans, query);
+}
+
+/**
+ * gst_extract_color_prepare_output_buffer:
+ * @trans: #GstBaseTransform
+ * @inbuf: input buffer
+ * @outbuf: output buffer
+ *
+ * For planar input the output buffer shares the memory of the selected
+ * plane, so nothing is copied. Falls back to a newly allocated buffer
+ * when the plane cannot be described to downstream.
+ */
+static GstFlowReturn
+gst_extract_color_prepare_output_buffer (GstBaseTransform * trans,
+    GstBuffer * inbuf, GstBuffer ** outbuf)
+{
+  GstExtractColor *filt = GST_EXTRACT_COLOR (trans);
+  GstVideoInfo *info = &filt->info_in;
+  GstVideoMeta *meta;
+  gint comp, plane, stride, height;
+  gsize offset, size;
+
+  filt->shared_output = FALSE;
+
+  if (!filt->zero_copy)
+    goto allocate;
+
+  comp = gst_extract_color_get_comp (filt, info->finfo);
+  if (comp < 0)
+    goto allocate;
+
+  /* the component may have changed without renegotiating yet */
+  height = GST_VIDEO_INFO_COMP_HEIGHT (info, comp);
+  if (GST_VIDEO_INFO_COMP_WIDTH (info, comp) !=
+      GST_VIDEO_INFO_WIDTH (&filt->info_out) ||
+      height != GST_VIDEO_INFO_HEIGHT (&filt->info_out))
+    goto allocate;
+
+  plane = GST_VIDEO_INFO_COMP_PLANE (info, comp);
+  meta = gst_buffer_get_video_meta (inbuf);
+  if (meta) {
+    offset = meta->offset[plane];
+    stride = meta->stride[plane];
+  } else {
+    offset = GST_VIDEO_INFO_PLANE_OFFSET (info, plane);
+    stride = GST_VIDEO_INFO_PLANE_STRIDE (info, plane);
+  }
+  size = (gsize) stride * height;
+
+  if (stride <= 0 || offset + size > gst_buffer_get_size (inbuf))
+    goto allocate;
+  if (!filt->use_video_meta &&
+      stride != GST_VIDEO_INFO_PLANE_STRIDE (&filt->info_out, 0))
+    goto allocate;
+
+  *outbuf = gst_buffer_copy_region (inbuf, GST_BUFFER_COPY_MEMORY, offset,
+      size);
+  gst_buffer_copy_into (*outbuf, inbuf, GST_BUFFER_COPY_METADATA, 0, -1);
+
+  /* the copied video meta describes the planar input */
+  while ((meta = gst_buffer_get_video_meta (*outbuf)))
+    gst_buffer_remove_meta (*outbuf, GST_META_CAST (meta));
+
+  if (filt->use_video_meta) {
+    gsize offsets[GST_VIDEO_MAX_PLANES] = { 0, };
+    gint strides[GST_VIDEO_MAX_PLANES] = { stride, };
+
+    gst_buffer_add_video_meta_full (*outbuf, GST_VIDEO_FRAME_FLAG_NONE,
+        GST_VIDEO_INFO_FORMAT (&filt->info_out),
+        GST_VIDEO_INFO_WIDTH (&filt->info_out),
+        GST_VIDEO_INFO_HEIGHT (&filt->info_out), 1, offsets, strides);
+  }
+
+  GST_LOG_OBJECT (filt, "Wrapping plane %d (offset %" G_GSIZE_FORMAT
+      ", stride %d) without copy", plane, offset, stride);
+
+  filt->shared_output = TRUE;
+  return GST_FLOW_OK;
+
+allocate:
+  return
+      GST_BASE_TRANSFORM_CLASS (gst_extract_color_parent_class)->
+      prepare_output_buffer (trans, inbuf, outbuf);
+}
+
+static GstFlowReturn
+gst_extract_color_transform (GstBaseTransform * trans, GstBuffer * inbuf,
+    GstBuffer * outbuf)
+{
+  GstExtractColor *filt = GST_EXTRACT_COLOR (trans);
+
+  /* the output already is the component plane */
+  if (filt->shared_output) {
+    filt->shared_output = FALSE;
+    return GST_FLOW_OK;
+  }
+
+  return GST_BASE_TRANSFORM_CLASS (gst_extract_color_parent_class)->transform
+      (trans, inbuf, outbuf);
+}
+
+typedef void (*GstExtractColorCopy32Func) (guint8 * d1, int d1_stride,
+    const guint8 * s1, int s1_stride, int n, int m);
+typedef void (*GstExtractColorCopy64Func) (guint16 * d1, int d1_stride,
+    const guint16 * s1, int s1_stride, int n, int m);
+
+/* indexed by the offset of the component within the pixel, in bytes for
+ * 32-bit formats and in words for 64-bit ones */
+static const GstExtractColorCopy32Func copy32_funcs[4] = {
+  extractcolor_orc_copy32_0, extractcolor_orc_copy32_1,
+  extractcolor_orc_copy32_2, extractcolor_orc_copy32_3
+};
+
+static const GstExtractColorCopy64Func copy64_funcs[4] = {
+  extractcolor_orc_copy64_0, extractcolor_orc_copy64_1,
+  extractcolor_orc_copy64_2, extractcolor_orc_copy64_3
+};
+
 static GstFlowReturn
 gst_extract_color_transform_frame (GstVideoFilter * filter,
     GstVideoFrame * in_frame, GstVideoFrame * out_frame)
 {
   GstExtractColor *filt = GST_EXTRACT_COLOR (filter);
   GTimer *timer = NULL;
-  guint comp = filt->component;
+  gint comp, width, height, pstride, offset, in_stride, out_stride;
+  guint8 *src, *dst;
 
   GST_LOG_OBJECT (filt, "Performing non-inplace transform");
 
@@ -349,65 +686,63 @@ gst_extract_color_transform_frame (GstVideoFilter * filter,
   timer = g_timer_new ();
 #endif
 
-  if (GST_VIDEO_FRAME_COMP_DEPTH (in_frame, comp) == 8) {
-    guint8 *src, *dst;
-
-    src = GST_VIDEO_FRAME_PLANE_DATA (in_frame, 0);
-    dst = GST_VIDEO_FRAME_PLANE_DATA (out_frame, 0);
-
-    switch (GST_VIDEO_FRAME_COMP_OFFSET (in_frame, comp)) {
-      case 0:
-        extractcolor_orc_copy32_0 (dst, GST_VIDEO_FRAME_PLANE_STRIDE (out_frame,
-                0), src, GST_VIDEO_FRAME_PLANE_STRIDE (in_frame, 0),
-            GST_VIDEO_FRAME_WIDTH (in_frame),
-            GST_VIDEO_FRAME_HEIGHT (out_frame));
-        break;
-      case 1:
-        extractcolor_orc_copy32_1 (dst, GST_VIDEO_FRAME_PLANE_STRIDE (out_frame,
-                0), src, GST_VIDEO_FRAME_PLANE_STRIDE (in_frame, 0),
-            GST_VIDEO_FRAME_WIDTH (in_frame),
-            GST_VIDEO_FRAME_HEIGHT (out_frame));
-        break;
-      case 2:
-        extractcolor_orc_copy32_2 (dst, GST_VIDEO_FRAME_PLANE_STRIDE (out_frame,
-                0), src, GST_VIDEO_FRAME_PLANE_STRIDE (in_frame, 0),
-            GST_VIDEO_FRAME_WIDTH (in_frame),
-            GST_VIDEO_FRAME_HEIGHT (out_frame));
-        break;
-      case 3:
-        extractcolor_orc_copy32_3 (dst, GST_VIDEO_FRAME_PLANE_STRIDE (out_frame,
-                0), src, GST_VIDEO_FRAME_PLANE_STRIDE (in_frame, 0),
-            GST_VIDEO_FRAME_WIDTH (in_frame),
-            GST_VIDEO_FRAME_HEIGHT (out_frame));
-        break;
-      default:
-        g_assert_not_reached ();
-    }
-#if 0
-    gint x, y;
-    const guint pstride = GST_VIDEO_FRAME_COMP_PSTRIDE (in_frame, comp);
-    src = GST_VIDEO_FRAME_COMP_DATA (in_frame, comp);
-    dst = GST_VIDEO_FRAME_COMP_DATA (out_frame, 0);
-    for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, comp); y++) {
-      for (x = 0; x < GST_VIDEO_FRAME_COMP_WIDTH (in_frame, comp); x++) {
-        dst[x] = src[x * pstride];
+  comp = gst_extract_color_get_comp (filt, in_frame->info.finfo);
+  if (comp < 0) {
+    GST_ELEMENT_ERROR (filt, CORE, NEGOTIATION, (NULL),
+        ("Selected component is not part of %s",
+            GST_VIDEO_INFO_NAME (&in_frame->info)));
+    return GST_FLOW_NOT_NEGOTIATED;
+  }
+
+  /* the component may have changed without renegotiating yet */
+  width = MIN (GST_VIDEO_FRAME_COMP_WIDTH (in_frame, comp),
+      GST_VIDEO_FRAME_WIDTH (out_frame));
+  height = MIN (GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, comp),
+      GST_VIDEO_FRAME_HEIGHT (out_frame));
+  pstride = GST_VIDEO_FRAME_COMP_PSTRIDE (in_frame, comp);
+  offset = GST_VIDEO_FRAME_COMP_OFFSET (in_frame, comp);
+  src = GST_VIDEO_FRAME_PLANE_DATA (in_frame,
+      GST_VIDEO_FRAME_COMP_PLANE (in_frame, comp));
+  in_stride = GST_VIDEO_FRAME_COMP_STRIDE (in_frame, comp);
+  dst = GST_VIDEO_FRAME_PLANE_DATA (out_frame, 0);
+  out_stride = GST_VIDEO_FRAME_PLANE_STRIDE (out_frame, 0);
+
+  switch (pstride) {
+    case 8:
+      /* ARGB64 */
+      copy64_funcs[offset / 2] ((guint16 *) dst, out_stride,
+          (const guint16 *) src, in_stride, width, height);
+      break;
+    case 4:
+      copy32_funcs[offset] (dst, out_stride, src, in_stride, width, height);
+      break;
+    case 3:
+    {
+      /* ORC has no 24-bit loads */
+      gint x, y;
+      src += offset;
+      for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+          dst[x] = src[x * pstride];
+        }
+        src += in_stride;
+        dst += out_stride;
       }
-      src += GST_VIDEO_FRAME_COMP_STRIDE (in_frame, comp);
-      dst += GST_VIDEO_FRAME_COMP_STRIDE (out_frame, 0);
+      break;
     }
-#endif
-  } else {
-    gint x, y;
-    guint16 *src = (guint16 *) GST_VIDEO_FRAME_COMP_DATA (in_frame, comp);
-    guint16 *dst = (guint16 *) GST_VIDEO_FRAME_COMP_DATA (out_frame, 0);
-    const guint pstride = GST_VIDEO_FRAME_COMP_PSTRIDE (in_frame, comp) / 2;
-    for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, comp); y++) {
-      for (x = 0; x < GST_VIDEO_FRAME_COMP_WIDTH (in_frame, comp); x++) {
-        dst[x] = src[x * pstride];
+    case 1:
+    {
+      /* planar input that could not be pushed without copying */
+      gint y;
+      for (y = 0; y < height; y++) {
+        memcpy (dst, src, width);
+        src += in_stride;
+        dst += out_stride;
       }
-      src += GST_VIDEO_FRAME_COMP_STRIDE (in_frame, comp) / 2;
-      dst += GST_VIDEO_FRAME_COMP_STRIDE (out_frame, 0) / 2;
+      break;
     }
+    default:
+      g_assert_not_reached ();
   }
 
 #if 0
@@ -425,6 +760,9 @@ gst_extract_color_reset (GstExtractColor * extract_color)
 {
   gst_video_info_init (&extract_color->info_in);
   gst_video_info_init (&extract_color->info_out);
+  extract_color->zero_copy = FALSE;
+  extract_color->use_video_meta = FALSE;
+  extract_color->shared_output = FALSE;
 }
 
 /* Register filters that make up the gstgl plugin */
@@ -442,6 +780,13 @@ plugin_init (GstPlugin * plugin)
     return FALSE;
   }
 
+  GST_CAT_INFO (GST_CAT_DEFAULT, "registering splitcolor element");
+
+  if (!gst_element_register (plugin, "splitcolor", GST_RANK_NONE,
+          GST_TYPE_SPLIT_COLOR)) {
+    return FALSE;
+  }
+
   return TRUE;
 }
 
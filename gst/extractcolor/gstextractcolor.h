@@ -49,13 +49,19 @@ typedef struct _GstExtractColorClass GstExtractColorClass;
 * @GST_EXTRACT_COLOR_COMPONENT_RED: extract red component
 * @GST_EXTRACT_COLOR_COMPONENT_GREEN: extract green component
 * @GST_EXTRACT_COLOR_COMPONENT_BLUE: extract blue component
+* @GST_EXTRACT_COLOR_COMPONENT_Y: extract luma component of YUV input
+* @GST_EXTRACT_COLOR_COMPONENT_U: extract U component of YUV input
+* @GST_EXTRACT_COLOR_COMPONENT_V: extract V component of YUV input
 *
 * Component to extract.
 */
 typedef enum {
   GST_EXTRACT_COLOR_COMPONENT_RED,
   GST_EXTRACT_COLOR_COMPONENT_GREEN,
-  GST_EXTRACT_COLOR_COMPONENT_BLUE
+  GST_EXTRACT_COLOR_COMPONENT_BLUE,
+  GST_EXTRACT_COLOR_COMPONENT_Y,
+  GST_EXTRACT_COLOR_COMPONENT_U,
+  GST_EXTRACT_COLOR_COMPONENT_V
 } GstExtractColorComponent;
 
 /**
@@ -73,6 +79,11 @@ struct _GstExtractColor
   GstVideoInfo info_in;
   GstVideoInfo info_out;
 
+  /* planar input, the component plane can be pushed without copying */
+  gboolean zero_copy;
+  gboolean use_video_meta;
+  gboolean shared_output;
+
   /* properties */
   GstExtractColorComponent component;
 };
@@ -0,0 +1,750 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+* SECTION:element-splitcolor
+*
+* Split RGB video into one grayscale stream per color component, reading
+* each frame once. Request a src_%u pad for each component wanted, where
+* 0 is red, 1 is green, 2 is blue and 3 is alpha. All buffers pushed for a
+* frame carry its timestamps. ARGB64 input is split into GRAY16_LE, like
+* extractcolor produces, and each src pad starts its own stream in the upstream group.
+*
+* <refsect2>
+* <title>Example launch line</title>
+* |[
+* gst-launch-1.0 videotestsrc ! video/x-raw,format=BGRx ! splitcolor name=s
+*     s.src_0 ! queue ! autovideosink  s.src_2 ! queue ! autovideosink
+* ]|
+* </refsect2>
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#include "gstsplitcolor.h"
+
+#include "gstextractcolororc.h"
+
+#define RGB8_FORMATS "{ RGBx, BGRx, xRGB, xBGR, RGBA, BGRA, ARGB, ABGR, RGB, BGR }"
+#define RGB16_FORMATS "ARGB64"
+
+static GstStaticPadTemplate gst_split_color_sink_template =
+    GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (RGB8_FORMATS) ";"
+        GST_VIDEO_CAPS_MAKE (RGB16_FORMATS))
+    );
+
+static GstStaticPadTemplate gst_split_color_src_template =
+    GST_STATIC_PAD_TEMPLATE ("src_%u",
+    GST_PAD_SRC,
+    GST_PAD_REQUEST,
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("GRAY8") ";"
+        GST_VIDEO_CAPS_MAKE ("GRAY16_LE"))
+    );
+
+/* GObject vmethod declarations */
+static void gst_split_color_finalize (GObject * object);
+
+/* GstElement vmethod declarations */
+static GstPad *gst_split_color_request_new_pad (GstElement * element,
+    GstPadTemplate * templ, const gchar * name, const GstCaps * caps);
+static void gst_split_color_release_pad (GstElement * element, GstPad * pad);
+static GstStateChangeReturn gst_split_color_change_state (GstElement *
+    element, GstStateChange transition);
+
+/* pad function declarations */
+static GstFlowReturn gst_split_color_chain (GstPad * pad, GstObject * parent,
+    GstBuffer * buf);
+static gboolean gst_split_color_sink_event (GstPad * pad, GstObject * parent,
+    GstEvent * event);
+static gboolean gst_split_color_sink_query (GstPad * pad, GstObject * parent,
+    GstQuery * query);
+static gboolean gst_split_color_src_query (GstPad * pad, GstObject * parent,
+    GstQuery * query);
+
+/* setup debug */
+GST_DEBUG_CATEGORY_STATIC (split_color_debug);
+#define GST_CAT_DEFAULT split_color_debug
+
+G_DEFINE_TYPE (GstSplitColor, gst_split_color, GST_TYPE_ELEMENT);
+
+/************************************************************************/
+/* GObject vmethod implementations                                      */
+/************************************************************************/
+
+static void
+gst_split_color_finalize (GObject * object)
+{
+  GstSplitColor *split = GST_SPLIT_COLOR (object);
+
+  gst_caps_replace (&split->caps_out, NULL);
+  g_free (split->scratch);
+#if GST_CHECK_VERSION(1,4,0)
+  gst_flow_combiner_free (split->flow_combiner);
+#endif
+
+  G_OBJECT_CLASS (gst_split_color_parent_class)->finalize (object);
+}
+
+static void
+gst_split_color_class_init (GstSplitColorClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *gstelement_class = GST_ELEMENT_CLASS (klass);
+
+  GST_DEBUG_CATEGORY_INIT (split_color_debug, "splitcolor", 0,
+      "Split color filter");
+
+  gobject_class->finalize = GST_DEBUG_FUNCPTR (gst_split_color_finalize);
+
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&gst_split_color_sink_template));
+  gst_element_class_add_pad_template (gstelement_class,
+      gst_static_pad_template_get (&gst_split_color_src_template));
+
+  gst_element_class_set_static_metadata (gstelement_class,
+      "Split color filter", "Filter/Effect/Video",
+      "Splits RGB video into one grayscale stream per color component",
+      "Joshua M. Doe <oss@nvl.army.mil>");
+
+  gstelement_class->request_new_pad =
+      GST_DEBUG_FUNCPTR (gst_split_color_request_new_pad);
+  gstelement_class->release_pad =
+      GST_DEBUG_FUNCPTR (gst_split_color_release_pad);
+  gstelement_class->change_state =
+      GST_DEBUG_FUNCPTR (gst_split_color_change_state);
+}
+
+static void
+gst_split_color_init (GstSplitColor * split)
+{
+  split->sinkpad =
+      gst_pad_new_from_static_template (&gst_split_color_sink_template,
+      "sink");
+  gst_pad_set_chain_function (split->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_split_color_chain));
+  gst_pad_set_event_function (split->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_split_color_sink_event));
+  gst_pad_set_query_function (split->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_split_color_sink_query));
+  gst_element_add_pad (GST_ELEMENT (split), split->sinkpad);
+
+  gst_video_info_init (&split->info_in);
+  gst_video_info_init (&split->info_out);
+
+#if GST_CHECK_VERSION(1,4,0)
+  split->flow_combiner = gst_flow_combiner_new ();
+#endif
+}
+
+/************************************************************************/
+/* GstElement vmethod implementations                                   */
+/************************************************************************/
+
+typedef struct
+{
+  GstSplitColor *split;
+  GstPad *pad;
+  GstCaps *caps;
+} StickyData;
+
+/* a stream-start for one src pad, with a stream-id derived from the pad
+ * name so that every component is a distinct stream of the same group */
+static GstEvent *
+gst_split_color_stream_start (GstSplitColor * split, GstPad * srcpad,
+    GstEvent * event)
+{
+  GstEvent *pad_event;
+  GstStreamFlags flags;
+  gchar *stream_id;
+  guint group_id;
+
+  stream_id = gst_pad_create_stream_id (srcpad, GST_ELEMENT (split),
+      GST_PAD_NAME (srcpad));
+  pad_event = gst_event_new_stream_start (stream_id);
+  g_free (stream_id);
+  if (gst_event_parse_group_id (event, &group_id))
+    gst_event_set_group_id (pad_event, group_id);
+  gst_event_parse_stream_flags (event, &flags);
+  gst_event_set_stream_flags (pad_event, flags);
+
+  return pad_event;
+}
+
+/* copy the sticky events of the sink pad to a new src pad, replacing the
+ * stream-start and caps with the ones of the component */
+static gboolean
+gst_split_color_copy_sticky (GstPad * pad, GstEvent ** event,
+    gpointer user_data)
+{
+  StickyData *data = user_data;
+
+  if (GST_EVENT_TYPE (*event) == GST_EVENT_STREAM_START) {
+    GstEvent *start_event = gst_split_color_stream_start (data->split,
+        data->pad, *event);
+    gst_pad_store_sticky_event (data->pad, start_event);
+    gst_event_unref (start_event);
+  } else if (GST_EVENT_TYPE (*event) == GST_EVENT_CAPS) {
+    if (data->caps) {
+      GstEvent *caps_event = gst_event_new_caps (data->caps);
+      gst_pad_store_sticky_event (data->pad, caps_event);
+      gst_event_unref (caps_event);
+    }
+  } else {
+    gst_pad_store_sticky_event (data->pad, *event);
+  }
+
+  return TRUE;
+}
+
+static GstPad *
+gst_split_color_request_new_pad (GstElement * element, GstPadTemplate * templ,
+    const gchar * name, const GstCaps * caps)
+{
+  GstSplitColor *split = GST_SPLIT_COLOR (element);
+  GstPad *pad;
+  StickyData data;
+  guint comp;
+  gchar *pad_name;
+
+  if (name == NULL || sscanf (name, "src_%u", &comp) != 1 ||
+      comp >= GST_SPLIT_COLOR_MAX_COMPONENTS) {
+    GST_WARNING_OBJECT (split, "Pad name must be src_0 to src_%d, not %s",
+        GST_SPLIT_COLOR_MAX_COMPONENTS - 1, GST_STR_NULL (name));
+    return NULL;
+  }
+
+  GST_OBJECT_LOCK (split);
+  if (split->srcpads[comp] != NULL) {
+    GST_OBJECT_UNLOCK (split);
+    GST_WARNING_OBJECT (split, "Component %u was already requested", comp);
+    return NULL;
+  }
+  /* a component the negotiated input lacks would never be fed */
+  if (split->caps_out != NULL &&
+      comp >= GST_VIDEO_INFO_N_COMPONENTS (&split->info_in)) {
+    GST_OBJECT_UNLOCK (split);
+    GST_WARNING_OBJECT (split, "Component %u is not in the negotiated %s",
+        comp, GST_VIDEO_INFO_NAME (&split->info_in));
+    return NULL;
+  }
+  data.caps = split->caps_out ? gst_caps_ref (split->caps_out) : NULL;
+  GST_OBJECT_UNLOCK (split);
+
+  pad_name = g_strdup_printf ("src_%u", comp);
+  pad = gst_pad_new_from_template (templ, pad_name);
+  g_free (pad_name);
+  gst_pad_set_query_function (pad,
+      GST_DEBUG_FUNCPTR (gst_split_color_src_query));
+
+  /* join a running stream, the events are sent before the first buffer */
+  if (gst_pad_is_active (split->sinkpad))
+    gst_pad_set_active (pad, TRUE);
+  data.split = split;
+  data.pad = pad;
+  gst_pad_sticky_events_foreach (split->sinkpad, gst_split_color_copy_sticky,
+      &data);
+  if (data.caps)
+    gst_caps_unref (data.caps);
+
+  GST_OBJECT_LOCK (split);
+  if (split->srcpads[comp] != NULL) {
+    GST_OBJECT_UNLOCK (split);
+    GST_WARNING_OBJECT (split, "Component %u was already requested", comp);
+    gst_object_unref (pad);
+    return NULL;
+  }
+  split->srcpads[comp] = pad;
+#if GST_CHECK_VERSION(1,4,0)
+  gst_flow_combiner_add_pad (split->flow_combiner, pad);
+#endif
+  GST_OBJECT_UNLOCK (split);
+
+  GST_DEBUG_OBJECT (split, "Adding pad for component %u", comp);
+
+  gst_element_add_pad (element, pad);
+
+  return pad;
+}
+
+static void
+gst_split_color_release_pad (GstElement * element, GstPad * pad)
+{
+  GstSplitColor *split = GST_SPLIT_COLOR (element);
+  gint i;
+
+  GST_OBJECT_LOCK (split);
+  for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+    if (split->srcpads[i] == pad)
+      split->srcpads[i] = NULL;
+  }
+#if GST_CHECK_VERSION(1,4,0)
+  gst_flow_combiner_remove_pad (split->flow_combiner, pad);
+#endif
+  GST_OBJECT_UNLOCK (split);
+
+  gst_pad_set_active (pad, FALSE);
+  gst_element_remove_pad (element, pad);
+}
+
+static GstStateChangeReturn
+gst_split_color_change_state (GstElement * element, GstStateChange transition)
+{
+  GstSplitColor *split = GST_SPLIT_COLOR (element);
+  GstStateChangeReturn ret;
+
+  ret = GST_ELEMENT_CLASS (gst_split_color_parent_class)->change_state
+      (element, transition);
+
+  if (transition == GST_STATE_CHANGE_PAUSED_TO_READY) {
+    GST_OBJECT_LOCK (split);
+    gst_caps_replace (&split->caps_out, NULL);
+    GST_OBJECT_UNLOCK (split);
+    gst_video_info_init (&split->info_in);
+    gst_video_info_init (&split->info_out);
+  }
+
+  return ret;
+}
+
+/************************************************************************/
+/* pad function implementations                                         */
+/************************************************************************/
+
+static gboolean
+gst_split_color_set_caps (GstSplitColor * split, GstCaps * caps)
+{
+  GstVideoInfo info_in, info_out;
+  GstVideoFormat format_out;
+  GstCaps *caps_out;
+  gboolean res = TRUE;
+  gint i;
+
+  if (!gst_video_info_from_caps (&info_in, caps)) {
+    GST_ERROR_OBJECT (split, "Invalid caps %" GST_PTR_FORMAT, caps);
+    return FALSE;
+  }
+
+  /* GRAY16_LE on every host, the same as extractcolor */
+  if (GST_VIDEO_INFO_COMP_DEPTH (&info_in, 0) == 8)
+    format_out = GST_VIDEO_FORMAT_GRAY8;
+  else
+    format_out = GST_VIDEO_FORMAT_GRAY16_LE;
+  gst_video_info_set_format (&info_out, format_out,
+      GST_VIDEO_INFO_WIDTH (&info_in), GST_VIDEO_INFO_HEIGHT (&info_in));
+  info_out.fps_n = info_in.fps_n;
+  info_out.fps_d = info_in.fps_d;
+  info_out.par_n = info_in.par_n;
+  info_out.par_d = info_in.par_d;
+  caps_out = gst_video_info_to_caps (&info_out);
+
+  GST_DEBUG_OBJECT (split, "Output caps %" GST_PTR_FORMAT, caps_out);
+
+  GST_OBJECT_LOCK (split);
+  if (split->srcpads[GST_VIDEO_COMP_A] != NULL &&
+      !GST_VIDEO_INFO_HAS_ALPHA (&info_in)) {
+    GST_OBJECT_UNLOCK (split);
+    GST_ELEMENT_ERROR (split, CORE, NEGOTIATION, (NULL),
+        ("Alpha was requested but %s has no alpha component",
+            GST_VIDEO_INFO_NAME (&info_in)));
+    gst_caps_unref (caps_out);
+    return FALSE;
+  }
+  split->info_in = info_in;
+  split->info_out = info_out;
+  gst_caps_replace (&split->caps_out, caps_out);
+  GST_OBJECT_UNLOCK (split);
+
+  /* one scratch row per interleaved component, as wide as the pixel */
+  if (split->scratch_size < GST_VIDEO_INFO_WIDTH (&info_in) *
+      GST_VIDEO_INFO_COMP_PSTRIDE (&info_in, 0)) {
+    g_free (split->scratch);
+    split->scratch_size = GST_VIDEO_INFO_WIDTH (&info_in) *
+        GST_VIDEO_INFO_COMP_PSTRIDE (&info_in, 0);
+    split->scratch = g_malloc (split->scratch_size);
+  }
+
+  for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+    GstPad *pad;
+
+    GST_OBJECT_LOCK (split);
+    pad = split->srcpads[i] ? gst_object_ref (split->srcpads[i]) : NULL;
+    GST_OBJECT_UNLOCK (split);
+
+    if (pad) {
+      res &= gst_pad_push_event (pad, gst_event_new_caps (caps_out));
+      gst_object_unref (pad);
+    }
+  }
+
+  gst_caps_unref (caps_out);
+
+  return res;
+}
+
+static gboolean
+gst_split_color_start_streams (GstSplitColor * split, GstEvent * event)
+{
+  gboolean res = TRUE;
+  gint i;
+
+  for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+    GstPad *pad;
+
+    GST_OBJECT_LOCK (split);
+    pad = split->srcpads[i] ? gst_object_ref (split->srcpads[i]) : NULL;
+    GST_OBJECT_UNLOCK (split);
+
+    if (pad) {
+      res &= gst_pad_push_event (pad,
+          gst_split_color_stream_start (split, pad, event));
+      gst_object_unref (pad);
+    }
+  }
+
+  return res;
+}
+
+static gboolean
+gst_split_color_sink_event (GstPad * pad, GstObject * parent,
+    GstEvent * event)
+{
+  GstSplitColor *split = GST_SPLIT_COLOR (parent);
+  gboolean res;
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_STREAM_START:
+      res = gst_split_color_start_streams (split, event);
+      gst_event_unref (event);
+      return res;
+    case GST_EVENT_CAPS:{
+      GstCaps *caps;
+
+      gst_event_parse_caps (event, &caps);
+      res = gst_split_color_set_caps (split, caps);
+      gst_event_unref (event);
+      return res;
+    }
+#if GST_CHECK_VERSION(1,6,0)
+    case GST_EVENT_FLUSH_STOP:
+      GST_OBJECT_LOCK (split);
+      gst_flow_combiner_reset (split->flow_combiner);
+      GST_OBJECT_UNLOCK (split);
+      break;
+#endif
+    default:
+      break;
+  }
+
+  return gst_pad_event_default (pad, parent, event);
+}
+
+static gboolean
+gst_split_color_sink_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CAPS:{
+      GstCaps *filter, *caps;
+
+      gst_query_parse_caps (query, &filter);
+      caps = gst_pad_get_pad_template_caps (pad);
+      if (filter) {
+        GstCaps *tmp = gst_caps_intersect_full (filter, caps,
+            GST_CAPS_INTERSECT_FIRST);
+        gst_caps_unref (caps);
+        caps = tmp;
+      }
+      gst_query_set_caps_result (query, caps);
+      gst_caps_unref (caps);
+      return TRUE;
+    }
+    case GST_QUERY_ALLOCATION:
+      /* the output buffers are allocated here, nothing to propose */
+      return FALSE;
+    default:
+      return gst_pad_query_default (pad, parent, query);
+  }
+}
+
+static gboolean
+gst_split_color_src_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  GstSplitColor *split = GST_SPLIT_COLOR (parent);
+
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CAPS:{
+      GstCaps *filter, *caps;
+
+      gst_query_parse_caps (query, &filter);
+      GST_OBJECT_LOCK (split);
+      caps = split->caps_out ? gst_caps_ref (split->caps_out) :
+          gst_pad_get_pad_template_caps (pad);
+      GST_OBJECT_UNLOCK (split);
+      if (filter) {
+        GstCaps *tmp = gst_caps_intersect_full (filter, caps,
+            GST_CAPS_INTERSECT_FIRST);
+        gst_caps_unref (caps);
+        caps = tmp;
+      }
+      gst_query_set_caps_result (query, caps);
+      gst_caps_unref (caps);
+      return TRUE;
+    }
+    default:
+      return gst_pad_query_default (pad, parent, query);
+  }
+}
+
+/**
+ * gst_split_color_split:
+ * @split: #GstSplitColor
+ * @in_frame: input frame
+ * @dst: first row of each component plane, NULL if not requested
+ * @dst_stride: stride of each component plane
+ *
+ * De-interleave the requested components of a frame in a single pass.
+ * 32-bit and ARGB64 formats go through one ORC kernel writing every
+ * component of each pixel, with the unrequested ones sent to a scratch row.
+ */
+static void
+gst_split_color_split (GstSplitColor * split, GstVideoFrame * in_frame,
+    guint8 * dst[GST_SPLIT_COLOR_MAX_COMPONENTS],
+    gint dst_stride[GST_SPLIT_COLOR_MAX_COMPONENTS])
+{
+  const gint width = GST_VIDEO_FRAME_WIDTH (in_frame);
+  const gint height = GST_VIDEO_FRAME_HEIGHT (in_frame);
+  const gint n_comps = GST_VIDEO_FRAME_N_COMPONENTS (in_frame);
+  const gint pstride = GST_VIDEO_FRAME_COMP_PSTRIDE (in_frame, 0);
+  const gint in_stride = GST_VIDEO_FRAME_PLANE_STRIDE (in_frame, 0);
+  guint8 *src = GST_VIDEO_FRAME_PLANE_DATA (in_frame, 0);
+  gint c, x, y;
+
+  if (GST_VIDEO_FRAME_COMP_DEPTH (in_frame, 0) == 8 && pstride == 4) {
+    guint8 *d[4];
+    gint s[4];
+
+    /* each unused byte gets its own scratch row, rewritten on every line */
+    for (c = 0; c < 4; c++) {
+      d[c] = split->scratch + c * width;
+      s[c] = 0;
+    }
+    for (c = 0; c < n_comps; c++) {
+      if (dst[c] != NULL) {
+        gint offset = GST_VIDEO_FRAME_COMP_OFFSET (in_frame, c);
+        d[offset] = dst[c];
+        s[offset] = dst_stride[c];
+      }
+    }
+
+    extractcolor_orc_split32 (d[0], s[0], d[1], s[1], d[2], s[2], d[3], s[3],
+        src, in_stride, width, height);
+  } else if (GST_VIDEO_FRAME_COMP_DEPTH (in_frame, 0) == 8) {
+    /* 24-bit RGB/BGR */
+    for (y = 0; y < height; y++) {
+      const guint8 *row = src + y * in_stride;
+      for (c = 0; c < n_comps; c++) {
+        const guint8 *p;
+        guint8 *out;
+
+        if (dst[c] == NULL)
+          continue;
+        p = row + GST_VIDEO_FRAME_COMP_OFFSET (in_frame, c);
+        out = dst[c] + y * dst_stride[c];
+        for (x = 0; x < width; x++)
+          out[x] = p[x * pstride];
+      }
+    }
+  } else {
+    /* ARGB64 */
+    guint16 *d[4];
+    gint s[4];
+
+    for (c = 0; c < 4; c++) {
+      d[c] = (guint16 *) split->scratch + c * width;
+      s[c] = 0;
+    }
+    for (c = 0; c < n_comps; c++) {
+      if (dst[c] != NULL) {
+        gint offset = GST_VIDEO_FRAME_COMP_OFFSET (in_frame, c) / 2;
+        d[offset] = (guint16 *) dst[c];
+        s[offset] = dst_stride[c];
+      }
+    }
+
+    extractcolor_orc_split64 (d[0], s[0], d[1], s[1], d[2], s[2], d[3], s[3],
+        (const guint16 *) src, in_stride, width, height);
+
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+    /* ARGB64 words are in host order, the output is GRAY16_LE */
+    for (c = 0; c < n_comps; c++) {
+      if (dst[c] == NULL)
+        continue;
+      for (y = 0; y < height; y++) {
+        guint16 *out = (guint16 *) (dst[c] + y * dst_stride[c]);
+        for (x = 0; x < width; x++)
+          out[x] = GUINT16_TO_LE (out[x]);
+      }
+    }
+#endif
+  }
+}
+
+#if !GST_CHECK_VERSION(1,4,0)
+/* GStreamer 1.2 has no GstFlowCombiner, so only the pads pushed to for this
+ * buffer are combined */
+static GstFlowReturn
+gst_split_color_combine_flows (GstFlowReturn * rets, gint n)
+{
+  gboolean all_not_linked = TRUE, all_eos = TRUE;
+  gint i;
+
+  for (i = 0; i < n; i++) {
+    if (rets[i] == GST_FLOW_FLUSHING || rets[i] <= GST_FLOW_NOT_NEGOTIATED)
+      return rets[i];
+    if (rets[i] != GST_FLOW_NOT_LINKED)
+      all_not_linked = FALSE;
+    if (rets[i] != GST_FLOW_EOS)
+      all_eos = FALSE;
+  }
+
+  if (all_not_linked)
+    return GST_FLOW_NOT_LINKED;
+  if (all_eos)
+    return GST_FLOW_EOS;
+  return GST_FLOW_OK;
+}
+#endif
+
+static GstFlowReturn
+gst_split_color_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
+{
+  GstSplitColor *split = GST_SPLIT_COLOR (parent);
+  GstPad *srcpads[GST_SPLIT_COLOR_MAX_COMPONENTS];
+  GstBuffer *outbufs[GST_SPLIT_COLOR_MAX_COMPONENTS];
+  GstMapInfo outmaps[GST_SPLIT_COLOR_MAX_COMPONENTS];
+  guint8 *dst[GST_SPLIT_COLOR_MAX_COMPONENTS];
+  gint dst_stride[GST_SPLIT_COLOR_MAX_COMPONENTS];
+  GstFlowReturn rets[GST_SPLIT_COLOR_MAX_COMPONENTS];
+  GstFlowReturn ret = GST_FLOW_OK;
+  GstVideoFrame in_frame;
+  gint i, n_pushed;
+
+  if (GST_VIDEO_INFO_FORMAT (&split->info_in) == GST_VIDEO_FORMAT_UNKNOWN) {
+    GST_ELEMENT_ERROR (split, CORE, NEGOTIATION, (NULL),
+        ("No caps received before the first buffer"));
+    gst_buffer_unref (buf);
+    return GST_FLOW_NOT_NEGOTIATED;
+  }
+
+  GST_OBJECT_LOCK (split);
+  for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+    srcpads[i] = split->srcpads[i] ? gst_object_ref (split->srcpads[i]) : NULL;
+  }
+  GST_OBJECT_UNLOCK (split);
+
+  if (!gst_video_frame_map (&in_frame, &split->info_in, buf, GST_MAP_READ)) {
+    GST_ELEMENT_ERROR (split, STREAM, FAILED, ("Failed to map buffer"),
+        (NULL));
+    for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+      if (srcpads[i])
+        gst_object_unref (srcpads[i]);
+    }
+    gst_buffer_unref (buf);
+    return GST_FLOW_ERROR;
+  }
+
+  for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+    outbufs[i] = NULL;
+    dst[i] = NULL;
+    dst_stride[i] = 0;
+  }
+
+  for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+    if (srcpads[i] == NULL || i >= GST_VIDEO_FRAME_N_COMPONENTS (&in_frame))
+      continue;
+
+    outbufs[i] =
+        gst_buffer_new_allocate (NULL, GST_VIDEO_INFO_SIZE (&split->info_out),
+        NULL);
+    gst_buffer_copy_into (outbufs[i], buf,
+        GST_BUFFER_COPY_FLAGS | GST_BUFFER_COPY_TIMESTAMPS, 0, -1);
+    if (!gst_buffer_map (outbufs[i], &outmaps[i], GST_MAP_WRITE)) {
+      gst_buffer_unref (outbufs[i]);
+      outbufs[i] = NULL;
+      goto map_failed;
+    }
+    dst[i] = outmaps[i].data;
+    dst_stride[i] = GST_VIDEO_INFO_PLANE_STRIDE (&split->info_out, 0);
+  }
+
+  gst_split_color_split (split, &in_frame, dst, dst_stride);
+
+  gst_video_frame_unmap (&in_frame);
+  gst_buffer_unref (buf);
+
+  n_pushed = 0;
+  for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+    if (outbufs[i] != NULL) {
+      gst_buffer_unmap (outbufs[i], &outmaps[i]);
+      rets[n_pushed] = gst_pad_push (srcpads[i], outbufs[i]);
+#if GST_CHECK_VERSION(1,4,0)
+      /* keeps the last flow of every pad, so a pad that went NOT_LINKED
+       * earlier still counts while the others are pushed to */
+      GST_OBJECT_LOCK (split);
+      ret = gst_flow_combiner_update_pad_flow (split->flow_combiner,
+          srcpads[i], rets[n_pushed]);
+      GST_OBJECT_UNLOCK (split);
+#endif
+      n_pushed++;
+    }
+    if (srcpads[i])
+      gst_object_unref (srcpads[i]);
+  }
+
+  if (n_pushed == 0) {
+    GST_DEBUG_OBJECT (split, "No src pads requested, dropping buffer");
+    return GST_FLOW_NOT_LINKED;
+  }
+
+#if !GST_CHECK_VERSION(1,4,0)
+  ret = gst_split_color_combine_flows (rets, n_pushed);
+#endif
+  return ret;
+
+map_failed:
+  GST_ELEMENT_ERROR (split, STREAM, FAILED, ("Failed to map output buffer"),
+      (NULL));
+  for (i = 0; i < GST_SPLIT_COLOR_MAX_COMPONENTS; i++) {
+    if (outbufs[i] != NULL) {
+      gst_buffer_unmap (outbufs[i], &outmaps[i]);
+      gst_buffer_unref (outbufs[i]);
+    }
+    if (srcpads[i])
+      gst_object_unref (srcpads[i]);
+  }
+  gst_video_frame_unmap (&in_frame);
+  gst_buffer_unref (buf);
+  return GST_FLOW_ERROR;
+}
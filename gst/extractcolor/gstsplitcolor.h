@@ -0,0 +1,87 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef __GST_SPLIT_COLOR_H__
+#define __GST_SPLIT_COLOR_H__
+
+#include <gst/gst.h>
+#include <gst/video/video.h>
+#if GST_CHECK_VERSION(1,4,0)
+#include <gst/base/gstflowcombiner.h>
+#endif
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_SPLIT_COLOR \
+  (gst_split_color_get_type())
+#define GST_SPLIT_COLOR(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_SPLIT_COLOR,GstSplitColor))
+#define GST_SPLIT_COLOR_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_SPLIT_COLOR,GstSplitColorClass))
+#define GST_IS_SPLIT_COLOR(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_SPLIT_COLOR))
+#define GST_IS_SPLIT_COLOR_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_SPLIT_COLOR))
+
+/* red, green, blue and alpha, in GstVideoFormatInfo component order */
+#define GST_SPLIT_COLOR_MAX_COMPONENTS 4
+
+typedef struct _GstSplitColor GstSplitColor;
+typedef struct _GstSplitColorClass GstSplitColorClass;
+
+/**
+* GstSplitColor:
+* @element: the parent element.
+*
+*
+* The opaque GstSplitColor data structure.
+*/
+struct _GstSplitColor
+{
+  GstElement element;
+
+  GstPad *sinkpad;
+  /* request pads, indexed by component, protected by the object lock */
+  GstPad *srcpads[GST_SPLIT_COLOR_MAX_COMPONENTS];
+
+  /* format */
+  GstVideoInfo info_in;
+  GstVideoInfo info_out;
+  GstCaps *caps_out;
+
+  /* destination for the components nobody requested */
+  guint8 *scratch;
+  gsize scratch_size;
+
+#if GST_CHECK_VERSION(1,4,0)
+  /* last flow of every src pad, protected by the object lock */
+  GstFlowCombiner *flow_combiner;
+#endif
+};
+
+struct _GstSplitColorClass
+{
+  GstElementClass parent_class;
+};
+
+GType gst_split_color_get_type(void);
+
+G_END_DECLS
+
+#endif /* __GST_SPLIT_COLOR_H__ */
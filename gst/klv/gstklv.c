@@ -23,8 +23,10 @@
 
 #include <gst/gst.h>
 
+#include "gstklvdemux.h"
 #include "gstklvinject.h"
 #include "gstklvinspect.h"
+#include "gstklvmux.h"
 
 static gboolean
 plugin_init (GstPlugin * plugin)
@@ -32,7 +34,14 @@ plugin_init (GstPlugin * plugin)
   return gst_element_register (plugin, "klvinspect", GST_RANK_NONE,
       GST_TYPE_KLVINSPECT)
       && gst_element_register (plugin, "klvinject", GST_RANK_NONE,
-      GST_TYPE_KLVINJECT);
+      GST_TYPE_KLVINJECT)
+      && gst_element_register (plugin, "klvdemux", GST_RANK_NONE,
+      GST_TYPE_KLVDEMUX)
+#if GST_CHECK_VERSION(1,14,0)
+      && gst_element_register (plugin, "klvmux", GST_RANK_NONE,
+      GST_TYPE_KLVMUX)
+#endif
+      ;
 }
 
 GST_PLUGIN_DEFINE (GST_VERSION_MAJOR,
@@ -0,0 +1,407 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+/**
+ * SECTION:element-gstklvdemux
+ *
+ * The klvdemux element takes the #GstKLVMeta off passing video buffers and
+ * pushes it as a separate meta/x-klv stream, one buffer per video buffer
+ * carrying KLV with the same timestamps, e.g. to feed mpegtsmux. Video
+ * buffers without KLV produce a gap event on the KLV stream. The video
+ * passes through without copying its memory.
+ *
+ * <refsect2>
+ * <title>Example launch line</title>
+ * |[
+ * gst-launch-1.0 videotestsrc ! klvinject ! klvdemux name=d \
+ *   d.video ! queue ! x264enc ! mpegtsmux name=m ! filesink location=out.ts \
+ *   d.klv ! queue ! m.
+ * ]|
+ * </refsect2>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <gst/gst.h>
+#include "gstklvdemux.h"
+#include "klv.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_klvdemux_debug_category);
+#define GST_CAT_DEFAULT gst_klvdemux_debug_category
+
+/* prototypes */
+static void gst_klvdemux_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_klvdemux_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+
+static GstFlowReturn gst_klvdemux_chain (GstPad * pad, GstObject * parent,
+    GstBuffer * buf);
+static gboolean gst_klvdemux_sink_event (GstPad * pad, GstObject * parent,
+    GstEvent * event);
+static gboolean gst_klvdemux_sink_query (GstPad * pad, GstObject * parent,
+    GstQuery * query);
+static gboolean gst_klvdemux_video_src_query (GstPad * pad,
+    GstObject * parent, GstQuery * query);
+static gboolean gst_klvdemux_klv_src_query (GstPad * pad, GstObject * parent,
+    GstQuery * query);
+
+enum
+{
+  PROP_0,
+  PROP_STRIP
+};
+
+#define DEFAULT_PROP_STRIP TRUE
+
+/* pad templates */
+
+#define KLV_CAPS "meta/x-klv, parsed = (boolean) true"
+
+static GstStaticPadTemplate gst_klvdemux_sink_template =
+GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("ANY"));
+
+static GstStaticPadTemplate gst_klvdemux_video_src_template =
+GST_STATIC_PAD_TEMPLATE ("video",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("ANY"));
+
+static GstStaticPadTemplate gst_klvdemux_klv_src_template =
+GST_STATIC_PAD_TEMPLATE ("klv",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS (KLV_CAPS));
+
+/* class initialization */
+
+G_DEFINE_TYPE_WITH_CODE (GstKlvDemux, gst_klvdemux, GST_TYPE_ELEMENT,
+    GST_DEBUG_CATEGORY_INIT (gst_klvdemux_debug_category, "klvdemux", 0,
+        "debug category for klvdemux element"));
+
+static void
+gst_klvdemux_finalize (GObject * object)
+{
+  GstKlvDemux *demux = GST_KLVDEMUX (object);
+
+  gst_flow_combiner_free (demux->flow_combiner);
+
+  G_OBJECT_CLASS (gst_klvdemux_parent_class)->finalize (object);
+}
+
+static void
+gst_klvdemux_class_init (GstKlvDemuxClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+
+  gobject_class->set_property = gst_klvdemux_set_property;
+  gobject_class->get_property = gst_klvdemux_get_property;
+  gobject_class->finalize = gst_klvdemux_finalize;
+
+  g_object_class_install_property (gobject_class, PROP_STRIP,
+      g_param_spec_boolean ("strip", "Strip",
+          "Remove the KLV meta from the video buffers",
+          DEFAULT_PROP_STRIP, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&gst_klvdemux_sink_template));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&gst_klvdemux_video_src_template));
+  gst_element_class_add_pad_template (element_class,
+      gst_static_pad_template_get (&gst_klvdemux_klv_src_template));
+
+  gst_element_class_set_static_metadata (element_class,
+      "KLV demuxer", "Demuxer",
+      "Push the KLV metadata of video buffers as a separate stream",
+      "Joshua M. Doe <oss@nvl.army.mil>");
+}
+
+static void
+gst_klvdemux_init (GstKlvDemux * demux)
+{
+  demux->sinkpad =
+      gst_pad_new_from_static_template (&gst_klvdemux_sink_template, "sink");
+  gst_pad_set_chain_function (demux->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_klvdemux_chain));
+  gst_pad_set_event_function (demux->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_klvdemux_sink_event));
+  gst_pad_set_query_function (demux->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_klvdemux_sink_query));
+  gst_element_add_pad (GST_ELEMENT (demux), demux->sinkpad);
+
+  demux->video_srcpad =
+      gst_pad_new_from_static_template (&gst_klvdemux_video_src_template,
+      "video");
+  gst_pad_set_query_function (demux->video_srcpad,
+      GST_DEBUG_FUNCPTR (gst_klvdemux_video_src_query));
+  gst_element_add_pad (GST_ELEMENT (demux), demux->video_srcpad);
+
+  demux->klv_srcpad =
+      gst_pad_new_from_static_template (&gst_klvdemux_klv_src_template,
+      "klv");
+  gst_pad_set_query_function (demux->klv_srcpad,
+      GST_DEBUG_FUNCPTR (gst_klvdemux_klv_src_query));
+  gst_element_add_pad (GST_ELEMENT (demux), demux->klv_srcpad);
+
+  demux->flow_combiner = gst_flow_combiner_new ();
+  gst_flow_combiner_add_pad (demux->flow_combiner, demux->video_srcpad);
+  gst_flow_combiner_add_pad (demux->flow_combiner, demux->klv_srcpad);
+
+  demux->strip = DEFAULT_PROP_STRIP;
+}
+
+static void
+gst_klvdemux_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstKlvDemux *demux = GST_KLVDEMUX (object);
+
+  GST_OBJECT_LOCK (demux);
+  switch (prop_id) {
+    case PROP_STRIP:
+      demux->strip = g_value_get_boolean (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+  GST_OBJECT_UNLOCK (demux);
+}
+
+static void
+gst_klvdemux_get_property (GObject * object, guint prop_id, GValue * value,
+    GParamSpec * pspec)
+{
+  GstKlvDemux *demux = GST_KLVDEMUX (object);
+
+  GST_OBJECT_LOCK (demux);
+  switch (prop_id) {
+    case PROP_STRIP:
+      g_value_set_boolean (value, demux->strip);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+  GST_OBJECT_UNLOCK (demux);
+}
+
+/* the KLV stream gets its own stream id and the fixed KLV caps, the video
+ * stream gets the upstream events as they are */
+static gboolean
+gst_klvdemux_start_klv_stream (GstKlvDemux * demux, GstEvent * event)
+{
+  GstEvent *klv_event;
+  GstCaps *caps;
+  gchar *stream_id;
+  guint group_id;
+  gboolean res;
+
+  stream_id = gst_pad_create_stream_id (demux->klv_srcpad,
+      GST_ELEMENT (demux), "klv");
+  klv_event = gst_event_new_stream_start (stream_id);
+  g_free (stream_id);
+  if (gst_event_parse_group_id (event, &group_id))
+    gst_event_set_group_id (klv_event, group_id);
+  gst_event_set_stream_flags (klv_event, GST_STREAM_FLAG_SPARSE);
+  res = gst_pad_push_event (demux->klv_srcpad, klv_event);
+
+  caps = gst_caps_from_string (KLV_CAPS);
+  res &= gst_pad_push_event (demux->klv_srcpad, gst_event_new_caps (caps));
+  gst_caps_unref (caps);
+
+  return res;
+}
+
+static gboolean
+gst_klvdemux_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
+{
+  GstKlvDemux *demux = GST_KLVDEMUX (parent);
+  gboolean res;
+
+  switch (GST_EVENT_TYPE (event)) {
+    case GST_EVENT_STREAM_START:
+      res = gst_klvdemux_start_klv_stream (demux, event);
+      res &= gst_pad_push_event (demux->video_srcpad, event);
+      return res;
+    case GST_EVENT_CAPS:
+      return gst_pad_push_event (demux->video_srcpad, event);
+    case GST_EVENT_FLUSH_STOP:
+      gst_flow_combiner_reset (demux->flow_combiner);
+      return gst_pad_event_default (pad, parent, event);
+    default:
+      return gst_pad_event_default (pad, parent, event);
+  }
+}
+
+static gboolean
+gst_klvdemux_sink_query (GstPad * pad, GstObject * parent, GstQuery * query)
+{
+  GstKlvDemux *demux = GST_KLVDEMUX (parent);
+
+  /* video passes straight through, so let downstream answer */
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CAPS:
+    case GST_QUERY_ACCEPT_CAPS:
+    case GST_QUERY_ALLOCATION:
+      return gst_pad_peer_query (demux->video_srcpad, query);
+    default:
+      return gst_pad_query_default (pad, parent, query);
+  }
+}
+
+static gboolean
+gst_klvdemux_video_src_query (GstPad * pad, GstObject * parent,
+    GstQuery * query)
+{
+  GstKlvDemux *demux = GST_KLVDEMUX (parent);
+
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CAPS:
+    case GST_QUERY_ACCEPT_CAPS:
+      return gst_pad_peer_query (demux->sinkpad, query);
+    default:
+      return gst_pad_query_default (pad, parent, query);
+  }
+}
+
+static gboolean
+gst_klvdemux_klv_src_query (GstPad * pad, GstObject * parent,
+    GstQuery * query)
+{
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CAPS:{
+      GstCaps *filter, *caps;
+
+      gst_query_parse_caps (query, &filter);
+      caps = gst_pad_get_pad_template_caps (pad);
+      if (filter) {
+        GstCaps *tmp = gst_caps_intersect_full (filter, caps,
+            GST_CAPS_INTERSECT_FIRST);
+        gst_caps_unref (caps);
+        caps = tmp;
+      }
+      gst_query_set_caps_result (query, caps);
+      gst_caps_unref (caps);
+      return TRUE;
+    }
+    default:
+      return gst_pad_query_default (pad, parent, query);
+  }
+}
+
+static gboolean
+gst_klvdemux_remove_meta (GstBuffer * buf, GstMeta ** meta, gpointer user_data)
+{
+  if ((*meta)->info->api == GST_KLV_META_API_TYPE)
+    *meta = NULL;
+
+  return TRUE;
+}
+
+/* concatenates the KLV meta of @buf into one buffer, NULL if it has none
+ * or it cannot be written */
+static GstBuffer *
+gst_klvdemux_collect (GstKlvDemux * demux, GstBuffer * buf)
+{
+  GstKLVMeta *klv_meta;
+  GstBuffer *klv_buf;
+  GstMapInfo map;
+  gpointer iter = NULL;
+  const guint8 *data;
+  gsize size, total = 0, offset = 0;
+
+  while ((klv_meta = (GstKLVMeta *) gst_buffer_iterate_meta_filtered (buf,
+              &iter, GST_KLV_META_API_TYPE))) {
+    if (gst_klv_meta_get_data (klv_meta, &size))
+      total += size;
+  }
+
+  if (total == 0)
+    return NULL;
+
+  klv_buf = gst_buffer_new_allocate (NULL, total, NULL);
+  gst_buffer_copy_into (klv_buf, buf, GST_BUFFER_COPY_TIMESTAMPS, 0, -1);
+  if (!gst_buffer_map (klv_buf, &map, GST_MAP_WRITE)) {
+    GST_WARNING_OBJECT (demux, "Failed to map KLV buffer, dropping KLV");
+    gst_buffer_unref (klv_buf);
+    return NULL;
+  }
+
+  iter = NULL;
+  while ((klv_meta = (GstKLVMeta *) gst_buffer_iterate_meta_filtered (buf,
+              &iter, GST_KLV_META_API_TYPE))) {
+    data = gst_klv_meta_get_data (klv_meta, &size);
+    if (data) {
+      memcpy (map.data + offset, data, size);
+      offset += size;
+    }
+  }
+
+  gst_buffer_unmap (klv_buf, &map);
+
+  return klv_buf;
+}
+
+static GstFlowReturn
+gst_klvdemux_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
+{
+  GstKlvDemux *demux = GST_KLVDEMUX (parent);
+  GstBuffer *klv_buf;
+  GstFlowReturn ret;
+  gboolean strip;
+
+  GST_OBJECT_LOCK (demux);
+  strip = demux->strip;
+  GST_OBJECT_UNLOCK (demux);
+
+  klv_buf = gst_klvdemux_collect (demux, buf);
+
+  if (klv_buf) {
+    GST_LOG_OBJECT (demux, "Pushing %" G_GSIZE_FORMAT " bytes of KLV at %"
+        GST_TIME_FORMAT, gst_buffer_get_size (klv_buf),
+        GST_TIME_ARGS (GST_BUFFER_PTS (klv_buf)));
+
+    /* only the buffer struct is copied, the video memory is shared */
+    if (strip) {
+      buf = gst_buffer_make_writable (buf);
+      gst_buffer_foreach_meta (buf, gst_klvdemux_remove_meta, NULL);
+    }
+
+    ret = gst_pad_push (demux->klv_srcpad, klv_buf);
+    gst_flow_combiner_update_pad_flow (demux->flow_combiner,
+        demux->klv_srcpad, ret);
+  } else if (GST_BUFFER_PTS_IS_VALID (buf)) {
+    /* let downstream muxers know the sparse stream has no data here */
+    gst_pad_push_event (demux->klv_srcpad,
+        gst_event_new_gap (GST_BUFFER_PTS (buf), GST_BUFFER_DURATION (buf)));
+  }
+
+  /* without KLV the combiner uses the last flow of the KLV pad */
+  ret = gst_pad_push (demux->video_srcpad, buf);
+
+  return gst_flow_combiner_update_pad_flow (demux->flow_combiner,
+      demux->video_srcpad, ret);
+}
@@ -0,0 +1,60 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef _GST_KLVDEMUX_H_
+#define _GST_KLVDEMUX_H_
+
+#include <gst/gst.h>
+#include <gst/base/gstflowcombiner.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_KLVDEMUX   (gst_klvdemux_get_type())
+#define GST_KLVDEMUX(obj)   (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_KLVDEMUX,GstKlvDemux))
+#define GST_KLVDEMUX_CLASS(klass)   (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_KLVDEMUX,GstKlvDemuxClass))
+#define GST_IS_KLVDEMUX(obj)   (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_KLVDEMUX))
+#define GST_IS_KLVDEMUX_CLASS(obj)   (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_KLVDEMUX))
+
+typedef struct _GstKlvDemux GstKlvDemux;
+typedef struct _GstKlvDemuxClass GstKlvDemuxClass;
+
+struct _GstKlvDemux
+{
+  GstElement element;
+
+  GstPad *sinkpad;
+  GstPad *video_srcpad;
+  GstPad *klv_srcpad;
+
+  /* last flow of both src pads, only used by the streaming thread */
+  GstFlowCombiner *flow_combiner;
+
+  /* properties */
+  gboolean strip;
+};
+
+struct _GstKlvDemuxClass
+{
+  GstElementClass parent_class;
+};
+
+GType gst_klvdemux_get_type (void);
+
+G_END_DECLS
+
+#endif /* _GST_KLVDEMUX_H_ */
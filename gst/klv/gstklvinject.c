@@ -36,7 +36,6 @@
 
 #include <gst/gst.h>
 #include <gst/base/gstbasetransform.h>
-#include <gst/base/gstbytewriter.h>
 #include "gstklvinject.h"
 #include "klv.h"
 
@@ -44,6 +43,7 @@ GST_DEBUG_CATEGORY_STATIC (gst_klvinject_debug_category);
 #define GST_CAT_DEFAULT gst_klvinject_debug_category
 
 /* prototypes */
+static void gst_klvinject_finalize (GObject * object);
 static GstFlowReturn gst_klvinject_transform_ip (GstBaseTransform * trans,
     GstBuffer * buf);
 
@@ -67,9 +67,12 @@ G_DEFINE_TYPE_WITH_CODE (GstKlvInject, gst_klvinject, GST_TYPE_BASE_TRANSFORM,
 static void
 gst_klvinject_class_init (GstKlvInjectClass * klass)
 {
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
   GstBaseTransformClass *base_transform_class =
       GST_BASE_TRANSFORM_CLASS (klass);
 
+  gobject_class->finalize = gst_klvinject_finalize;
+
   /* Setting up pads and setting metadata should be moved to
      base_class_init if you intend to subclass this class. */
   gst_element_class_add_pad_template (GST_ELEMENT_CLASS (klass),
@@ -90,14 +93,53 @@ gst_klvinject_class_init (GstKlvInjectClass * klass)
   base_transform_class->transform_ip_on_passthrough = TRUE;
 }
 
+/* UAS Datalink LS version the test set is labelled with */
+#define KLVINJECT_UAS_VERSION 17
+
 static void
 gst_klvinject_init (GstKlvInject * filt)
 {
+/* Test KLV meta, here: Motion Imagery Standards Board (MISB) Engineering
+ * Guideline MISB EG 0902 - MISB Minimum Metadata Set, in a MISB ST 0601
+ * UAS Datalink local set. Also see: SMPTE S336M for KLV specification,
+ * also ITU-R BT.1563-1.
+ *
+ * The set is laid out once; per buffer only the timestamp is updated. */
+  const guint8 key[GST_KLV_KEY_SIZE] = GST_KLV_UAS_LOCAL_SET_KEY;
+  GstKLVLocalSetBuilder *builder = &filt->builder;
+
+  gst_klv_local_set_builder_init (builder, key);
+
+  /* the timestamp has to be the first item */
+  gst_klv_local_set_builder_put_uint (builder,
+      GST_KLV_UAS_TAG_PRECISION_TIME_STAMP, 0, 8);
+
+  gst_klv_local_set_builder_put_data (builder,
+      GST_KLV_UAS_TAG_IMAGE_COORDINATE_SYSTEM, (guint8 *) "Geodetic WGS84", 14);
+
+  gst_klv_local_set_builder_put_int (builder, GST_KLV_UAS_TAG_SENSOR_LATITUDE,
+      gst_klv_scale_int (51.449825, 90.0, 4), 4);
+
+  gst_klv_local_set_builder_put_int (builder, GST_KLV_UAS_TAG_SENSOR_LONGITUDE,
+      gst_klv_scale_int (-2.600439, 180.0, 4), 4);
+
+  /* elevation, -900..19000 meters */
+  gst_klv_local_set_builder_put_uint (builder,
+      GST_KLV_UAS_TAG_SENSOR_TRUE_ALTITUDE,
+      gst_klv_scale_uint (10.0, -900.0, 19000.0, 2), 2);
+
+  gst_klv_local_set_builder_put_uint (builder, GST_KLV_UAS_TAG_VERSION,
+      KLVINJECT_UAS_VERSION, 1);
 }
 
 static void
-gst_klvinject_dispose (GstKlvInject * filt)
+gst_klvinject_finalize (GObject * object)
 {
+  GstKlvInject *filt = GST_KLVINJECT (object);
+
+  gst_klv_local_set_builder_clear (&filt->builder);
+
+  G_OBJECT_CLASS (gst_klvinject_parent_class)->finalize (object);
 }
 
 static GstStaticCaps unix_reference = GST_STATIC_CAPS ("timestamp/x-unix");
@@ -105,15 +147,10 @@ static GstStaticCaps unix_reference = GST_STATIC_CAPS ("timestamp/x-unix");
 static void
 gst_klvinject_add_test_meta (GstKlvInject * filt, GstBuffer * buf)
 {
-/* Add KLV meta for testing, here: Motion Imagery Standards Board (MISB)
- * Engineering Guideline MISB EG 0902 - MISB Minimum Metadata Set.
- * Also see: SMPTE S336M for KLV specification, also ITU-R BT.1563-1 */
-  const guint8 klv_header[16] = { 0x06, 0x0e, 0x2b, 0x34, 0x02, 0x0b, 0x01,
-    0x01, 0x0e, 0x01, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00
-  };
-  GstByteWriter bw;
   /* NOTE: MISB defines MISP time, which is NOT UTC, but use UTC for now */
   gint64 utc_us = -1;
+  const guint8 *klv_data;
+  gsize klv_size;
 
 #if GST_CHECK_VERSION(1,14,0)
   GstReferenceTimestampMeta *time_meta;
@@ -126,67 +163,15 @@ gst_klvinject_add_test_meta (GstKlvInject * filt, GstBuffer * buf)
 #endif
 
   if (utc_us == -1) {
-    GDateTime *dt = g_date_time_new_now_utc ();
-    utc_us = g_date_time_to_unix (dt) * 1000000;        /* microseconds */
-    utc_us += g_date_time_get_microsecond (dt);
-    g_date_time_unref (dt);
+    utc_us = g_get_real_time ();        /* microseconds */
   }
 
-  gst_byte_writer_init (&bw);
-
-  /* KLV header */
-  gst_byte_writer_put_data (&bw, klv_header, 16);
-
-  /* Total length in BER long form (verbatim as long as <= 127) */
-  gst_byte_writer_put_uint8 (&bw,
-      (1 + 1 + 8) + (1 + 1 + 14) + (1 + 1 + 4) + (1 + 1 + 4) + (1 + 1 + 2));
-
-  /* Tag 1: unix timestamp */
-  gst_byte_writer_put_uint8 (&bw, 2);   /* local tag: unix timestamp    */
-  gst_byte_writer_put_uint8 (&bw, 8);   /* data length (BER short form) */
-  gst_byte_writer_put_uint64_be (&bw, utc_us);
-
-  /* Tag 2: Image Coordinate System */
-  gst_byte_writer_put_uint8 (&bw, 12);  /* local tag: unix timestamp    */
-  gst_byte_writer_put_uint8 (&bw, 14);  /* data length (BER short form) */
-  gst_byte_writer_put_data (&bw, (guint8 *) "Geodetic WGS84", 14);
-
-  /* Tag 3: Sensor Latitude */
-  gst_byte_writer_put_uint8 (&bw, 13);  /* local tag: latitude */
-  gst_byte_writer_put_uint8 (&bw, 4);   /* data length (BER short form) */
-  {
-    /* Map -(2^31-1)..(2^31-1) to +/-90 with 0x80000000 = error */
-    gdouble latitude = 51.449825;
-    gint32 val = (gint) ((latitude / 90.0) * 2147483647.0);
-    gst_byte_writer_put_int32_be (&bw, val);
-  }
-
-  /* Tag 4: Sensor Longitude */
-  gst_byte_writer_put_uint8 (&bw, 14);  /* local tag: longitude */
-  gst_byte_writer_put_uint8 (&bw, 4);   /* data length (BER short form) */
-  {
-    /* Map -(2^31-1)..(2^31-1) to +/-180 with 0x80000000 = error */
-    gdouble longitude = -2.600439;
-    gint32 val = (gint) ((longitude / 180.0) * 2147483647.0);
-    gst_byte_writer_put_int32_be (&bw, val);
-  }
+  gst_klv_local_set_builder_set_uint (&filt->builder,
+      GST_KLV_UAS_TAG_PRECISION_TIME_STAMP, utc_us);
 
-  /* Tag 5: Sensor True Altitude (MSL) (elevation) */
-  gst_byte_writer_put_uint8 (&bw, 15);  /* local tag: elevation */
-  gst_byte_writer_put_uint8 (&bw, 2);   /* data length (BER short form) */
-  {
-    /* Map 0..(2^16-1) to -900..19000 meters, so resolution 0.303654536m */
-    gdouble elevation = 10.0;
-    guint16 val = ((elevation + 900.0 + 0.151827268) / 19900.0) * 65535.0;
-    gst_byte_writer_put_int16_be (&bw, val);
-  }
-
-  {
-    gsize klv_size = gst_byte_writer_get_size (&bw);
-    guint8 *klv_data = gst_byte_writer_reset_and_get_data (&bw);
-
-    gst_buffer_add_klv_meta_take_data (buf, klv_data, klv_size);
-  }
+  /* small enough to be stored inline in the meta, so nothing is allocated */
+  klv_data = gst_klv_local_set_builder_finish (&filt->builder, &klv_size);
+  gst_buffer_add_klv_meta_from_data (buf, klv_data, klv_size);
 }
 
 static GstFlowReturn
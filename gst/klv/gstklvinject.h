@@ -22,6 +22,8 @@
 
 #include <gst/base/gstbasetransform.h>
 
+#include "klvbuilder.h"
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_KLVINJECT   (gst_klvinject_get_type())
@@ -36,6 +38,8 @@ typedef struct _GstKlvInjectClass GstKlvInjectClass;
 struct _GstKlvInject
 {
   GstBaseTransform base_klvinject;
+
+  GstKLVLocalSetBuilder builder;
 };
 
 struct _GstKlvInjectClass
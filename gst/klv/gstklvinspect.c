@@ -19,7 +19,9 @@
 /**
  * SECTION:element-gstklvinspect
  *
- * The klvinspect element inspects KLV metadata on passing buffers.
+ * The klvinspect element inspects KLV metadata on passing buffers. At LOG
+ * level each packet is parsed and the tags of its local set are logged,
+ * along with whether its MISB ST 0601 checksum is valid.
  *
  * <refsect2>
  * <title>Example launch line</title>
@@ -38,6 +40,7 @@
 #include <gst/base/gstbasetransform.h>
 #include "gstklvinspect.h"
 #include "klv.h"
+#include "klvparse.h"
 
 GST_DEBUG_CATEGORY_STATIC (gst_klvinspect_debug_category);
 #define GST_CAT_DEFAULT gst_klvinspect_debug_category
@@ -99,6 +102,38 @@ gst_klvinspect_dispose (GstKlvInspect * filt)
 {
 }
 
+static void
+gst_klvinspect_log_packet (GstKlvInspect * filt, const GstKLVPacket * packet)
+{
+  GstKLVLocalSetIter iter;
+  GstKLVLocalSetItem item;
+  guint n_items = 0;
+
+  GST_LOG_OBJECT (filt, "KLV packet of %" G_GSIZE_FORMAT " bytes, key "
+      "%02x%02x%02x%02x.%02x%02x%02x%02x.%02x%02x%02x%02x.%02x%02x%02x%02x, "
+      "checksum %s", packet->size,
+      packet->key[0], packet->key[1], packet->key[2], packet->key[3],
+      packet->key[4], packet->key[5], packet->key[6], packet->key[7],
+      packet->key[8], packet->key[9], packet->key[10], packet->key[11],
+      packet->key[12], packet->key[13], packet->key[14], packet->key[15],
+      gst_klv_packet_verify_checksum (packet) ? "valid" : "missing or invalid");
+
+  gst_klv_local_set_iter_init (&iter, packet->value, packet->length);
+  while (gst_klv_local_set_iter_next (&iter, &item)) {
+    guint64 val;
+
+    if (gst_klv_local_set_item_get_uint (&item, &val))
+      GST_LOG_OBJECT (filt, "  tag %u, %" G_GSIZE_FORMAT " bytes, value %"
+          G_GUINT64_FORMAT, item.tag, item.length, val);
+    else
+      GST_LOG_OBJECT (filt, "  tag %u, %" G_GSIZE_FORMAT " bytes", item.tag,
+          item.length);
+    ++n_items;
+  }
+
+  GST_LOG_OBJECT (filt, "Found %u local set items", n_items);
+}
+
 static GstFlowReturn
 gst_klvinspect_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
 {
@@ -106,6 +141,10 @@ gst_klvinspect_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
   GstKLVMeta *klv_meta;
   gpointer iter = NULL;
   gint n_klv_meta_found = 0;
+  gboolean log_packets;
+
+  log_packets = gst_debug_category_get_threshold (GST_CAT_DEFAULT) >=
+      GST_LEVEL_LOG;
 
   while ((klv_meta = (GstKLVMeta *) gst_buffer_iterate_meta_filtered (buf,
               &iter, GST_KLV_META_API_TYPE))) {
@@ -115,6 +154,15 @@ gst_klvinspect_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
     if (klv_data) {
       GST_MEMDUMP_OBJECT (filt, "KLV data", klv_data, (guint) klv_size);
       ++n_klv_meta_found;
+
+      if (log_packets) {
+        GstKLVIter klv_iter;
+        GstKLVPacket packet;
+
+        gst_klv_iter_init (&klv_iter, klv_data, klv_size);
+        while (gst_klv_iter_next (&klv_iter, &packet))
+          gst_klvinspect_log_packet (filt, &packet);
+      }
     }
   }
 
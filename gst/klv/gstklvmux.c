@@ -0,0 +1,489 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+/**
+ * SECTION:element-gstklvmux
+ *
+ * The klvmux element attaches KLV metadata arriving as a separate
+ * meta/x-klv stream, e.g. platform telemetry, to the buffers of a video
+ * stream as #GstKLVMeta. The two streams are matched by running time: each
+ * video buffer gets either the latest KLV sample at or before it, or the
+ * nearest one, as long as it is no further away than #GstKlvMux:max-age.
+ *
+ * For live sources the #GstAggregator:latency property bounds how long a
+ * video buffer is held back waiting for a later KLV sample; each sink pad
+ * queues at most that much data.
+ *
+ * <refsect2>
+ * <title>Example launch line</title>
+ * |[
+ * gst-launch-1.0 videotestsrc is-live=true ! klvmux name=mux latency=100000000 ! klvinspect ! fakesink \
+ *   udpsrc port=5000 caps=meta/x-klv,parsed=true ! mux.klv
+ * ]|
+ * </refsect2>
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <gst/gst.h>
+
+#include "gstklvmux.h"
+
+#if GST_CHECK_VERSION(1,14,0)
+
+#include "klv.h"
+#include "klvparse.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_klvmux_debug_category);
+#define GST_CAT_DEFAULT gst_klvmux_debug_category
+
+/* prototypes */
+static void gst_klvmux_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_klvmux_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
+
+static GstFlowReturn gst_klvmux_aggregate (GstAggregator * agg,
+    gboolean timeout);
+static GstClockTime gst_klvmux_get_next_time (GstAggregator * agg);
+static gboolean gst_klvmux_sink_event (GstAggregator * agg,
+    GstAggregatorPad * aggpad, GstEvent * event);
+static gboolean gst_klvmux_sink_query (GstAggregator * agg,
+    GstAggregatorPad * aggpad, GstQuery * query);
+static gboolean gst_klvmux_src_query (GstAggregator * agg, GstQuery * query);
+static GstFlowReturn gst_klvmux_flush (GstAggregator * agg);
+static gboolean gst_klvmux_stop (GstAggregator * agg);
+
+enum
+{
+  PROP_0,
+  PROP_MODE,
+  PROP_MAX_AGE
+};
+
+#define DEFAULT_PROP_MODE GST_KLVMUX_MODE_NEAREST
+#define DEFAULT_PROP_MAX_AGE GST_SECOND
+
+/* pad templates */
+
+static GstStaticPadTemplate gst_klvmux_src_template =
+GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS_ANY);
+
+static GstStaticPadTemplate gst_klvmux_video_template =
+GST_STATIC_PAD_TEMPLATE ("video",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS_ANY);
+
+static GstStaticPadTemplate gst_klvmux_klv_template =
+GST_STATIC_PAD_TEMPLATE ("klv",
+    GST_PAD_SINK,
+    GST_PAD_ALWAYS,
+    GST_STATIC_CAPS ("meta/x-klv"));
+
+#define GST_TYPE_KLVMUX_MODE (gst_klvmux_mode_get_type())
+static GType
+gst_klvmux_mode_get_type (void)
+{
+  static GType klvmux_mode_type = 0;
+  static const GEnumValue klvmux_mode[] = {
+    {GST_KLVMUX_MODE_PREVIOUS, "Latest KLV sample at or before the video",
+        "previous"},
+    {GST_KLVMUX_MODE_NEAREST, "KLV sample nearest to the video", "nearest"},
+    {0, NULL, NULL},
+  };
+
+  if (!klvmux_mode_type) {
+    klvmux_mode_type = g_enum_register_static ("GstKlvMuxMode", klvmux_mode);
+  }
+  return klvmux_mode_type;
+}
+
+/* class initialization */
+
+G_DEFINE_TYPE_WITH_CODE (GstKlvMux, gst_klvmux, GST_TYPE_AGGREGATOR,
+    GST_DEBUG_CATEGORY_INIT (gst_klvmux_debug_category, "klvmux", 0,
+        "debug category for klvmux element"));
+
+static void
+gst_klvmux_class_init (GstKlvMuxClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstAggregatorClass *aggregator_class = GST_AGGREGATOR_CLASS (klass);
+
+  gobject_class->set_property = gst_klvmux_set_property;
+  gobject_class->get_property = gst_klvmux_get_property;
+
+  g_object_class_install_property (gobject_class, PROP_MODE,
+      g_param_spec_enum ("mode", "Mode",
+          "Which KLV sample to attach to each video buffer",
+          GST_TYPE_KLVMUX_MODE, DEFAULT_PROP_MODE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_MAX_AGE,
+      g_param_spec_uint64 ("max-age", "Maximum age",
+          "Largest running time difference between a video buffer and the "
+          "KLV sample attached to it, in nanoseconds (-1 = unlimited)",
+          0, G_MAXUINT64, DEFAULT_PROP_MAX_AGE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  gst_element_class_add_static_pad_template_with_gtype (element_class,
+      &gst_klvmux_src_template, GST_TYPE_AGGREGATOR_PAD);
+  gst_element_class_add_static_pad_template_with_gtype (element_class,
+      &gst_klvmux_video_template, GST_TYPE_AGGREGATOR_PAD);
+  gst_element_class_add_static_pad_template_with_gtype (element_class,
+      &gst_klvmux_klv_template, GST_TYPE_AGGREGATOR_PAD);
+
+  gst_element_class_set_static_metadata (element_class,
+      "KLV muxer", "Muxer", "Attach a KLV stream to video buffers as metadata",
+      "Joshua M. Doe <oss@nvl.army.mil>");
+
+  aggregator_class->aggregate = GST_DEBUG_FUNCPTR (gst_klvmux_aggregate);
+  aggregator_class->get_next_time =
+      GST_DEBUG_FUNCPTR (gst_klvmux_get_next_time);
+  aggregator_class->sink_event = GST_DEBUG_FUNCPTR (gst_klvmux_sink_event);
+  aggregator_class->sink_query = GST_DEBUG_FUNCPTR (gst_klvmux_sink_query);
+  aggregator_class->src_query = GST_DEBUG_FUNCPTR (gst_klvmux_src_query);
+  aggregator_class->flush = GST_DEBUG_FUNCPTR (gst_klvmux_flush);
+  aggregator_class->stop = GST_DEBUG_FUNCPTR (gst_klvmux_stop);
+}
+
+static GstAggregatorPad *
+gst_klvmux_add_sink_pad (GstKlvMux * self, const gchar * name)
+{
+  GstPadTemplate *templ;
+  GstPad *pad;
+
+  templ = gst_element_class_get_pad_template (GST_ELEMENT_GET_CLASS (self),
+      name);
+  pad = g_object_new (GST_TYPE_AGGREGATOR_PAD, "name", name, "direction",
+      GST_PAD_SINK, "template", templ, NULL);
+  gst_element_add_pad (GST_ELEMENT (self), pad);
+
+  return GST_AGGREGATOR_PAD (pad);
+}
+
+static void
+gst_klvmux_init (GstKlvMux * self)
+{
+  self->video_pad = gst_klvmux_add_sink_pad (self, "video");
+  self->klv_pad = gst_klvmux_add_sink_pad (self, "klv");
+
+  self->mode = DEFAULT_PROP_MODE;
+  self->max_age = DEFAULT_PROP_MAX_AGE;
+
+  self->prev_klv = NULL;
+  self->prev_klv_running_time = GST_CLOCK_TIME_NONE;
+}
+
+static void
+gst_klvmux_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec)
+{
+  GstKlvMux *self = GST_KLVMUX (object);
+
+  GST_OBJECT_LOCK (self);
+  switch (prop_id) {
+    case PROP_MODE:
+      self->mode = g_value_get_enum (value);
+      break;
+    case PROP_MAX_AGE:
+      self->max_age = g_value_get_uint64 (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+  GST_OBJECT_UNLOCK (self);
+}
+
+static void
+gst_klvmux_get_property (GObject * object, guint prop_id, GValue * value,
+    GParamSpec * pspec)
+{
+  GstKlvMux *self = GST_KLVMUX (object);
+
+  GST_OBJECT_LOCK (self);
+  switch (prop_id) {
+    case PROP_MODE:
+      g_value_set_enum (value, self->mode);
+      break;
+    case PROP_MAX_AGE:
+      g_value_set_uint64 (value, self->max_age);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+  GST_OBJECT_UNLOCK (self);
+}
+
+static GstClockTime
+gst_klvmux_running_time (GstAggregatorPad * pad, GstBuffer * buf)
+{
+  GstClockTime ts = GST_BUFFER_PTS (buf);
+  GstClockTime running_time;
+
+  if (!GST_CLOCK_TIME_IS_VALID (ts))
+    ts = GST_BUFFER_DTS (buf);
+  if (!GST_CLOCK_TIME_IS_VALID (ts))
+    return GST_CLOCK_TIME_NONE;
+
+  GST_OBJECT_LOCK (pad);
+  running_time =
+      gst_segment_to_running_time (&pad->segment, GST_FORMAT_TIME, ts);
+  GST_OBJECT_UNLOCK (pad);
+
+  return running_time;
+}
+
+static void
+gst_klvmux_attach (GstKlvMux * self, GstBuffer * video, GstBuffer * klv)
+{
+  GstMapInfo map;
+  GstKLVIter iter;
+  GstKLVPacket packet;
+
+  if (!gst_buffer_map (klv, &map, GST_MAP_READ)) {
+    GST_WARNING_OBJECT (self, "Failed to map KLV buffer");
+    return;
+  }
+
+  gst_klv_iter_init (&iter, map.data, map.size);
+  while (gst_klv_iter_next (&iter, &packet))
+    gst_buffer_add_klv_meta_from_data (video, packet.data, packet.size);
+
+  gst_buffer_unmap (klv, &map);
+}
+
+static GstFlowReturn
+gst_klvmux_aggregate (GstAggregator * agg, gboolean timeout)
+{
+  GstKlvMux *self = GST_KLVMUX (agg);
+  GstBuffer *video, *klv, *next_klv = NULL, *use_klv = NULL;
+  GstClockTime video_rt, klv_rt, next_klv_rt = GST_CLOCK_TIME_NONE;
+  GstClockTime age = GST_CLOCK_TIME_NONE, max_age;
+  GstKlvMuxMode mode;
+
+  GST_OBJECT_LOCK (self);
+  mode = self->mode;
+  max_age = self->max_age;
+  GST_OBJECT_UNLOCK (self);
+
+  video = gst_aggregator_pad_peek_buffer (self->video_pad);
+  if (video == NULL) {
+    if (gst_aggregator_pad_is_eos (self->video_pad))
+      return GST_FLOW_EOS;
+    return GST_FLOW_OK;
+  }
+
+  video_rt = gst_klvmux_running_time (self->video_pad, video);
+  gst_buffer_unref (video);
+
+  if (GST_CLOCK_TIME_IS_VALID (video_rt)) {
+    /* consume the KLV samples up to the video, keeping the latest, and
+     * peek at the first one after it */
+    while ((klv = gst_aggregator_pad_peek_buffer (self->klv_pad))) {
+      /* GAP events arrive as empty buffers, which must not replace the
+       * previous sample */
+      if (GST_BUFFER_FLAG_IS_SET (klv, GST_BUFFER_FLAG_GAP) ||
+          gst_buffer_get_size (klv) == 0) {
+        GST_LOG_OBJECT (self, "Dropping empty KLV buffer");
+        gst_buffer_unref (klv);
+        gst_aggregator_pad_drop_buffer (self->klv_pad);
+        continue;
+      }
+
+      klv_rt = gst_klvmux_running_time (self->klv_pad, klv);
+
+      if (!GST_CLOCK_TIME_IS_VALID (klv_rt)) {
+        GST_DEBUG_OBJECT (self, "Dropping KLV buffer without timestamp");
+        gst_buffer_unref (klv);
+        gst_aggregator_pad_drop_buffer (self->klv_pad);
+        continue;
+      }
+
+      if (klv_rt > video_rt) {
+        next_klv = klv;
+        next_klv_rt = klv_rt;
+        break;
+      }
+
+      gst_buffer_replace (&self->prev_klv, NULL);
+      self->prev_klv = klv;
+      self->prev_klv_running_time = klv_rt;
+      gst_aggregator_pad_drop_buffer (self->klv_pad);
+    }
+
+    /* a sample at or closer after the video may still be on its way */
+    if (next_klv == NULL && !timeout &&
+        !gst_aggregator_pad_is_eos (self->klv_pad))
+      return GST_FLOW_OK;
+
+    if (self->prev_klv != NULL) {
+      use_klv = self->prev_klv;
+      if (video_rt >= self->prev_klv_running_time)
+        age = video_rt - self->prev_klv_running_time;
+      else
+        age = self->prev_klv_running_time - video_rt;
+    }
+
+    if (mode == GST_KLVMUX_MODE_NEAREST && next_klv != NULL &&
+        (use_klv == NULL || next_klv_rt - video_rt < age)) {
+      use_klv = next_klv;
+      age = next_klv_rt - video_rt;
+    }
+
+    if (use_klv != NULL && GST_CLOCK_TIME_IS_VALID (max_age) && age > max_age) {
+      GST_LOG_OBJECT (self, "KLV sample is %" GST_TIME_FORMAT " away, too old",
+          GST_TIME_ARGS (age));
+      use_klv = NULL;
+    }
+  }
+
+  video = gst_aggregator_pad_pop_buffer (self->video_pad);
+
+  if (use_klv != NULL) {
+    GST_LOG_OBJECT (self, "Attaching KLV sample %" GST_TIME_FORMAT
+        " away to video buffer at %" GST_TIME_FORMAT, GST_TIME_ARGS (age),
+        GST_TIME_ARGS (video_rt));
+    video = gst_buffer_make_writable (video);
+    gst_klvmux_attach (self, video, use_klv);
+  }
+
+  if (next_klv != NULL)
+    gst_buffer_unref (next_klv);
+
+  return gst_aggregator_finish_buffer (agg, video);
+}
+
+static GstClockTime
+gst_klvmux_get_next_time (GstAggregator * agg)
+{
+  GstKlvMux *self = GST_KLVMUX (agg);
+  GstBuffer *video;
+  GstClockTime running_time;
+
+  video = gst_aggregator_pad_peek_buffer (self->video_pad);
+  if (video == NULL)
+    return GST_CLOCK_TIME_NONE;
+
+  running_time = gst_klvmux_running_time (self->video_pad, video);
+  gst_buffer_unref (video);
+
+  return running_time;
+}
+
+static gboolean
+gst_klvmux_sink_event (GstAggregator * agg, GstAggregatorPad * aggpad,
+    GstEvent * event)
+{
+  GstKlvMux *self = GST_KLVMUX (agg);
+
+  if (aggpad == self->video_pad) {
+    switch (GST_EVENT_TYPE (event)) {
+      case GST_EVENT_CAPS:{
+        GstCaps *caps;
+
+        gst_event_parse_caps (event, &caps);
+        gst_aggregator_set_src_caps (agg, caps);
+        break;
+      }
+      case GST_EVENT_SEGMENT:{
+        const GstSegment *segment;
+
+        /* output buffers are the video buffers, so is the segment */
+        gst_event_parse_segment (event, &segment);
+        GST_OBJECT_LOCK (agg);
+        gst_segment_copy_into (segment,
+            &GST_AGGREGATOR_PAD (agg->srcpad)->segment);
+        GST_OBJECT_UNLOCK (agg);
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  return GST_AGGREGATOR_CLASS (gst_klvmux_parent_class)->sink_event (agg,
+      aggpad, event);
+}
+
+static gboolean
+gst_klvmux_sink_query (GstAggregator * agg, GstAggregatorPad * aggpad,
+    GstQuery * query)
+{
+  GstKlvMux *self = GST_KLVMUX (agg);
+
+  /* video passes straight through, so let downstream answer */
+  if (aggpad == self->video_pad) {
+    switch (GST_QUERY_TYPE (query)) {
+      case GST_QUERY_CAPS:
+      case GST_QUERY_ACCEPT_CAPS:
+      case GST_QUERY_ALLOCATION:
+        return gst_pad_peer_query (agg->srcpad, query);
+      default:
+        break;
+    }
+  }
+
+  return GST_AGGREGATOR_CLASS (gst_klvmux_parent_class)->sink_query (agg,
+      aggpad, query);
+}
+
+static gboolean
+gst_klvmux_src_query (GstAggregator * agg, GstQuery * query)
+{
+  GstKlvMux *self = GST_KLVMUX (agg);
+
+  switch (GST_QUERY_TYPE (query)) {
+    case GST_QUERY_CAPS:
+    case GST_QUERY_ACCEPT_CAPS:
+      return gst_pad_peer_query (GST_PAD (self->video_pad), query);
+    default:
+      break;
+  }
+
+  return GST_AGGREGATOR_CLASS (gst_klvmux_parent_class)->src_query (agg,
+      query);
+}
+
+static GstFlowReturn
+gst_klvmux_flush (GstAggregator * agg)
+{
+  GstKlvMux *self = GST_KLVMUX (agg);
+
+  gst_buffer_replace (&self->prev_klv, NULL);
+  self->prev_klv_running_time = GST_CLOCK_TIME_NONE;
+
+  return GST_FLOW_OK;
+}
+
+static gboolean
+gst_klvmux_stop (GstAggregator * agg)
+{
+  gst_klvmux_flush (agg);
+
+  return TRUE;
+}
+
+#endif
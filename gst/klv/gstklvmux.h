@@ -0,0 +1,73 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef _GST_KLVMUX_H_
+#define _GST_KLVMUX_H_
+
+#include <gst/gst.h>
+
+/* GstAggregator is only part of the base library since 1.14 */
+#if GST_CHECK_VERSION(1,14,0)
+
+#include <gst/base/gstaggregator.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_KLVMUX   (gst_klvmux_get_type())
+#define GST_KLVMUX(obj)   (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_KLVMUX,GstKlvMux))
+#define GST_KLVMUX_CLASS(klass)   (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_KLVMUX,GstKlvMuxClass))
+#define GST_IS_KLVMUX(obj)   (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_KLVMUX))
+#define GST_IS_KLVMUX_CLASS(obj)   (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_KLVMUX))
+
+typedef struct _GstKlvMux GstKlvMux;
+typedef struct _GstKlvMuxClass GstKlvMuxClass;
+
+typedef enum
+{
+  GST_KLVMUX_MODE_PREVIOUS,
+  GST_KLVMUX_MODE_NEAREST
+} GstKlvMuxMode;
+
+struct _GstKlvMux
+{
+  GstAggregator base_klvmux;
+
+  GstAggregatorPad *video_pad;
+  GstAggregatorPad *klv_pad;
+
+  /* properties */
+  GstKlvMuxMode mode;
+  GstClockTime max_age;
+
+  /* latest KLV buffer at or before the current video buffer */
+  GstBuffer *prev_klv;
+  GstClockTime prev_klv_running_time;
+};
+
+struct _GstKlvMuxClass
+{
+  GstAggregatorClass base_klvmux_class;
+};
+
+GType gst_klvmux_get_type (void);
+
+G_END_DECLS
+
+#endif
+
+#endif /* _GST_KLVMUX_H_ */
@@ -24,7 +24,10 @@
 /**
 * SECTION:element-misbirpack
 *
-* Pack GRAY16 to MISB IR packed video.
+* Pack GRAY16 or GRAY8 to MISB IR packed video, as 10-bit v210 or 8-bit
+* UYVY. Each 16-bit pixel is split into a chroma sample, its bits under
+* chroma-mask, and a luma sample, its bits under luma-mask after shifting
+* right by shift. 8-bit pixels are carried in luma alone.
 *
 * <refsect2>
 * <title>Example launch line</title>
@@ -42,7 +45,8 @@
 
 #include <gst/video/video.h>
 
-//#include "gstextractcolororc-dist.h"
+#include "gstmisborc.h"
+#include "gstvisionv210.h"
 
 /* GstMisbIrPack signals and args */
 enum
@@ -55,24 +59,50 @@ enum
 {
   PROP_0,
   PROP_OFFSET,
+  PROP_SHIFT,
+  PROP_LUMA_MASK,
+  PROP_CHROMA_MASK,
+  PROP_N_THREADS,
   PROP_LAST
 };
 
 #define DEFAULT_PROP_OFFSET 64
+#define DEFAULT_PROP_SHIFT 8
+#define DEFAULT_PROP_LUMA_MASK 0xff
+#define DEFAULT_PROP_CHROMA_MASK 0xff
+#define DEFAULT_PROP_N_THREADS 1
+
+/* a horizontal stripe of the frame processed by one thread */
+struct _GstMisbIrPackStripe
+{
+  GstMisbIrPack *filt;
+  GstVideoFrame *in_frame;
+  GstVideoFrame *out_frame;
+  guint16 offset;
+  guint16 shift;
+  guint16 luma_mask;
+  guint16 chroma_mask;
+  gint y_start;
+  gint y_end;
+
+  /* pixels of one row split by position in each group of three */
+  guint16 *rows[3];
+  guint16 *scratch;
+};
 
 /* the capabilities of the inputs and outputs */
 static GstStaticPadTemplate gst_misb_ir_pack_sink_template =
 GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
     GST_PAD_ALWAYS,
-    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("GRAY16_LE"))
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("{ GRAY16_LE, GRAY8 }"))
     );
 
 static GstStaticPadTemplate gst_misb_ir_pack_src_template =
 GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
     GST_PAD_ALWAYS,
-    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("v210"))
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("{ v210, UYVY }"))
     );
 
 
@@ -93,9 +123,11 @@ static gboolean gst_misb_ir_pack_set_info (GstVideoFilter * filter,
     GstVideoInfo * out_info);
 static GstFlowReturn gst_misb_ir_pack_transform_frame (GstVideoFilter * filter,
     GstVideoFrame * in_frame, GstVideoFrame * out_frame);
+static gboolean gst_misb_ir_pack_stop (GstBaseTransform * trans);
 
 /* GstMisbIrPack method declarations */
 static void gst_misb_ir_pack_reset (GstMisbIrPack * filter);
+static void gst_misb_ir_pack_free_stripes (GstMisbIrPack * filt);
 
 /* setup debug */
 GST_DEBUG_CATEGORY_STATIC (misb_ir_pack_debug);
@@ -152,8 +184,33 @@ gst_misb_ir_pack_class_init (GstMisbIrPackClass * klass)
   g_object_class_install_property (G_OBJECT_CLASS (klass),
       PROP_OFFSET, g_param_spec_int ("offset",
           "Offset value",
-          "Offset value to apply during packing", 0, 1023,
+          "Offset value to add during packing, in 10-bit units (divided "
+          "by 4 for UYVY, so undo it with misbirunpack offset=-offset/4), "
+          "saturating at the largest sample value", 0, 1023,
           DEFAULT_PROP_OFFSET, G_PARAM_STATIC_STRINGS | G_PARAM_READWRITE));
+  g_object_class_install_property (G_OBJECT_CLASS (klass),
+      PROP_SHIFT, g_param_spec_uint ("shift",
+          "Shift value",
+          "Bits to right shift GRAY16 pixels by to get the luminance component",
+          0, 15, DEFAULT_PROP_SHIFT,
+          G_PARAM_STATIC_STRINGS | G_PARAM_READWRITE));
+  g_object_class_install_property (G_OBJECT_CLASS (klass),
+      PROP_LUMA_MASK, g_param_spec_uint ("luma-mask",
+          "Luma mask",
+          "Mask to bitwise AND with GRAY16 pixels after shifting to get the "
+          "luminance component", 0, 0xffff, DEFAULT_PROP_LUMA_MASK,
+          G_PARAM_STATIC_STRINGS | G_PARAM_READWRITE));
+  g_object_class_install_property (G_OBJECT_CLASS (klass),
+      PROP_CHROMA_MASK, g_param_spec_uint ("chroma-mask",
+          "Chroma mask",
+          "Mask to bitwise AND with GRAY16 pixels to get the chrominance "
+          "component", 0, 0xffff, DEFAULT_PROP_CHROMA_MASK,
+          G_PARAM_STATIC_STRINGS | G_PARAM_READWRITE));
+  g_object_class_install_property (G_OBJECT_CLASS (klass),
+      PROP_N_THREADS, g_param_spec_uint ("n-threads", "Threads",
+          "Number of threads to split each frame across (0 = number of "
+          "processors)", 0, G_MAXINT, DEFAULT_PROP_N_THREADS,
+          G_PARAM_STATIC_STRINGS | G_PARAM_READWRITE));
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&gst_misb_ir_pack_sink_template));
@@ -162,12 +219,13 @@ gst_misb_ir_pack_class_init (GstMisbIrPackClass * klass)
 
   gst_element_class_set_static_metadata (gstelement_class,
       "Pack to MISB IR video", "Filter/Effect/Video",
-      "Pack GRAY16 to MISB IR video according to ST 0402.2 Method 2",
+      "Pack GRAY16 or GRAY8 to MISB IR video according to ST 0402.2 Method 2",
       "Joshua M. Doe <oss@nvl.army.mil>");
 
   /* Register GstBaseTransform vmethods */
   gstbasetransform_class->transform_caps =
       GST_DEBUG_FUNCPTR (gst_misb_ir_pack_transform_caps);
+  gstbasetransform_class->stop = GST_DEBUG_FUNCPTR (gst_misb_ir_pack_stop);
 
   gstvideofilter_class->set_info =
       GST_DEBUG_FUNCPTR (gst_misb_ir_pack_set_info);
@@ -181,6 +239,10 @@ gst_misb_ir_pack_init (GstMisbIrPack * filt)
   GST_DEBUG_OBJECT (filt, "init class instance");
 
   filt->offset_value = DEFAULT_PROP_OFFSET;
+  filt->shift_value = DEFAULT_PROP_SHIFT;
+  filt->luma_mask = DEFAULT_PROP_LUMA_MASK;
+  filt->chroma_mask = DEFAULT_PROP_CHROMA_MASK;
+  filt->n_threads = DEFAULT_PROP_N_THREADS;
   gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filt), FALSE);
 
   gst_misb_ir_pack_reset (filt);
@@ -198,6 +260,20 @@ gst_misb_ir_pack_set_property (GObject * object, guint prop_id,
     case PROP_OFFSET:
       filt->offset_value = g_value_get_int (value);
       break;
+    case PROP_SHIFT:
+      filt->shift_value = g_value_get_uint (value);
+      break;
+    case PROP_LUMA_MASK:
+      filt->luma_mask = g_value_get_uint (value);
+      break;
+    case PROP_CHROMA_MASK:
+      filt->chroma_mask = g_value_get_uint (value);
+      break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (filt);
+      filt->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (filt);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -216,6 +292,20 @@ gst_misb_ir_pack_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_OFFSET:
       g_value_set_int (value, filt->offset_value);
       break;
+    case PROP_SHIFT:
+      g_value_set_uint (value, filt->shift_value);
+      break;
+    case PROP_LUMA_MASK:
+      g_value_set_uint (value, filt->luma_mask);
+      break;
+    case PROP_CHROMA_MASK:
+      g_value_set_uint (value, filt->chroma_mask);
+      break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (filt);
+      g_value_set_uint (value, filt->n_threads);
+      GST_OBJECT_UNLOCK (filt);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -238,10 +328,12 @@ gst_misb_ir_pack_transform_caps (GstBaseTransform * trans,
   for (i = 0; i < n; ++i) {
     structure = gst_caps_get_structure (caps, i);
     if (direction == GST_PAD_SINK) {
-      newstruct = gst_structure_new_from_string ("video/x-raw,format=v210");
+      newstruct =
+          gst_structure_new_from_string ("video/x-raw,format={v210,UYVY}");
     } else {
       newstruct =
-          gst_structure_new_from_string ("video/x-raw,format=GRAY16_LE");
+          gst_structure_new_from_string
+          ("video/x-raw,format={GRAY16_LE,GRAY8}");
     }
 
     gst_structure_set_value (newstruct, "width",
@@ -283,19 +375,136 @@ gst_misb_ir_pack_set_info (GstVideoFilter * filter, GstCaps * incaps,
   return res;
 }
 
+/**
+ * gst_misb_ir_pack_pack_stripe:
+ * @data: #GstMisbIrPackStripe
+ *
+ * Pack the rows of one stripe. For v210 each row is split into groups of
+ * three pixels which ORC packs into pairs of words.
+ */
+static void
+gst_misb_ir_pack_pack_stripe (gpointer data)
+{
+  GstMisbIrPackStripe *stripe = data;
+  GstVideoFrame *in_frame = stripe->in_frame;
+  GstVideoFrame *out_frame = stripe->out_frame;
+  const gint width = GST_VIDEO_FRAME_COMP_WIDTH (in_frame, 0);
+  const gboolean gray8 =
+      GST_VIDEO_FRAME_FORMAT (in_frame) == GST_VIDEO_FORMAT_GRAY8;
+  const gboolean v210 =
+      GST_VIDEO_FRAME_FORMAT (out_frame) == GST_VIDEO_FORMAT_v210;
+  /* 8-bit pixels go to luma alone */
+  const gint chroma_mask = gray8 ? 0 : stripe->chroma_mask;
+  const gint luma_mask = gray8 ? 0xff : stripe->luma_mask;
+  const gint shift = gray8 ? 0 : stripe->shift;
+  gint y;
+
+  for (y = stripe->y_start; y < stripe->y_end; y++) {
+    const guint8 *src = GST_VIDEO_FRAME_COMP_DATA (in_frame, 0) +
+        y * GST_VIDEO_FRAME_COMP_STRIDE (in_frame, 0);
+    guint8 *dst = GST_VIDEO_FRAME_COMP_DATA (out_frame, 0) +
+        y * GST_VIDEO_FRAME_COMP_STRIDE (out_frame, 0);
+
+    if (v210) {
+      if (gray8)
+        gst_vision_v210_split_row_8 (stripe->rows[0], stripe->rows[1],
+            stripe->rows[2], src, width);
+      else
+        gst_vision_v210_split_row (stripe->rows[0], stripe->rows[1],
+            stripe->rows[2], (const guint16 *) src, width);
+      misb_orc_pack_v210 ((guint32 *) dst, stripe->rows[0], stripe->rows[1],
+          stripe->rows[2], stripe->offset, chroma_mask, luma_mask, shift,
+          GST_VISION_V210_N_GROUPS (width));
+    } else if (gray8) {
+      misb_orc_pack_uyvy_gray8 (dst, src, stripe->offset / 4, width);
+    } else {
+      misb_orc_pack_uyvy (dst, (const guint16 *) src, stripe->offset / 4,
+          chroma_mask, luma_mask, shift, width);
+    }
+  }
+}
+
+/**
+ * gst_misb_ir_pack_free_stripes:
+ * @filt: #GstMisbIrPack
+ *
+ * Stop the worker threads and free the per-stripe state
+ */
+static void
+gst_misb_ir_pack_free_stripes (GstMisbIrPack * filt)
+{
+  gint i, n;
+
+  if (filt->runner == NULL)
+    return;
+
+  n = gst_vision_task_runner_get_n_threads (filt->runner);
+  for (i = 0; i < n; i++)
+    g_free (filt->stripes[i].scratch);
+  g_free (filt->stripes);
+  g_free (filt->stripe_data);
+  gst_vision_task_runner_free (filt->runner);
+
+  filt->stripes = NULL;
+  filt->stripe_data = NULL;
+  filt->runner = NULL;
+  filt->stripes_width = 0;
+}
+
+/**
+ * gst_misb_ir_pack_setup_stripes:
+ * @filt: #GstMisbIrPack
+ * @width: width of the frame
+ *
+ * (Re)create the worker threads if the number of threads or the width
+ * changed
+ */
+static void
+gst_misb_ir_pack_setup_stripes (GstMisbIrPack * filt, gint width)
+{
+  const gint n_groups = GST_VISION_V210_N_GROUPS (width);
+  guint n_threads;
+  gint i, j;
+
+  GST_OBJECT_LOCK (filt);
+  n_threads = filt->n_threads;
+  GST_OBJECT_UNLOCK (filt);
+
+  if (n_threads == 0)
+    n_threads = g_get_num_processors ();
+
+  if (filt->runner != NULL &&
+      gst_vision_task_runner_get_n_threads (filt->runner) == n_threads &&
+      filt->stripes_width == width)
+    return;
+
+  gst_misb_ir_pack_free_stripes (filt);
+
+  GST_DEBUG_OBJECT (filt, "Using %u threads", n_threads);
+
+  filt->runner = gst_vision_task_runner_new (n_threads);
+  filt->stripes = g_new0 (GstMisbIrPackStripe, n_threads);
+  filt->stripe_data = g_new (gpointer, n_threads);
+  for (i = 0; i < n_threads; i++) {
+    GstMisbIrPackStripe *stripe = &filt->stripes[i];
+
+    stripe->filt = filt;
+    stripe->scratch = g_new (guint16, 3 * n_groups);
+    for (j = 0; j < 3; j++)
+      stripe->rows[j] = stripe->scratch + j * n_groups;
+    filt->stripe_data[i] = stripe;
+  }
+  filt->stripes_width = width;
+}
+
 static GstFlowReturn
 gst_misb_ir_pack_transform_frame (GstVideoFilter * filter,
     GstVideoFrame * in_frame, GstVideoFrame * out_frame)
 {
   GstMisbIrPack *filt = GST_MISB_IR_PACK (filter);
   GTimer *timer = NULL;
-  guint offset = filt->offset_value;
-  gint y;
-  guint16 *src, *src_end;
-  guint32 *dst;
-  guint32 word0;
-  guint32 word1;
-  guint16 luma0, chroma0, luma1, chroma1, luma2, chroma2;
+  gint height = GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, 0);
+  gint i, n;
 
   GST_LOG_OBJECT (filt, "Performing non-inplace transform");
 
@@ -303,81 +512,24 @@ gst_misb_ir_pack_transform_frame (GstVideoFilter * filter,
   timer = g_timer_new ();
 #endif
 
-  for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, 0); y++) {
-    src = (guint16 *) (GST_VIDEO_FRAME_COMP_DATA (in_frame, 0) +
-        y * GST_VIDEO_FRAME_COMP_STRIDE (in_frame, 0));
-    src_end = src + GST_VIDEO_FRAME_COMP_WIDTH (in_frame, 0);
-    dst = (guint32 *) (GST_VIDEO_FRAME_COMP_DATA (out_frame, 0) +
-        y * GST_VIDEO_FRAME_COMP_STRIDE (out_frame, 0));
-
-    while (src + 2 < src_end) {
-      chroma0 = (*src & 0xff) + offset;
-      luma0 = ((*src & 0xff00) >> 8) + offset;
-      src++;
-      chroma1 = (*src & 0xff) + offset;
-      luma1 = ((*src & 0xff00) >> 8) + offset;
-      src++;
-      chroma2 = (*src & 0xff) + offset;
-      luma2 = ((*src & 0xff00) >> 8) + offset;
-      src++;
-
-      word0 = chroma0 | luma0 << 10 | chroma1 << 20;
-      word1 = luma1 | chroma2 << 10 | luma2 << 20;
-
-      *dst++ = word0;
-      *dst++ = word1;
-    }
-
-    /* handle the last one or two pixels if they exist */
-    if (src_end - src) {
-      chroma0 = (*src & 0xff) + offset;
-      luma0 = ((*src & 0xff00) >> 8) + offset;
-      src++;
-      if (src_end - src) {
-        chroma1 = (*src & 0xff) + offset;
-        luma1 = ((*src & 0xff00) >> 8) + offset;
-      } else {
-        chroma1 = luma1 = 0;
-      }
-      chroma2 = luma2 = 0;
-
-      word0 = chroma0 | luma0 << 10 | chroma1 << 20;
-      word1 = luma1 | chroma2 << 10 | luma2 << 20;
-
-      *dst++ = word0;
-      *dst++ = word1;
-    }
+  gst_misb_ir_pack_setup_stripes (filt,
+      GST_VIDEO_FRAME_COMP_WIDTH (in_frame, 0));
+  n = gst_vision_task_runner_get_n_threads (filt->runner);
+  for (i = 0; i < n; i++) {
+    GstMisbIrPackStripe *stripe = &filt->stripes[i];
+
+    stripe->in_frame = in_frame;
+    stripe->out_frame = out_frame;
+    stripe->offset = filt->offset_value;
+    stripe->shift = filt->shift_value;
+    stripe->luma_mask = filt->luma_mask;
+    stripe->chroma_mask = filt->chroma_mask;
+    stripe->y_start = height * i / n;
+    stripe->y_end = height * (i + 1) / n;
   }
 
-  //for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, 0); y++) {
-  //    src = (guint16 *) (GST_VIDEO_FRAME_COMP_DATA (in_frame, 0) + 
-  //        y * GST_VIDEO_FRAME_COMP_STRIDE (in_frame, 0));
-  //    dst = (guint32 *) (GST_VIDEO_FRAME_COMP_DATA (out_frame, 0) + 
-  //        y * GST_VIDEO_FRAME_COMP_STRIDE (out_frame, 0));
-  //    for (x = 0; x < GST_VIDEO_FRAME_COMP_WIDTH (in_frame, 0); ) {
-  //        guint32 word0;
-  //        guint32 word1;
-  //        guint16 luma0, chroma0, luma1, chroma1, luma2, chroma2;
-
-  //        chroma0 = *src & 0xff + offset;
-  //        luma0 = (*src & 0xff00) >> 8 + offset;
-  //        src++;
-  //        chroma1 = *src & 0xff + offset;
-  //        luma1 = (*src & 0xff00) >> 8 + offset;
-  //        src++;
-  //        chroma2 = *src & 0xff + offset;
-  //        luma2 = (*src & 0xff00) >> 8 + offset;
-  //        src++;
-
-  //        word0 = 0;
-  //        word0 = chroma0 | luma0 << 10 | chroma1 << 20;
-  //        word1 = 0;
-  //        word1 = luma1 | chroma2 << 10 | luma2 << 20;
-
-  //        dst[x++] = word0;
-  //        dst[x++] = word1;
-  //    }
-  //}
+  gst_vision_task_runner_run (filt->runner, gst_misb_ir_pack_pack_stripe,
+      filt->stripe_data);
 
 #if 0
   GST_LOG_OBJECT (filt, "Processing took %.3f ms", g_timer_elapsed (timer,
@@ -388,10 +540,21 @@ gst_misb_ir_pack_transform_frame (GstVideoFilter * filter,
   return GST_FLOW_OK;
 }
 
+static gboolean
+gst_misb_ir_pack_stop (GstBaseTransform * trans)
+{
+  GstMisbIrPack *filt = GST_MISB_IR_PACK (trans);
+
+  gst_misb_ir_pack_free_stripes (filt);
+
+  return TRUE;
+}
 
 static void
 gst_misb_ir_pack_reset (GstMisbIrPack * misb_ir_pack)
 {
   gst_video_info_init (&misb_ir_pack->info_in);
   gst_video_info_init (&misb_ir_pack->info_out);
+
+  gst_misb_ir_pack_free_stripes (misb_ir_pack);
 }
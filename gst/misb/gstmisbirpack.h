@@ -28,6 +28,8 @@
 #include <gst/video/gstvideofilter.h>
 #include <gst/video/video.h>
 
+#include "gstvisiontaskrunner.h"
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_MISB_IR_PACK \
@@ -43,6 +45,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstMisbIrPack GstMisbIrPack;
 typedef struct _GstMisbIrPackClass GstMisbIrPackClass;
+typedef struct _GstMisbIrPackStripe GstMisbIrPackStripe;
 
 /**
 * GstMisbIrPack:
@@ -61,6 +64,16 @@ struct _GstMisbIrPack
 
   /* properties */
   guint offset_value;
+  guint shift_value;
+  guint luma_mask;
+  guint chroma_mask;
+  guint n_threads;
+
+  /* threading */
+  GstVisionTaskRunner *runner;
+  GstMisbIrPackStripe *stripes;
+  gpointer *stripe_data;
+  gint stripes_width;
 };
 
 struct _GstMisbIrPackClass
@@ -42,7 +42,8 @@
 
 #include <gst/video/video.h>
 
-//#include "gstextractcolororc-dist.h"
+#include "gstmisborc.h"
+#include "gstvisionv210.h"
 
 /* GstMisbIrUnpack signals and args */
 enum
@@ -59,6 +60,7 @@ enum
   PROP_SWAP,
   PROP_LUMA_MASK,
   PROP_CHROMA_MASK,
+  PROP_N_THREADS,
   PROP_LAST
 };
 
@@ -67,6 +69,25 @@ enum
 #define DEFAULT_PROP_SWAP FALSE
 #define DEFAULT_PROP_LUMA_MASK 0xff
 #define DEFAULT_PROP_CHROMA_MASK 0xff
+#define DEFAULT_PROP_N_THREADS 1
+
+/* a horizontal stripe of the frame processed by one thread */
+struct _GstMisbIrUnpackStripe
+{
+  GstMisbIrUnpack *filt;
+  GstVideoFrame *in_frame;
+  GstVideoFrame *out_frame;
+  gint16 offset;
+  guint16 shift;
+  guint16 luma_mask;
+  guint16 chroma_mask;
+  gboolean swap;
+  gint y_start;
+  gint y_end;
+
+  /* v210 pixels of one row, one element per group of three */
+  guint64 *groups;
+};
 
 /* the capabilities of the inputs and outputs */
 static GstStaticPadTemplate gst_misb_ir_unpack_sink_template =
@@ -94,6 +115,9 @@ static void gst_misb_ir_unpack_dispose (GObject * object);
 /* GstBaseTransform vmethod declarations */
 static GstCaps *gst_misb_ir_unpack_transform_caps (GstBaseTransform * trans,
     GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps);
+static GstFlowReturn gst_misb_ir_unpack_transform_ip (GstBaseTransform *
+    trans, GstBuffer * buf);
+static gboolean gst_misb_ir_unpack_stop (GstBaseTransform * trans);
 
 /* GstVideoFilter vmethod declarations */
 static gboolean gst_misb_ir_unpack_set_info (GstVideoFilter * filter,
@@ -104,6 +128,8 @@ static GstFlowReturn gst_misb_ir_unpack_transform_frame (GstVideoFilter *
 
 /* GstMisbIrUnpack method declarations */
 static void gst_misb_ir_unpack_reset (GstMisbIrUnpack * filter);
+static gboolean gst_misb_ir_unpack_is_identity (GstMisbIrUnpack * filt);
+static void gst_misb_ir_unpack_free_stripes (GstMisbIrUnpack * filt);
 
 /* setup debug */
 GST_DEBUG_CATEGORY_STATIC (misb_ir_unpack_debug);
@@ -160,7 +186,8 @@ gst_misb_ir_unpack_class_init (GstMisbIrUnpackClass * klass)
   g_object_class_install_property (G_OBJECT_CLASS (klass),
       PROP_OFFSET, g_param_spec_int ("offset",
           "Offset value",
-          "Offset value to apply during unpacking", -0xffff, 0xffff,
+          "Offset value to apply during unpacking, as is for both v210 and "
+          "UYVY", -0xffff, 0xffff,
           DEFAULT_PROP_OFFSET, G_PARAM_STATIC_STRINGS | G_PARAM_READWRITE));
   g_object_class_install_property (G_OBJECT_CLASS (klass),
       PROP_SHIFT, g_param_spec_uint ("shift",
@@ -181,6 +208,11 @@ gst_misb_ir_unpack_class_init (GstMisbIrUnpackClass * klass)
           "Chroma mask",
           "Mask to bitwise AND with chroma after applying offset", 0, 0xffff,
           DEFAULT_PROP_LUMA_MASK, G_PARAM_STATIC_STRINGS | G_PARAM_READWRITE));
+  g_object_class_install_property (G_OBJECT_CLASS (klass),
+      PROP_N_THREADS, g_param_spec_uint ("n-threads", "Threads",
+          "Number of threads to split each frame across (0 = number of "
+          "processors)", 0, G_MAXINT, DEFAULT_PROP_N_THREADS,
+          G_PARAM_STATIC_STRINGS | G_PARAM_READWRITE));
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&gst_misb_ir_unpack_sink_template));
@@ -195,6 +227,9 @@ gst_misb_ir_unpack_class_init (GstMisbIrUnpackClass * klass)
   /* Register GstBaseTransform vmethods */
   gstbasetransform_class->transform_caps =
       GST_DEBUG_FUNCPTR (gst_misb_ir_unpack_transform_caps);
+  gstbasetransform_class->transform_ip =
+      GST_DEBUG_FUNCPTR (gst_misb_ir_unpack_transform_ip);
+  gstbasetransform_class->stop = GST_DEBUG_FUNCPTR (gst_misb_ir_unpack_stop);
 
   gstvideofilter_class->set_info =
       GST_DEBUG_FUNCPTR (gst_misb_ir_unpack_set_info);
@@ -212,6 +247,7 @@ gst_misb_ir_unpack_init (GstMisbIrUnpack * filt)
   filt->swap = DEFAULT_PROP_SWAP;
   filt->luma_mask = DEFAULT_PROP_LUMA_MASK;
   filt->chroma_mask = DEFAULT_PROP_CHROMA_MASK;
+  filt->n_threads = DEFAULT_PROP_N_THREADS;
 
   gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filt), FALSE);
 
@@ -242,10 +278,19 @@ gst_misb_ir_unpack_set_property (GObject * object, guint prop_id,
     case PROP_CHROMA_MASK:
       filt->chroma_mask = g_value_get_uint (value);
       break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (filt);
+      filt->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (filt);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
   }
+
+  /* the identity is only picked up when the caps are set again */
+  if (gst_misb_ir_unpack_is_identity (filt) != filt->identity)
+    gst_base_transform_reconfigure_src (GST_BASE_TRANSFORM (filt));
 }
 
 static void
@@ -272,6 +317,11 @@ gst_misb_ir_unpack_get_property (GObject * object, guint prop_id,
     case PROP_CHROMA_MASK:
       g_value_set_uint (value, filt->chroma_mask);
       break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (filt);
+      g_value_set_uint (value, filt->n_threads);
+      GST_OBJECT_UNLOCK (filt);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -337,19 +387,228 @@ gst_misb_ir_unpack_set_info (GstVideoFilter * filter, GstCaps * incaps,
   memcpy (&filt->info_in, in_info, sizeof (GstVideoInfo));
   memcpy (&filt->info_out, out_info, sizeof (GstVideoInfo));
 
+  filt->identity = gst_misb_ir_unpack_is_identity (filt);
+  GST_DEBUG_OBJECT (filt, "%s UYVY reinterpretation",
+      filt->identity ? "Using" : "Not using");
+  gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filt), filt->identity);
+
+  /* downstream support for video meta is queried on the first buffer */
+  filt->video_meta_checked = FALSE;
+  filt->video_meta_warned = FALSE;
+
   return res;
 }
 
+/**
+ * gst_misb_ir_unpack_is_identity:
+ * @filt: #GstMisbIrUnpack
+ *
+ * With UYVY input, no swap, a shift of 8, no offset and masks keeping all
+ * 8 bits, each GRAY16_LE pixel has the same bytes as the UYVY pixel. Then
+ * buffers are relabelled in place instead of unpacked.
+ *
+ * Returns: whether the current caps and properties allow relabelling
+ */
+static gboolean
+gst_misb_ir_unpack_is_identity (GstMisbIrUnpack * filt)
+{
+  return GST_VIDEO_INFO_FORMAT (&filt->info_in) == GST_VIDEO_FORMAT_UYVY &&
+      !filt->swap && filt->shift_value == 8 && filt->offset_value == 0 &&
+      (filt->chroma_mask & 0xff) == 0xff && (filt->luma_mask & 0xff) == 0xff;
+}
+
+/**
+ * gst_misb_ir_unpack_check_video_meta:
+ * @filt: #GstMisbIrUnpack
+ *
+ * Ask downstream whether it supports video meta. In place transforms skip
+ * the allocation query of #GstBaseTransform, so send one here.
+ */
+static void
+gst_misb_ir_unpack_check_video_meta (GstMisbIrUnpack * filt)
+{
+  GstCaps *caps;
+  GstQuery *query;
+
+  caps = gst_video_info_to_caps (&filt->info_out);
+  query = gst_query_new_allocation (caps, FALSE);
+  if (gst_pad_peer_query (GST_BASE_TRANSFORM_SRC_PAD (filt), query))
+    filt->use_video_meta = gst_query_find_allocation_meta (query,
+        GST_VIDEO_META_API_TYPE, NULL);
+  else
+    filt->use_video_meta = FALSE;
+  gst_query_unref (query);
+  gst_caps_unref (caps);
+
+  GST_DEBUG_OBJECT (filt, "Downstream %s video meta",
+      filt->use_video_meta ? "supports" : "doesn't support");
+  filt->video_meta_checked = TRUE;
+}
+
+/**
+ * gst_misb_ir_unpack_transform_ip:
+ * @trans: #GstBaseTransform
+ * @buf: #GstBuffer
+ *
+ * Relabel a UYVY buffer as GRAY16_LE, keeping the layout of any video meta
+ */
+static GstFlowReturn
+gst_misb_ir_unpack_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
+{
+  GstMisbIrUnpack *filt = GST_MISB_IR_UNPACK (trans);
+  GstVideoMeta *meta;
+  gsize offset[GST_VIDEO_MAX_PLANES] = { 0, };
+  gint stride[GST_VIDEO_MAX_PLANES] = { 0, };
+
+  GST_LOG_OBJECT (filt, "in-place transform, replacing video meta");
+
+  stride[0] = GST_VIDEO_INFO_PLANE_STRIDE (&filt->info_in, 0);
+  meta = gst_buffer_get_video_meta (buf);
+  if (meta) {
+    offset[0] = meta->offset[0];
+    stride[0] = meta->stride[0];
+  }
+  while ((meta = gst_buffer_get_video_meta (buf)))
+    gst_buffer_remove_meta (buf, GST_META_CAST (meta));
+
+  if (!filt->video_meta_checked)
+    gst_misb_ir_unpack_check_video_meta (filt);
+
+  if (!filt->use_video_meta && !filt->video_meta_warned && (offset[0] != 0 ||
+          stride[0] != GST_VIDEO_INFO_PLANE_STRIDE (&filt->info_out, 0))) {
+    filt->video_meta_warned = TRUE;
+    GST_WARNING_OBJECT (filt, "Downstream doesn't support video meta, frame "
+        "with offset %" G_GSIZE_FORMAT " and stride %d will be misread",
+        offset[0], stride[0]);
+  }
+
+  gst_buffer_add_video_meta_full (buf, GST_VIDEO_FRAME_FLAG_NONE,
+      GST_VIDEO_INFO_FORMAT (&filt->info_out),
+      GST_VIDEO_INFO_WIDTH (&filt->info_out),
+      GST_VIDEO_INFO_HEIGHT (&filt->info_out), 1, offset, stride);
+
+  return GST_FLOW_OK;
+}
+
+/**
+ * gst_misb_ir_unpack_unpack_stripe:
+ * @data: #GstMisbIrUnpackStripe
+ *
+ * Unpack the rows of one stripe. v210 rows hold whole groups of six
+ * pixels, so every group of three can be unpacked, and only the store has
+ * to stop at the width.
+ */
+static void
+gst_misb_ir_unpack_unpack_stripe (gpointer data)
+{
+  GstMisbIrUnpackStripe *stripe = data;
+  GstVideoFrame *in_frame = stripe->in_frame;
+  GstVideoFrame *out_frame = stripe->out_frame;
+  const gint width = GST_VIDEO_FRAME_COMP_WIDTH (in_frame, 0);
+  const gboolean v210 =
+      GST_VIDEO_FRAME_FORMAT (in_frame) == GST_VIDEO_FORMAT_v210;
+  gint y;
+
+  for (y = stripe->y_start; y < stripe->y_end; y++) {
+    const guint8 *src = GST_VIDEO_FRAME_COMP_DATA (in_frame, 0) +
+        y * GST_VIDEO_FRAME_COMP_STRIDE (in_frame, 0);
+    guint16 *dst = (guint16 *) (GST_VIDEO_FRAME_COMP_DATA (out_frame, 0) +
+        y * GST_VIDEO_FRAME_COMP_STRIDE (out_frame, 0));
+
+    if (v210) {
+      /* each pair of words holds three pixels */
+      (stripe->swap ? misb_orc_unpack_v210_swap : misb_orc_unpack_v210)
+          (stripe->groups, (const guint32 *) src, stripe->offset,
+          stripe->chroma_mask, stripe->luma_mask, stripe->shift,
+          GST_VISION_V210_N_GROUPS (width));
+      gst_vision_v210_store_groups (dst, stripe->groups, width);
+    } else {
+      (stripe->swap ? misb_orc_unpack_uyvy_swap : misb_orc_unpack_uyvy)
+          (dst, src, stripe->offset, stripe->chroma_mask, stripe->luma_mask,
+          stripe->shift, width);
+    }
+  }
+}
+
+/**
+ * gst_misb_ir_unpack_free_stripes:
+ * @filt: #GstMisbIrUnpack
+ *
+ * Stop the worker threads and free the per-stripe state
+ */
+static void
+gst_misb_ir_unpack_free_stripes (GstMisbIrUnpack * filt)
+{
+  gint i, n;
+
+  if (filt->runner == NULL)
+    return;
+
+  n = gst_vision_task_runner_get_n_threads (filt->runner);
+  for (i = 0; i < n; i++)
+    g_free (filt->stripes[i].groups);
+  g_free (filt->stripes);
+  g_free (filt->stripe_data);
+  gst_vision_task_runner_free (filt->runner);
+
+  filt->stripes = NULL;
+  filt->stripe_data = NULL;
+  filt->runner = NULL;
+  filt->stripes_width = 0;
+}
+
+/**
+ * gst_misb_ir_unpack_setup_stripes:
+ * @filt: #GstMisbIrUnpack
+ * @width: width of the frame
+ *
+ * (Re)create the worker threads if the number of threads or the width
+ * changed
+ */
+static void
+gst_misb_ir_unpack_setup_stripes (GstMisbIrUnpack * filt, gint width)
+{
+  const gint n_groups = GST_VISION_V210_N_GROUPS (width);
+  guint n_threads;
+  gint i;
+
+  GST_OBJECT_LOCK (filt);
+  n_threads = filt->n_threads;
+  GST_OBJECT_UNLOCK (filt);
+
+  if (n_threads == 0)
+    n_threads = g_get_num_processors ();
+
+  if (filt->runner != NULL &&
+      gst_vision_task_runner_get_n_threads (filt->runner) == n_threads &&
+      filt->stripes_width == width)
+    return;
+
+  gst_misb_ir_unpack_free_stripes (filt);
+
+  GST_DEBUG_OBJECT (filt, "Using %u threads", n_threads);
+
+  filt->runner = gst_vision_task_runner_new (n_threads);
+  filt->stripes = g_new0 (GstMisbIrUnpackStripe, n_threads);
+  filt->stripe_data = g_new (gpointer, n_threads);
+  for (i = 0; i < n_threads; i++) {
+    GstMisbIrUnpackStripe *stripe = &filt->stripes[i];
+
+    stripe->filt = filt;
+    stripe->groups = g_new (guint64, n_groups);
+    filt->stripe_data[i] = stripe;
+  }
+  filt->stripes_width = width;
+}
+
 static GstFlowReturn
 gst_misb_ir_unpack_transform_frame (GstVideoFilter * filter,
     GstVideoFrame * in_frame, GstVideoFrame * out_frame)
 {
   GstMisbIrUnpack *filt = GST_MISB_IR_UNPACK (filter);
   GTimer *timer = NULL;
-  gint16 offset = filt->offset_value;
-  guint shift = filt->shift_value;
-  gint x, y;
-  guint16 *dst;
+  gint height = GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, 0);
+  gint i, n;
 
   GST_LOG_OBJECT (filt, "Performing non-inplace transform");
 
@@ -357,73 +616,26 @@ gst_misb_ir_unpack_transform_frame (GstVideoFilter * filter,
   timer = g_timer_new ();
 #endif
 
-  if (filt->info_in.finfo->format == GST_VIDEO_FORMAT_v210) {
-    for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, 0); y++) {
-      guint32 *src = (guint32 *) (GST_VIDEO_FRAME_COMP_DATA (in_frame, 0) +
-          y * GST_VIDEO_FRAME_COMP_STRIDE (in_frame, 0));
-      dst = (guint16 *) (GST_VIDEO_FRAME_COMP_DATA (out_frame, 0) +
-          y * GST_VIDEO_FRAME_COMP_STRIDE (out_frame, 0));
-      for (x = 0; x < GST_VIDEO_FRAME_COMP_WIDTH (in_frame, 0);) {
-        guint32 word0 = *src++;
-        guint32 word1 = *src++;
-        guint16 luma, chroma, temp;
-
-        chroma = word0 & 0x3ff;
-        luma = (word0 & 0xffc00) >> 10;
-        if (filt->swap) {
-          temp = chroma;
-          chroma = luma;
-          luma = temp;
-        }
-        dst[x++] =
-            ((chroma + offset) & filt->chroma_mask) | (((luma +
-                    offset) & filt->luma_mask) << shift);
-
-        chroma = (word0 & 0x3ff00000) >> 20;
-        luma = word1 & 0x3ff;
-        if (filt->swap) {
-          temp = chroma;
-          chroma = luma;
-          luma = temp;
-        }
-        dst[x++] =
-            (chroma + offset) & filt->chroma_mask | ((luma +
-                offset) & filt->luma_mask) << shift;
-
-        chroma = (word1 & 0xffc00) >> 10;
-        luma = (word1 & 0x3ff00000) >> 20;
-        if (filt->swap) {
-          temp = chroma;
-          chroma = luma;
-          luma = temp;
-        }
-        dst[x++] =
-            (chroma + offset) & filt->chroma_mask | ((luma +
-                offset) & filt->luma_mask) << shift;
-      }
-    }
-  } else if (filt->info_in.finfo->format == GST_VIDEO_FORMAT_UYVY) {
-    for (y = 0; y < GST_VIDEO_FRAME_COMP_HEIGHT (in_frame, 0); y++) {
-      guint8 *src = (guint8 *) (GST_VIDEO_FRAME_COMP_DATA (in_frame, 0) +
-          y * GST_VIDEO_FRAME_COMP_STRIDE (in_frame, 0));
-      dst = (guint16 *) (GST_VIDEO_FRAME_COMP_DATA (out_frame, 0) +
-          y * GST_VIDEO_FRAME_COMP_STRIDE (out_frame, 0));
-      for (x = 0; x < GST_VIDEO_FRAME_COMP_WIDTH (in_frame, 0);) {
-        guint8 chroma = *src++;
-        guint8 luma = *src++;
-        guint8 temp;
-
-        if (filt->swap) {
-          temp = chroma;
-          chroma = luma;
-          luma = temp;
-        }
-        dst[x++] =
-            ((chroma + offset) & filt->chroma_mask) | (((luma +
-                    offset) & filt->luma_mask) << shift);
-      }
-    }
+  gst_misb_ir_unpack_setup_stripes (filt,
+      GST_VIDEO_FRAME_COMP_WIDTH (in_frame, 0));
+  n = gst_vision_task_runner_get_n_threads (filt->runner);
+  for (i = 0; i < n; i++) {
+    GstMisbIrUnpackStripe *stripe = &filt->stripes[i];
+
+    stripe->in_frame = in_frame;
+    stripe->out_frame = out_frame;
+    stripe->offset = filt->offset_value;
+    stripe->shift = filt->shift_value;
+    stripe->luma_mask = filt->luma_mask;
+    stripe->chroma_mask = filt->chroma_mask;
+    stripe->swap = filt->swap;
+    stripe->y_start = height * i / n;
+    stripe->y_end = height * (i + 1) / n;
   }
+
+  gst_vision_task_runner_run (filt->runner, gst_misb_ir_unpack_unpack_stripe,
+      filt->stripe_data);
+
 #if 0
   GST_LOG_OBJECT (filt, "Processing took %.3f ms", g_timer_elapsed (timer,
           NULL) * 1000);
@@ -433,10 +645,21 @@ gst_misb_ir_unpack_transform_frame (GstVideoFilter * filter,
   return GST_FLOW_OK;
 }
 
+static gboolean
+gst_misb_ir_unpack_stop (GstBaseTransform * trans)
+{
+  GstMisbIrUnpack *filt = GST_MISB_IR_UNPACK (trans);
+
+  gst_misb_ir_unpack_free_stripes (filt);
+
+  return TRUE;
+}
 
 static void
 gst_misb_ir_unpack_reset (GstMisbIrUnpack * misb_ir_unpack)
 {
   gst_video_info_init (&misb_ir_unpack->info_in);
   gst_video_info_init (&misb_ir_unpack->info_out);
+
+  gst_misb_ir_unpack_free_stripes (misb_ir_unpack);
 }
@@ -28,6 +28,8 @@
 #include <gst/video/gstvideofilter.h>
 #include <gst/video/video.h>
 
+#include "gstvisiontaskrunner.h"
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_MISB_IR_UNPACK \
@@ -43,6 +45,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstMisbIrUnpack GstMisbIrUnpack;
 typedef struct _GstMisbIrUnpackClass GstMisbIrUnpackClass;
+typedef struct _GstMisbIrUnpackStripe GstMisbIrUnpackStripe;
 
 /**
 * GstMisbIrUnpack:
@@ -65,6 +68,19 @@ struct _GstMisbIrUnpack
   gboolean swap;
   guint luma_mask;
   guint chroma_mask;
+  guint n_threads;
+
+  /* threading */
+  GstVisionTaskRunner *runner;
+  GstMisbIrUnpackStripe *stripes;
+  gpointer *stripe_data;
+  gint stripes_width;
+
+  /* UYVY to GRAY16_LE is a byte reinterpretation, relabel in place */
+  gboolean identity;
+  gboolean use_video_meta;
+  gboolean video_meta_checked;
+  gboolean video_meta_warned;
 };
 
 struct _GstMisbIrUnpackClass
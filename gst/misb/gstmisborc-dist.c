@@ -0,0 +1,2053 @@
+#include "gstmisborc-dist.h"
+/* autogenerated from gstmisborc.orc */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifndef _ORC_INTEGER_TYPEDEFS_
+#define _ORC_INTEGER_TYPEDEFS_
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#include <stdint.h>
+typedef int8_t orc_int8;
+typedef int16_t orc_int16;
+typedef int32_t orc_int32;
+typedef int64_t orc_int64;
+typedef uint8_t orc_uint8;
+typedef uint16_t orc_uint16;
+typedef uint32_t orc_uint32;
+typedef uint64_t orc_uint64;
+#define ORC_UINT64_C(x) UINT64_C(x)
+#elif defined(_MSC_VER)
+typedef signed __int8 orc_int8;
+typedef signed __int16 orc_int16;
+typedef signed __int32 orc_int32;
+typedef signed __int64 orc_int64;
+typedef unsigned __int8 orc_uint8;
+typedef unsigned __int16 orc_uint16;
+typedef unsigned __int32 orc_uint32;
+typedef unsigned __int64 orc_uint64;
+#define ORC_UINT64_C(x) (x##Ui64)
+#define inline __inline
+#else
+#include <limits.h>
+typedef signed char orc_int8;
+typedef short orc_int16;
+typedef int orc_int32;
+typedef unsigned char orc_uint8;
+typedef unsigned short orc_uint16;
+typedef unsigned int orc_uint32;
+#if INT_MAX == LONG_MAX
+typedef long long orc_int64;
+typedef unsigned long long orc_uint64;
+#define ORC_UINT64_C(x) (x##ULL)
+#else
+typedef long orc_int64;
+typedef unsigned long orc_uint64;
+#define ORC_UINT64_C(x) (x##UL)
+#endif
+#endif
+typedef union { orc_int16 i; orc_int8 x2[2]; } orc_union16;
+typedef union { orc_int32 i; float f; orc_int16 x2[2]; orc_int8 x4[4]; } orc_union32;
+typedef union { orc_int64 i; double f; orc_int32 x2[2]; float x2f[2]; orc_int16 x4[4]; } orc_union64;
+#endif
+#ifndef ORC_RESTRICT
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define ORC_RESTRICT restrict
+#elif defined(__GNUC__) && __GNUC__ >= 4
+#define ORC_RESTRICT __restrict__
+#else
+#define ORC_RESTRICT
+#endif
+#endif
+
+#ifndef ORC_INTERNAL
+#if defined(__SUNPRO_C) && (__SUNPRO_C >= 0x590)
+#define ORC_INTERNAL __attribute__((visibility("hidden")))
+#elif defined(__SUNPRO_C) && (__SUNPRO_C >= 0x550)
+#define ORC_INTERNAL __hidden
+#elif defined (__GNUC__)
+#define ORC_INTERNAL __attribute__((visibility("hidden")))
+#else
+#define ORC_INTERNAL
+#endif
+#endif
+
+
+#ifndef DISABLE_ORC
+#include <orc/orc.h>
+#endif
+void misb_orc_unpack_v210 (guint64 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n);
+void misb_orc_unpack_v210_swap (guint64 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n);
+void misb_orc_unpack_uyvy (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n);
+void misb_orc_unpack_uyvy_swap (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n);
+void misb_orc_pack_v210 (guint32 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int p2, int p3, int p4, int n);
+void misb_orc_pack_uyvy (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n);
+void misb_orc_pack_uyvy_gray8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int n);
+
+
+/* begin Orc C target preamble */
+#define ORC_CLAMP(x,a,b) ((x)<(a) ? (a) : ((x)>(b) ? (b) : (x)))
+#define ORC_ABS(a) ((a)<0 ? -(a) : (a))
+#define ORC_MIN(a,b) ((a)<(b) ? (a) : (b))
+#define ORC_MAX(a,b) ((a)>(b) ? (a) : (b))
+#define ORC_SB_MAX 127
+#define ORC_SB_MIN (-1-ORC_SB_MAX)
+#define ORC_UB_MAX 255
+#define ORC_UB_MIN 0
+#define ORC_SW_MAX 32767
+#define ORC_SW_MIN (-1-ORC_SW_MAX)
+#define ORC_UW_MAX 65535
+#define ORC_UW_MIN 0
+#define ORC_SL_MAX 2147483647
+#define ORC_SL_MIN (-1-ORC_SL_MAX)
+#define ORC_UL_MAX 4294967295U
+#define ORC_UL_MIN 0
+#define ORC_CLAMP_SB(x) ORC_CLAMP(x,ORC_SB_MIN,ORC_SB_MAX)
+#define ORC_CLAMP_UB(x) ORC_CLAMP(x,ORC_UB_MIN,ORC_UB_MAX)
+#define ORC_CLAMP_SW(x) ORC_CLAMP(x,ORC_SW_MIN,ORC_SW_MAX)
+#define ORC_CLAMP_UW(x) ORC_CLAMP(x,ORC_UW_MIN,ORC_UW_MAX)
+#define ORC_CLAMP_SL(x) ORC_CLAMP(x,ORC_SL_MIN,ORC_SL_MAX)
+#define ORC_CLAMP_UL(x) ORC_CLAMP(x,ORC_UL_MIN,ORC_UL_MAX)
+#define ORC_SWAP_W(x) ((((x)&0xffU)<<8) | (((x)&0xff00U)>>8))
+#define ORC_SWAP_L(x) ((((x)&0xffU)<<24) | (((x)&0xff00U)<<8) | (((x)&0xff0000U)>>8) | (((x)&0xff000000U)>>24))
+#define ORC_SWAP_Q(x) ((((x)&ORC_UINT64_C(0xff))<<56) | (((x)&ORC_UINT64_C(0xff00))<<40) | (((x)&ORC_UINT64_C(0xff0000))<<24) | (((x)&ORC_UINT64_C(0xff000000))<<8) | (((x)&ORC_UINT64_C(0xff00000000))>>8) | (((x)&ORC_UINT64_C(0xff0000000000))>>24) | (((x)&ORC_UINT64_C(0xff000000000000))>>40) | (((x)&ORC_UINT64_C(0xff00000000000000))>>56))
+#define ORC_PTR_OFFSET(ptr,offset) ((void *)(((unsigned char *)(ptr)) + (offset)))
+#define ORC_DENORMAL(x) ((x) & ((((x)&0x7f800000) == 0) ? 0xff800000 : 0xffffffff))
+#define ORC_ISNAN(x) ((((x)&0x7f800000) == 0x7f800000) && (((x)&0x007fffff) != 0))
+#define ORC_DENORMAL_DOUBLE(x) ((x) & ((((x)&ORC_UINT64_C(0x7ff0000000000000)) == 0) ? ORC_UINT64_C(0xfff0000000000000) : ORC_UINT64_C(0xffffffffffffffff)))
+#define ORC_ISNAN_DOUBLE(x) ((((x)&ORC_UINT64_C(0x7ff0000000000000)) == ORC_UINT64_C(0x7ff0000000000000)) && (((x)&ORC_UINT64_C(0x000fffffffffffff)) != 0))
+#ifndef ORC_RESTRICT
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define ORC_RESTRICT restrict
+#elif defined(__GNUC__) && __GNUC__ >= 4
+#define ORC_RESTRICT __restrict__
+#else
+#define ORC_RESTRICT
+#endif
+#endif
+/* end Orc C target preamble */
+
+
+
+/* misb_orc_unpack_v210 */
+#ifdef DISABLE_ORC
+void
+misb_orc_unpack_v210 (guint64 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n){
+  int i;
+  orc_union64 * ORC_RESTRICT ptr0;
+  const orc_union64 * ORC_RESTRICT ptr4;
+  orc_union64 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union16 var41;
+  orc_union64 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union16 var46;
+  orc_union16 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+
+  ptr0 = (orc_union64 *)d1;
+  ptr4 = (orc_union64 *)s1;
+
+  /* 0: loadpl */
+  var38.i = 1023;
+  /* 1: loadpl */
+  var39.i = 10;
+  /* 2: loadpl */
+  var40.i = 20;
+  /* 3: loadpw */
+  var41.i = 0;
+  /* 4: loadpw */
+  var34.i = p1;
+  /* 5: loadpw */
+  var35.i = p2;
+  /* 6: loadpw */
+  var36.i = p3;
+  /* 7: loadpw */
+  var37.i = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 8: loadq */
+    var33 = ptr4[i];
+    /* 9: select0ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var43.i = _src.x2[0];
+    }
+    /* 10: select1ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var44.i = _src.x2[1];
+    }
+    /* 11: andl */
+    var45.i = var43.i & var38.i;
+    /* 12: convlw */
+    var46.i = var45.i;
+    /* 13: shrul */
+    var45.i = ((orc_uint32)var43.i) >> var39.i;
+    /* 14: andl */
+    var45.i = var45.i & var38.i;
+    /* 15: convlw */
+    var47.i = var45.i;
+    /* 16: addw */
+    var46.i = var46.i + var34.i;
+    /* 17: andw */
+    var46.i = var46.i & var35.i;
+    /* 18: addw */
+    var47.i = var47.i + var34.i;
+    /* 19: andw */
+    var47.i = var47.i & var36.i;
+    /* 20: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 21: orw */
+    var48.i = var46.i | var47.i;
+    /* 22: shrul */
+    var45.i = ((orc_uint32)var43.i) >> var40.i;
+    /* 23: andl */
+    var45.i = var45.i & var38.i;
+    /* 24: convlw */
+    var46.i = var45.i;
+    /* 25: andl */
+    var45.i = var44.i & var38.i;
+    /* 26: convlw */
+    var47.i = var45.i;
+    /* 27: addw */
+    var46.i = var46.i + var34.i;
+    /* 28: andw */
+    var46.i = var46.i & var35.i;
+    /* 29: addw */
+    var47.i = var47.i + var34.i;
+    /* 30: andw */
+    var47.i = var47.i & var36.i;
+    /* 31: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 32: orw */
+    var49.i = var46.i | var47.i;
+    /* 33: shrul */
+    var45.i = ((orc_uint32)var44.i) >> var39.i;
+    /* 34: andl */
+    var45.i = var45.i & var38.i;
+    /* 35: convlw */
+    var46.i = var45.i;
+    /* 36: shrul */
+    var45.i = ((orc_uint32)var44.i) >> var40.i;
+    /* 37: andl */
+    var45.i = var45.i & var38.i;
+    /* 38: convlw */
+    var47.i = var45.i;
+    /* 39: addw */
+    var46.i = var46.i + var34.i;
+    /* 40: andw */
+    var46.i = var46.i & var35.i;
+    /* 41: addw */
+    var47.i = var47.i + var34.i;
+    /* 42: andw */
+    var47.i = var47.i & var36.i;
+    /* 43: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 44: orw */
+    var50.i = var46.i | var47.i;
+    /* 45: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var48.i;
+     _dest.x2[1] = var49.i;
+     var51.i = _dest.i;
+    }
+    /* 46: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var50.i;
+     _dest.x2[1] = var41.i;
+     var52.i = _dest.i;
+    }
+    /* 47: mergelq */
+    {
+     orc_union64 _dest;
+     _dest.x2[0] = var51.i;
+     _dest.x2[1] = var52.i;
+     var42.i = _dest.i;
+    }
+    /* 48: storeq */
+    ptr0[i] = var42;
+  }
+
+}
+
+#else
+static void
+_backup_misb_orc_unpack_v210 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 * ORC_RESTRICT ptr0;
+  const orc_union64 * ORC_RESTRICT ptr4;
+  orc_union64 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union16 var41;
+  orc_union64 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union16 var46;
+  orc_union16 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+
+  ptr0 = (orc_union64 *)ex->arrays[0];
+  ptr4 = (orc_union64 *)ex->arrays[4];
+
+  /* 0: loadpl */
+  var38.i = 1023;
+  /* 1: loadpl */
+  var39.i = 10;
+  /* 2: loadpl */
+  var40.i = 20;
+  /* 3: loadpw */
+  var41.i = 0;
+  /* 4: loadpw */
+  var34.i = ex->params[24];
+  /* 5: loadpw */
+  var35.i = ex->params[25];
+  /* 6: loadpw */
+  var36.i = ex->params[26];
+  /* 7: loadpw */
+  var37.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 8: loadq */
+    var33 = ptr4[i];
+    /* 9: select0ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var43.i = _src.x2[0];
+    }
+    /* 10: select1ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var44.i = _src.x2[1];
+    }
+    /* 11: andl */
+    var45.i = var43.i & var38.i;
+    /* 12: convlw */
+    var46.i = var45.i;
+    /* 13: shrul */
+    var45.i = ((orc_uint32)var43.i) >> var39.i;
+    /* 14: andl */
+    var45.i = var45.i & var38.i;
+    /* 15: convlw */
+    var47.i = var45.i;
+    /* 16: addw */
+    var46.i = var46.i + var34.i;
+    /* 17: andw */
+    var46.i = var46.i & var35.i;
+    /* 18: addw */
+    var47.i = var47.i + var34.i;
+    /* 19: andw */
+    var47.i = var47.i & var36.i;
+    /* 20: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 21: orw */
+    var48.i = var46.i | var47.i;
+    /* 22: shrul */
+    var45.i = ((orc_uint32)var43.i) >> var40.i;
+    /* 23: andl */
+    var45.i = var45.i & var38.i;
+    /* 24: convlw */
+    var46.i = var45.i;
+    /* 25: andl */
+    var45.i = var44.i & var38.i;
+    /* 26: convlw */
+    var47.i = var45.i;
+    /* 27: addw */
+    var46.i = var46.i + var34.i;
+    /* 28: andw */
+    var46.i = var46.i & var35.i;
+    /* 29: addw */
+    var47.i = var47.i + var34.i;
+    /* 30: andw */
+    var47.i = var47.i & var36.i;
+    /* 31: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 32: orw */
+    var49.i = var46.i | var47.i;
+    /* 33: shrul */
+    var45.i = ((orc_uint32)var44.i) >> var39.i;
+    /* 34: andl */
+    var45.i = var45.i & var38.i;
+    /* 35: convlw */
+    var46.i = var45.i;
+    /* 36: shrul */
+    var45.i = ((orc_uint32)var44.i) >> var40.i;
+    /* 37: andl */
+    var45.i = var45.i & var38.i;
+    /* 38: convlw */
+    var47.i = var45.i;
+    /* 39: addw */
+    var46.i = var46.i + var34.i;
+    /* 40: andw */
+    var46.i = var46.i & var35.i;
+    /* 41: addw */
+    var47.i = var47.i + var34.i;
+    /* 42: andw */
+    var47.i = var47.i & var36.i;
+    /* 43: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 44: orw */
+    var50.i = var46.i | var47.i;
+    /* 45: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var48.i;
+     _dest.x2[1] = var49.i;
+     var51.i = _dest.i;
+    }
+    /* 46: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var50.i;
+     _dest.x2[1] = var41.i;
+     var52.i = _dest.i;
+    }
+    /* 47: mergelq */
+    {
+     orc_union64 _dest;
+     _dest.x2[0] = var51.i;
+     _dest.x2[1] = var52.i;
+     var42.i = _dest.i;
+    }
+    /* 48: storeq */
+    ptr0[i] = var42;
+  }
+
+}
+
+void
+misb_orc_unpack_v210 (guint64 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "misb_orc_unpack_v210");
+      orc_program_set_backup_function (p, _backup_misb_orc_unpack_v210);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 4, 0x000003ff, "c1");
+      orc_program_add_constant (p, 4, 0x0000000a, "c2");
+      orc_program_add_constant (p, 4, 0x00000014, "c3");
+      orc_program_add_constant (p, 2, 0x00000000, "c4");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_parameter (p, 2, "p3");
+      orc_program_add_parameter (p, 2, "p4");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+      orc_program_add_temporary (p, 2, "t4");
+      orc_program_add_temporary (p, 2, "t5");
+      orc_program_add_temporary (p, 2, "t6");
+      orc_program_add_temporary (p, 2, "t7");
+      orc_program_add_temporary (p, 2, "t8");
+      orc_program_add_temporary (p, 4, "t9");
+      orc_program_add_temporary (p, 4, "t10");
+
+      orc_program_append_2 (p, "select0ql", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1ql", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 0, ORC_VAR_T6, ORC_VAR_T4, ORC_VAR_T5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 0, ORC_VAR_T7, ORC_VAR_T4, ORC_VAR_T5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 0, ORC_VAR_T8, ORC_VAR_T4, ORC_VAR_T5, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T9, ORC_VAR_T6, ORC_VAR_T7, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T10, ORC_VAR_T8, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T9, ORC_VAR_T10, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* misb_orc_unpack_v210_swap */
+#ifdef DISABLE_ORC
+void
+misb_orc_unpack_v210_swap (guint64 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n){
+  int i;
+  orc_union64 * ORC_RESTRICT ptr0;
+  const orc_union64 * ORC_RESTRICT ptr4;
+  orc_union64 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union16 var41;
+  orc_union64 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union16 var46;
+  orc_union16 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+
+  ptr0 = (orc_union64 *)d1;
+  ptr4 = (orc_union64 *)s1;
+
+  /* 0: loadpl */
+  var38.i = 1023;
+  /* 1: loadpl */
+  var39.i = 10;
+  /* 2: loadpl */
+  var40.i = 20;
+  /* 3: loadpw */
+  var41.i = 0;
+  /* 4: loadpw */
+  var34.i = p1;
+  /* 5: loadpw */
+  var35.i = p2;
+  /* 6: loadpw */
+  var36.i = p3;
+  /* 7: loadpw */
+  var37.i = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 8: loadq */
+    var33 = ptr4[i];
+    /* 9: select0ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var43.i = _src.x2[0];
+    }
+    /* 10: select1ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var44.i = _src.x2[1];
+    }
+    /* 11: andl */
+    var45.i = var43.i & var38.i;
+    /* 12: convlw */
+    var47.i = var45.i;
+    /* 13: shrul */
+    var45.i = ((orc_uint32)var43.i) >> var39.i;
+    /* 14: andl */
+    var45.i = var45.i & var38.i;
+    /* 15: convlw */
+    var46.i = var45.i;
+    /* 16: addw */
+    var46.i = var46.i + var34.i;
+    /* 17: andw */
+    var46.i = var46.i & var35.i;
+    /* 18: addw */
+    var47.i = var47.i + var34.i;
+    /* 19: andw */
+    var47.i = var47.i & var36.i;
+    /* 20: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 21: orw */
+    var48.i = var46.i | var47.i;
+    /* 22: shrul */
+    var45.i = ((orc_uint32)var43.i) >> var40.i;
+    /* 23: andl */
+    var45.i = var45.i & var38.i;
+    /* 24: convlw */
+    var47.i = var45.i;
+    /* 25: andl */
+    var45.i = var44.i & var38.i;
+    /* 26: convlw */
+    var46.i = var45.i;
+    /* 27: addw */
+    var46.i = var46.i + var34.i;
+    /* 28: andw */
+    var46.i = var46.i & var35.i;
+    /* 29: addw */
+    var47.i = var47.i + var34.i;
+    /* 30: andw */
+    var47.i = var47.i & var36.i;
+    /* 31: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 32: orw */
+    var49.i = var46.i | var47.i;
+    /* 33: shrul */
+    var45.i = ((orc_uint32)var44.i) >> var39.i;
+    /* 34: andl */
+    var45.i = var45.i & var38.i;
+    /* 35: convlw */
+    var47.i = var45.i;
+    /* 36: shrul */
+    var45.i = ((orc_uint32)var44.i) >> var40.i;
+    /* 37: andl */
+    var45.i = var45.i & var38.i;
+    /* 38: convlw */
+    var46.i = var45.i;
+    /* 39: addw */
+    var46.i = var46.i + var34.i;
+    /* 40: andw */
+    var46.i = var46.i & var35.i;
+    /* 41: addw */
+    var47.i = var47.i + var34.i;
+    /* 42: andw */
+    var47.i = var47.i & var36.i;
+    /* 43: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 44: orw */
+    var50.i = var46.i | var47.i;
+    /* 45: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var48.i;
+     _dest.x2[1] = var49.i;
+     var51.i = _dest.i;
+    }
+    /* 46: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var50.i;
+     _dest.x2[1] = var41.i;
+     var52.i = _dest.i;
+    }
+    /* 47: mergelq */
+    {
+     orc_union64 _dest;
+     _dest.x2[0] = var51.i;
+     _dest.x2[1] = var52.i;
+     var42.i = _dest.i;
+    }
+    /* 48: storeq */
+    ptr0[i] = var42;
+  }
+
+}
+
+#else
+static void
+_backup_misb_orc_unpack_v210_swap (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 * ORC_RESTRICT ptr0;
+  const orc_union64 * ORC_RESTRICT ptr4;
+  orc_union64 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union32 var38;
+  orc_union32 var39;
+  orc_union32 var40;
+  orc_union16 var41;
+  orc_union64 var42;
+  orc_union32 var43;
+  orc_union32 var44;
+  orc_union32 var45;
+  orc_union16 var46;
+  orc_union16 var47;
+  orc_union16 var48;
+  orc_union16 var49;
+  orc_union16 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+
+  ptr0 = (orc_union64 *)ex->arrays[0];
+  ptr4 = (orc_union64 *)ex->arrays[4];
+
+  /* 0: loadpl */
+  var38.i = 1023;
+  /* 1: loadpl */
+  var39.i = 10;
+  /* 2: loadpl */
+  var40.i = 20;
+  /* 3: loadpw */
+  var41.i = 0;
+  /* 4: loadpw */
+  var34.i = ex->params[24];
+  /* 5: loadpw */
+  var35.i = ex->params[25];
+  /* 6: loadpw */
+  var36.i = ex->params[26];
+  /* 7: loadpw */
+  var37.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 8: loadq */
+    var33 = ptr4[i];
+    /* 9: select0ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var43.i = _src.x2[0];
+    }
+    /* 10: select1ql */
+    {
+     orc_union64 _src;
+     _src.i = var33.i;
+     var44.i = _src.x2[1];
+    }
+    /* 11: andl */
+    var45.i = var43.i & var38.i;
+    /* 12: convlw */
+    var47.i = var45.i;
+    /* 13: shrul */
+    var45.i = ((orc_uint32)var43.i) >> var39.i;
+    /* 14: andl */
+    var45.i = var45.i & var38.i;
+    /* 15: convlw */
+    var46.i = var45.i;
+    /* 16: addw */
+    var46.i = var46.i + var34.i;
+    /* 17: andw */
+    var46.i = var46.i & var35.i;
+    /* 18: addw */
+    var47.i = var47.i + var34.i;
+    /* 19: andw */
+    var47.i = var47.i & var36.i;
+    /* 20: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 21: orw */
+    var48.i = var46.i | var47.i;
+    /* 22: shrul */
+    var45.i = ((orc_uint32)var43.i) >> var40.i;
+    /* 23: andl */
+    var45.i = var45.i & var38.i;
+    /* 24: convlw */
+    var47.i = var45.i;
+    /* 25: andl */
+    var45.i = var44.i & var38.i;
+    /* 26: convlw */
+    var46.i = var45.i;
+    /* 27: addw */
+    var46.i = var46.i + var34.i;
+    /* 28: andw */
+    var46.i = var46.i & var35.i;
+    /* 29: addw */
+    var47.i = var47.i + var34.i;
+    /* 30: andw */
+    var47.i = var47.i & var36.i;
+    /* 31: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 32: orw */
+    var49.i = var46.i | var47.i;
+    /* 33: shrul */
+    var45.i = ((orc_uint32)var44.i) >> var39.i;
+    /* 34: andl */
+    var45.i = var45.i & var38.i;
+    /* 35: convlw */
+    var47.i = var45.i;
+    /* 36: shrul */
+    var45.i = ((orc_uint32)var44.i) >> var40.i;
+    /* 37: andl */
+    var45.i = var45.i & var38.i;
+    /* 38: convlw */
+    var46.i = var45.i;
+    /* 39: addw */
+    var46.i = var46.i + var34.i;
+    /* 40: andw */
+    var46.i = var46.i & var35.i;
+    /* 41: addw */
+    var47.i = var47.i + var34.i;
+    /* 42: andw */
+    var47.i = var47.i & var36.i;
+    /* 43: shlw */
+    var47.i = ((orc_uint16)var47.i) << var37.i;
+    /* 44: orw */
+    var50.i = var46.i | var47.i;
+    /* 45: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var48.i;
+     _dest.x2[1] = var49.i;
+     var51.i = _dest.i;
+    }
+    /* 46: mergewl */
+    {
+     orc_union32 _dest;
+     _dest.x2[0] = var50.i;
+     _dest.x2[1] = var41.i;
+     var52.i = _dest.i;
+    }
+    /* 47: mergelq */
+    {
+     orc_union64 _dest;
+     _dest.x2[0] = var51.i;
+     _dest.x2[1] = var52.i;
+     var42.i = _dest.i;
+    }
+    /* 48: storeq */
+    ptr0[i] = var42;
+  }
+
+}
+
+void
+misb_orc_unpack_v210_swap (guint64 * ORC_RESTRICT d1, const guint32 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "misb_orc_unpack_v210_swap");
+      orc_program_set_backup_function (p, _backup_misb_orc_unpack_v210_swap);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 8, "s1");
+      orc_program_add_constant (p, 4, 0x000003ff, "c1");
+      orc_program_add_constant (p, 4, 0x0000000a, "c2");
+      orc_program_add_constant (p, 4, 0x00000014, "c3");
+      orc_program_add_constant (p, 2, 0x00000000, "c4");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_parameter (p, 2, "p3");
+      orc_program_add_parameter (p, 2, "p4");
+      orc_program_add_temporary (p, 4, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+      orc_program_add_temporary (p, 2, "t4");
+      orc_program_add_temporary (p, 2, "t5");
+      orc_program_add_temporary (p, 2, "t6");
+      orc_program_add_temporary (p, 2, "t7");
+      orc_program_add_temporary (p, 2, "t8");
+      orc_program_add_temporary (p, 4, "t9");
+      orc_program_add_temporary (p, 4, "t10");
+
+      orc_program_append_2 (p, "select0ql", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1ql", 0, ORC_VAR_T2, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 0, ORC_VAR_T6, ORC_VAR_T4, ORC_VAR_T5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 0, ORC_VAR_T7, ORC_VAR_T4, ORC_VAR_T5, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T5, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shrul", 0, ORC_VAR_T3, ORC_VAR_T2, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "andl", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convlw", 0, ORC_VAR_T4, ORC_VAR_T3, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T5, ORC_VAR_T5, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 0, ORC_VAR_T8, ORC_VAR_T4, ORC_VAR_T5, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T9, ORC_VAR_T6, ORC_VAR_T7, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergewl", 0, ORC_VAR_T10, ORC_VAR_T8, ORC_VAR_C4, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T9, ORC_VAR_T10, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* misb_orc_unpack_uyvy */
+#ifdef DISABLE_ORC
+void
+misb_orc_unpack_uyvy (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_int8 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_union16 *)s1;
+
+  /* 0: loadpw */
+  var34.i = p1;
+  /* 1: loadpw */
+  var35.i = p2;
+  /* 2: loadpw */
+  var36.i = p3;
+  /* 3: loadpw */
+  var37.i = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 4: loadw */
+    var33 = ptr4[i];
+    /* 5: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var39 = _src.x2[0];
+    }
+    /* 6: convubw */
+    var40.i = (orc_uint8)var39;
+    /* 7: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var39 = _src.x2[1];
+    }
+    /* 8: convubw */
+    var41.i = (orc_uint8)var39;
+    /* 9: addw */
+    var40.i = var40.i + var34.i;
+    /* 10: andw */
+    var40.i = var40.i & var35.i;
+    /* 11: addw */
+    var41.i = var41.i + var34.i;
+    /* 12: andw */
+    var41.i = var41.i & var36.i;
+    /* 13: shlw */
+    var41.i = ((orc_uint16)var41.i) << var37.i;
+    /* 14: orw */
+    var38.i = var40.i | var41.i;
+    /* 15: storew */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_misb_orc_unpack_uyvy (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_int8 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+
+  /* 0: loadpw */
+  var34.i = ex->params[24];
+  /* 1: loadpw */
+  var35.i = ex->params[25];
+  /* 2: loadpw */
+  var36.i = ex->params[26];
+  /* 3: loadpw */
+  var37.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 4: loadw */
+    var33 = ptr4[i];
+    /* 5: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var39 = _src.x2[0];
+    }
+    /* 6: convubw */
+    var40.i = (orc_uint8)var39;
+    /* 7: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var39 = _src.x2[1];
+    }
+    /* 8: convubw */
+    var41.i = (orc_uint8)var39;
+    /* 9: addw */
+    var40.i = var40.i + var34.i;
+    /* 10: andw */
+    var40.i = var40.i & var35.i;
+    /* 11: addw */
+    var41.i = var41.i + var34.i;
+    /* 12: andw */
+    var41.i = var41.i & var36.i;
+    /* 13: shlw */
+    var41.i = ((orc_uint16)var41.i) << var37.i;
+    /* 14: orw */
+    var38.i = var40.i | var41.i;
+    /* 15: storew */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+misb_orc_unpack_uyvy (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "misb_orc_unpack_uyvy");
+      orc_program_set_backup_function (p, _backup_misb_orc_unpack_uyvy);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_parameter (p, 2, "p3");
+      orc_program_add_parameter (p, 2, "p4");
+      orc_program_add_temporary (p, 1, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+
+      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convubw", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convubw", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* misb_orc_unpack_uyvy_swap */
+#ifdef DISABLE_ORC
+void
+misb_orc_unpack_uyvy_swap (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_int8 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_union16 *)s1;
+
+  /* 0: loadpw */
+  var34.i = p1;
+  /* 1: loadpw */
+  var35.i = p2;
+  /* 2: loadpw */
+  var36.i = p3;
+  /* 3: loadpw */
+  var37.i = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 4: loadw */
+    var33 = ptr4[i];
+    /* 5: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var39 = _src.x2[1];
+    }
+    /* 6: convubw */
+    var40.i = (orc_uint8)var39;
+    /* 7: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var39 = _src.x2[0];
+    }
+    /* 8: convubw */
+    var41.i = (orc_uint8)var39;
+    /* 9: addw */
+    var40.i = var40.i + var34.i;
+    /* 10: andw */
+    var40.i = var40.i & var35.i;
+    /* 11: addw */
+    var41.i = var41.i + var34.i;
+    /* 12: andw */
+    var41.i = var41.i & var36.i;
+    /* 13: shlw */
+    var41.i = ((orc_uint16)var41.i) << var37.i;
+    /* 14: orw */
+    var38.i = var40.i | var41.i;
+    /* 15: storew */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_misb_orc_unpack_uyvy_swap (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_int8 var39;
+  orc_union16 var40;
+  orc_union16 var41;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+
+  /* 0: loadpw */
+  var34.i = ex->params[24];
+  /* 1: loadpw */
+  var35.i = ex->params[25];
+  /* 2: loadpw */
+  var36.i = ex->params[26];
+  /* 3: loadpw */
+  var37.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 4: loadw */
+    var33 = ptr4[i];
+    /* 5: select1wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var39 = _src.x2[1];
+    }
+    /* 6: convubw */
+    var40.i = (orc_uint8)var39;
+    /* 7: select0wb */
+    {
+     orc_union16 _src;
+     _src.i = var33.i;
+     var39 = _src.x2[0];
+    }
+    /* 8: convubw */
+    var41.i = (orc_uint8)var39;
+    /* 9: addw */
+    var40.i = var40.i + var34.i;
+    /* 10: andw */
+    var40.i = var40.i & var35.i;
+    /* 11: addw */
+    var41.i = var41.i + var34.i;
+    /* 12: andw */
+    var41.i = var41.i & var36.i;
+    /* 13: shlw */
+    var41.i = ((orc_uint16)var41.i) << var37.i;
+    /* 14: orw */
+    var38.i = var40.i | var41.i;
+    /* 15: storew */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+misb_orc_unpack_uyvy_swap (guint16 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "misb_orc_unpack_uyvy_swap");
+      orc_program_set_backup_function (p, _backup_misb_orc_unpack_uyvy_swap);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_parameter (p, 2, "p3");
+      orc_program_add_parameter (p, 2, "p4");
+      orc_program_add_temporary (p, 1, "t1");
+      orc_program_add_temporary (p, 2, "t2");
+      orc_program_add_temporary (p, 2, "t3");
+
+      orc_program_append_2 (p, "select1wb", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convubw", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "select0wb", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convubw", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T2, ORC_VAR_T2, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "shlw", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "orw", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* misb_orc_pack_v210 */
+#ifdef DISABLE_ORC
+void
+misb_orc_pack_v210 (guint32 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int p2, int p3, int p4, int n){
+  int i;
+  orc_union64 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  const orc_union16 * ORC_RESTRICT ptr6;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union16 var42;
+  orc_union64 var43;
+  orc_union16 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+
+  ptr0 = (orc_union64 *)d1;
+  ptr4 = (orc_union16 *)s1;
+  ptr5 = (orc_union16 *)s2;
+  ptr6 = (orc_union16 *)s3;
+
+  /* 0: loadpl */
+  var40.i = 10;
+  /* 1: loadpl */
+  var41.i = 20;
+  /* 2: loadpw */
+  var42.i = 1023;
+  /* 3: loadpw */
+  var36.i = p1;
+  /* 4: loadpw */
+  var37.i = p2;
+  /* 5: loadpw */
+  var38.i = p3;
+  /* 6: loadpw */
+  var39.i = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 7: loadw */
+    var33 = ptr4[i];
+    /* 8: andw */
+    var44.i = var33.i & var37.i;
+    /* 9: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 10: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 11: convuwl */
+    var45.i = (orc_uint16)var44.i;
+    /* 12: shruw */
+    var44.i = ((orc_uint16)var33.i) >> var39.i;
+    /* 13: andw */
+    var44.i = var44.i & var38.i;
+    /* 14: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 15: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 16: convuwl */
+    var46.i = (orc_uint16)var44.i;
+    /* 17: loadw */
+    var34 = ptr5[i];
+    /* 18: andw */
+    var44.i = var34.i & var37.i;
+    /* 19: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 20: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 21: convuwl */
+    var47.i = (orc_uint16)var44.i;
+    /* 22: shruw */
+    var44.i = ((orc_uint16)var34.i) >> var39.i;
+    /* 23: andw */
+    var44.i = var44.i & var38.i;
+    /* 24: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 25: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 26: convuwl */
+    var48.i = (orc_uint16)var44.i;
+    /* 27: loadw */
+    var35 = ptr6[i];
+    /* 28: andw */
+    var44.i = var35.i & var37.i;
+    /* 29: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 30: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 31: convuwl */
+    var49.i = (orc_uint16)var44.i;
+    /* 32: shruw */
+    var44.i = ((orc_uint16)var35.i) >> var39.i;
+    /* 33: andw */
+    var44.i = var44.i & var38.i;
+    /* 34: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 35: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 36: convuwl */
+    var50.i = (orc_uint16)var44.i;
+    /* 37: shll */
+    var46.i = ((orc_uint32)var46.i) << var40.i;
+    /* 38: shll */
+    var47.i = ((orc_uint32)var47.i) << var41.i;
+    /* 39: orl */
+    var51.i = var45.i | var46.i;
+    /* 40: orl */
+    var51.i = var51.i | var47.i;
+    /* 41: shll */
+    var49.i = ((orc_uint32)var49.i) << var40.i;
+    /* 42: shll */
+    var50.i = ((orc_uint32)var50.i) << var41.i;
+    /* 43: orl */
+    var52.i = var48.i | var49.i;
+    /* 44: orl */
+    var52.i = var52.i | var50.i;
+    /* 45: mergelq */
+    {
+     orc_union64 _dest;
+     _dest.x2[0] = var51.i;
+     _dest.x2[1] = var52.i;
+     var43.i = _dest.i;
+    }
+    /* 46: storeq */
+    ptr0[i] = var43;
+  }
+
+}
+
+#else
+static void
+_backup_misb_orc_pack_v210 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union64 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  const orc_union16 * ORC_RESTRICT ptr5;
+  const orc_union16 * ORC_RESTRICT ptr6;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_union32 var40;
+  orc_union32 var41;
+  orc_union16 var42;
+  orc_union64 var43;
+  orc_union16 var44;
+  orc_union32 var45;
+  orc_union32 var46;
+  orc_union32 var47;
+  orc_union32 var48;
+  orc_union32 var49;
+  orc_union32 var50;
+  orc_union32 var51;
+  orc_union32 var52;
+
+  ptr0 = (orc_union64 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+  ptr5 = (orc_union16 *)ex->arrays[5];
+  ptr6 = (orc_union16 *)ex->arrays[6];
+
+  /* 0: loadpl */
+  var40.i = 10;
+  /* 1: loadpl */
+  var41.i = 20;
+  /* 2: loadpw */
+  var42.i = 1023;
+  /* 3: loadpw */
+  var36.i = ex->params[24];
+  /* 4: loadpw */
+  var37.i = ex->params[25];
+  /* 5: loadpw */
+  var38.i = ex->params[26];
+  /* 6: loadpw */
+  var39.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 7: loadw */
+    var33 = ptr4[i];
+    /* 8: andw */
+    var44.i = var33.i & var37.i;
+    /* 9: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 10: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 11: convuwl */
+    var45.i = (orc_uint16)var44.i;
+    /* 12: shruw */
+    var44.i = ((orc_uint16)var33.i) >> var39.i;
+    /* 13: andw */
+    var44.i = var44.i & var38.i;
+    /* 14: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 15: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 16: convuwl */
+    var46.i = (orc_uint16)var44.i;
+    /* 17: loadw */
+    var34 = ptr5[i];
+    /* 18: andw */
+    var44.i = var34.i & var37.i;
+    /* 19: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 20: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 21: convuwl */
+    var47.i = (orc_uint16)var44.i;
+    /* 22: shruw */
+    var44.i = ((orc_uint16)var34.i) >> var39.i;
+    /* 23: andw */
+    var44.i = var44.i & var38.i;
+    /* 24: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 25: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 26: convuwl */
+    var48.i = (orc_uint16)var44.i;
+    /* 27: loadw */
+    var35 = ptr6[i];
+    /* 28: andw */
+    var44.i = var35.i & var37.i;
+    /* 29: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 30: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 31: convuwl */
+    var49.i = (orc_uint16)var44.i;
+    /* 32: shruw */
+    var44.i = ((orc_uint16)var35.i) >> var39.i;
+    /* 33: andw */
+    var44.i = var44.i & var38.i;
+    /* 34: addusw */
+    var44.i = ORC_CLAMP_UW ((orc_uint16)var44.i + (orc_uint16)var36.i);
+    /* 35: minuw */
+    var44.i = ORC_MIN ((orc_uint16)var44.i, (orc_uint16)var42.i);
+    /* 36: convuwl */
+    var50.i = (orc_uint16)var44.i;
+    /* 37: shll */
+    var46.i = ((orc_uint32)var46.i) << var40.i;
+    /* 38: shll */
+    var47.i = ((orc_uint32)var47.i) << var41.i;
+    /* 39: orl */
+    var51.i = var45.i | var46.i;
+    /* 40: orl */
+    var51.i = var51.i | var47.i;
+    /* 41: shll */
+    var49.i = ((orc_uint32)var49.i) << var40.i;
+    /* 42: shll */
+    var50.i = ((orc_uint32)var50.i) << var41.i;
+    /* 43: orl */
+    var52.i = var48.i | var49.i;
+    /* 44: orl */
+    var52.i = var52.i | var50.i;
+    /* 45: mergelq */
+    {
+     orc_union64 _dest;
+     _dest.x2[0] = var51.i;
+     _dest.x2[1] = var52.i;
+     var43.i = _dest.i;
+    }
+    /* 46: storeq */
+    ptr0[i] = var43;
+  }
+
+}
+
+void
+misb_orc_pack_v210 (guint32 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, const guint16 * ORC_RESTRICT s2, const guint16 * ORC_RESTRICT s3, int p1, int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "misb_orc_pack_v210");
+      orc_program_set_backup_function (p, _backup_misb_orc_pack_v210);
+      orc_program_add_destination (p, 8, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_source (p, 2, "s2");
+      orc_program_add_source (p, 2, "s3");
+      orc_program_add_constant (p, 4, 0x0000000a, "c1");
+      orc_program_add_constant (p, 4, 0x00000014, "c2");
+      orc_program_add_constant (p, 2, 0x000003ff, "c3");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_parameter (p, 2, "p3");
+      orc_program_add_parameter (p, 2, "p4");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 4, "t2");
+      orc_program_add_temporary (p, 4, "t3");
+      orc_program_add_temporary (p, 4, "t4");
+      orc_program_add_temporary (p, 4, "t5");
+      orc_program_add_temporary (p, 4, "t6");
+      orc_program_add_temporary (p, 4, "t7");
+      orc_program_add_temporary (p, 4, "t8");
+      orc_program_add_temporary (p, 4, "t9");
+
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minuw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minuw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minuw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T4, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S2, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minuw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T5, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minuw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T6, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S3, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "minuw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_C3, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuwl", 0, ORC_VAR_T7, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T3, ORC_VAR_T3, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T4, ORC_VAR_T4, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "orl", 0, ORC_VAR_T8, ORC_VAR_T2, ORC_VAR_T3, ORC_VAR_D1);
+      orc_program_append_2 (p, "orl", 0, ORC_VAR_T8, ORC_VAR_T8, ORC_VAR_T4, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T6, ORC_VAR_T6, ORC_VAR_C1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shll", 0, ORC_VAR_T7, ORC_VAR_T7, ORC_VAR_C2, ORC_VAR_D1);
+      orc_program_append_2 (p, "orl", 0, ORC_VAR_T9, ORC_VAR_T5, ORC_VAR_T6, ORC_VAR_D1);
+      orc_program_append_2 (p, "orl", 0, ORC_VAR_T9, ORC_VAR_T9, ORC_VAR_T7, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergelq", 0, ORC_VAR_D1, ORC_VAR_T8, ORC_VAR_T9, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->arrays[ORC_VAR_S2] = (void *)s2;
+  ex->arrays[ORC_VAR_S3] = (void *)s3;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* misb_orc_pack_uyvy */
+#ifdef DISABLE_ORC
+void
+misb_orc_pack_uyvy (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_union16 *)s1;
+
+  /* 0: loadpw */
+  var34.i = p1;
+  /* 1: loadpw */
+  var35.i = p2;
+  /* 2: loadpw */
+  var36.i = p3;
+  /* 3: loadpw */
+  var37.i = p4;
+
+  for (i = 0; i < n; i++) {
+    /* 4: loadw */
+    var33 = ptr4[i];
+    /* 5: andw */
+    var39.i = var33.i & var35.i;
+    /* 6: addusw */
+    var39.i = ORC_CLAMP_UW ((orc_uint16)var39.i + (orc_uint16)var34.i);
+    /* 7: convuuswb */
+    var40 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 8: shruw */
+    var39.i = ((orc_uint16)var33.i) >> var37.i;
+    /* 9: andw */
+    var39.i = var39.i & var36.i;
+    /* 10: addusw */
+    var39.i = ORC_CLAMP_UW ((orc_uint16)var39.i + (orc_uint16)var34.i);
+    /* 11: convuuswb */
+    var41 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 12: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var40;
+     _dest.x2[1] = var41;
+     var38.i = _dest.i;
+    }
+    /* 13: storew */
+    ptr0[i] = var38;
+  }
+
+}
+
+#else
+static void
+_backup_misb_orc_pack_uyvy (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_union16 * ORC_RESTRICT ptr4;
+  orc_union16 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_union16 var37;
+  orc_union16 var38;
+  orc_union16 var39;
+  orc_int8 var40;
+  orc_int8 var41;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_union16 *)ex->arrays[4];
+
+  /* 0: loadpw */
+  var34.i = ex->params[24];
+  /* 1: loadpw */
+  var35.i = ex->params[25];
+  /* 2: loadpw */
+  var36.i = ex->params[26];
+  /* 3: loadpw */
+  var37.i = ex->params[27];
+
+  for (i = 0; i < n; i++) {
+    /* 4: loadw */
+    var33 = ptr4[i];
+    /* 5: andw */
+    var39.i = var33.i & var35.i;
+    /* 6: addusw */
+    var39.i = ORC_CLAMP_UW ((orc_uint16)var39.i + (orc_uint16)var34.i);
+    /* 7: convuuswb */
+    var40 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 8: shruw */
+    var39.i = ((orc_uint16)var33.i) >> var37.i;
+    /* 9: andw */
+    var39.i = var39.i & var36.i;
+    /* 10: addusw */
+    var39.i = ORC_CLAMP_UW ((orc_uint16)var39.i + (orc_uint16)var34.i);
+    /* 11: convuuswb */
+    var41 = ORC_CLAMP_UB ((orc_uint16)var39.i);
+    /* 12: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var40;
+     _dest.x2[1] = var41;
+     var38.i = _dest.i;
+    }
+    /* 13: storew */
+    ptr0[i] = var38;
+  }
+
+}
+
+void
+misb_orc_pack_uyvy (guint8 * ORC_RESTRICT d1, const guint16 * ORC_RESTRICT s1, int p1, int p2, int p3, int p4, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "misb_orc_pack_uyvy");
+      orc_program_set_backup_function (p, _backup_misb_orc_pack_uyvy);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 2, "s1");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_parameter (p, 2, "p2");
+      orc_program_add_parameter (p, 2, "p3");
+      orc_program_add_parameter (p, 2, "p4");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 1, "t2");
+      orc_program_add_temporary (p, 1, "t3");
+
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P2, ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T2, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "shruw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_P4, ORC_VAR_D1);
+      orc_program_append_2 (p, "andw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P3, ORC_VAR_D1);
+      orc_program_append_2 (p, "addusw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->params[ORC_VAR_P1] = p1;
+  ex->params[ORC_VAR_P2] = p2;
+  ex->params[ORC_VAR_P3] = p3;
+  ex->params[ORC_VAR_P4] = p4;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
+
+/* misb_orc_pack_uyvy_gray8 */
+#ifdef DISABLE_ORC
+void
+misb_orc_pack_uyvy_gray8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int n){
+  int i;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_int8 * ORC_RESTRICT ptr4;
+  orc_int8 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_int8 var37;
+  orc_int8 var38;
+
+  ptr0 = (orc_union16 *)d1;
+  ptr4 = (orc_int8 *)s1;
+
+  /* 0: loadpw */
+  var34.i = p1;
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadb */
+    var33 = ptr4[i];
+    /* 2: convubw */
+    var36.i = (orc_uint8)var33;
+    /* 3: addw */
+    var36.i = var36.i + var34.i;
+    /* 4: convuuswb */
+    var38 = ORC_CLAMP_UB ((orc_uint16)var36.i);
+    /* 5: convwb */
+    var37 = var34.i;
+    /* 6: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var37;
+     _dest.x2[1] = var38;
+     var35.i = _dest.i;
+    }
+    /* 7: storew */
+    ptr0[i] = var35;
+  }
+
+}
+
+#else
+static void
+_backup_misb_orc_pack_uyvy_gray8 (OrcExecutor * ORC_RESTRICT ex)
+{
+  int i;
+  int n = ex->n;
+  orc_union16 * ORC_RESTRICT ptr0;
+  const orc_int8 * ORC_RESTRICT ptr4;
+  orc_int8 var33;
+  orc_union16 var34;
+  orc_union16 var35;
+  orc_union16 var36;
+  orc_int8 var37;
+  orc_int8 var38;
+
+  ptr0 = (orc_union16 *)ex->arrays[0];
+  ptr4 = (orc_int8 *)ex->arrays[4];
+
+  /* 0: loadpw */
+  var34.i = ex->params[24];
+
+  for (i = 0; i < n; i++) {
+    /* 1: loadb */
+    var33 = ptr4[i];
+    /* 2: convubw */
+    var36.i = (orc_uint8)var33;
+    /* 3: addw */
+    var36.i = var36.i + var34.i;
+    /* 4: convuuswb */
+    var38 = ORC_CLAMP_UB ((orc_uint16)var36.i);
+    /* 5: convwb */
+    var37 = var34.i;
+    /* 6: mergebw */
+    {
+     orc_union16 _dest;
+     _dest.x2[0] = var37;
+     _dest.x2[1] = var38;
+     var35.i = _dest.i;
+    }
+    /* 7: storew */
+    ptr0[i] = var35;
+  }
+
+}
+
+void
+misb_orc_pack_uyvy_gray8 (guint8 * ORC_RESTRICT d1, const guint8 * ORC_RESTRICT s1, int p1, int n)
+{
+  OrcExecutor _ex, *ex = &_ex;
+  static volatile int p_inited = 0;
+  static OrcCode *c = 0;
+  void (*func) (OrcExecutor *);
+
+  if (!p_inited) {
+    orc_once_mutex_lock ();
+    if (!p_inited) {
+      OrcProgram *p;
+
+      p = orc_program_new ();
+      orc_program_set_name (p, "misb_orc_pack_uyvy_gray8");
+      orc_program_set_backup_function (p, _backup_misb_orc_pack_uyvy_gray8);
+      orc_program_add_destination (p, 2, "d1");
+      orc_program_add_source (p, 1, "s1");
+      orc_program_add_parameter (p, 2, "p1");
+      orc_program_add_temporary (p, 2, "t1");
+      orc_program_add_temporary (p, 1, "t2");
+      orc_program_add_temporary (p, 1, "t3");
+
+      orc_program_append_2 (p, "convubw", 0, ORC_VAR_T1, ORC_VAR_S1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "addw", 0, ORC_VAR_T1, ORC_VAR_T1, ORC_VAR_P1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convuuswb", 0, ORC_VAR_T3, ORC_VAR_T1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "convwb", 0, ORC_VAR_T2, ORC_VAR_P1, ORC_VAR_D1, ORC_VAR_D1);
+      orc_program_append_2 (p, "mergebw", 0, ORC_VAR_D1, ORC_VAR_T2, ORC_VAR_T3, ORC_VAR_D1);
+
+      orc_program_compile (p);
+      c = orc_program_take_code (p);
+      orc_program_free (p);
+    }
+    p_inited = TRUE;
+    orc_once_mutex_unlock ();
+  }
+  ex->arrays[ORC_VAR_A2] = c;
+  ex->program = 0;
+
+  ex->n = n;
+  ex->arrays[ORC_VAR_D1] = d1;
+  ex->arrays[ORC_VAR_S1] = (void *)s1;
+  ex->params[ORC_VAR_P1] = p1;
+
+  func = c->exec;
+  func (ex);
+}
+#endif
+
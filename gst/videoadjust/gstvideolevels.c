@@ -41,6 +41,7 @@
 #include <string.h>
 
 #include "gstvideolevels.h"
+#include "gstvideolevelsorc.h"
 #include "genicampixelformat.h"
 
 #include <gst/video/video.h>
@@ -61,6 +62,31 @@ enum
   PROP_HIGHOUT,
   PROP_AUTO,
   PROP_INTERVAL,
+  PROP_N_THREADS,
+  PROP_HISTOGRAM_STRIDE_X,
+  PROP_HISTOGRAM_STRIDE_Y,
+  PROP_ROI_X,
+  PROP_ROI_Y,
+  PROP_ROI_WIDTH,
+  PROP_ROI_HEIGHT,
+  PROP_FUSED_HISTOGRAM,
+  PROP_AGC_SMOOTHING,
+  PROP_AGC_DEADBAND,
+  PROP_MODE,
+  PROP_TILES_X,
+  PROP_TILES_Y,
+  PROP_CLIP_LIMIT,
+  PROP_STATS_META,
+  PROP_STATS_HISTOGRAM_BINS,
+  PROP_POST_MESSAGES,
+  PROP_MESSAGE_INTERVAL,
+  PROP_NOTIFY_LEVELS,
+  PROP_LOWIN_RED,
+  PROP_LOWIN_GREEN,
+  PROP_LOWIN_BLUE,
+  PROP_HIGHIN_RED,
+  PROP_HIGHIN_GREEN,
+  PROP_HIGHIN_BLUE,
   PROP_LAST
 };
 
@@ -69,16 +95,69 @@ static GParamSpec *properties[PROP_LAST];
 #define DEFAULT_PROP_LOWIN  0
 #define DEFAULT_PROP_HIGHIN  65535
 #define DEFAULT_PROP_LOWOUT  0
-#define DEFAULT_PROP_HIGHOUT  255
+#define DEFAULT_PROP_HIGHOUT  65535
+#define DEFAULT_PROP_CHANNEL_LEVEL -1
 #define DEFAULT_PROP_AUTO 0
 #define DEFAULT_PROP_INTERVAL (GST_SECOND / 2)
+#define DEFAULT_PROP_N_THREADS 1
+#define DEFAULT_PROP_HISTOGRAM_STRIDE_X 1
+#define DEFAULT_PROP_HISTOGRAM_STRIDE_Y 1
+#define DEFAULT_PROP_ROI_X 0
+#define DEFAULT_PROP_ROI_Y 0
+#define DEFAULT_PROP_ROI_WIDTH 0
+#define DEFAULT_PROP_ROI_HEIGHT 0
+#define DEFAULT_PROP_FUSED_HISTOGRAM FALSE
+#define DEFAULT_PROP_AGC_SMOOTHING 0.0
+#define DEFAULT_PROP_AGC_DEADBAND 0
+#define DEFAULT_PROP_MODE GST_VIDEOLEVELS_MODE_LINEAR
+#define DEFAULT_PROP_TILES_X 8
+#define DEFAULT_PROP_TILES_Y 8
+#define DEFAULT_PROP_CLIP_LIMIT 4.0
+#define DEFAULT_PROP_STATS_META FALSE
+#define DEFAULT_PROP_STATS_HISTOGRAM_BINS 0
+#define DEFAULT_PROP_POST_MESSAGES FALSE
+#define DEFAULT_PROP_MESSAGE_INTERVAL GST_SECOND
+#define DEFAULT_PROP_NOTIFY_LEVELS TRUE
+
+/* a horizontal stripe of the frame processed by one thread */
+struct _GstVideoLevelsStripe
+{
+  GstVideoLevels *videolevels;
+  guint8 *in_data;
+  guint8 *out_data;
+  gint y_start;
+  gint y_end;
+
+  /* region sampled for the histogram */
+  gint hist_x_start;
+  gint hist_x_end;
+  gint hist_y_start;
+  gint hist_y_end;
+  gint *histogram;
+
+  /* CLAHE tile rows handled by this thread, and a scratch area holding the
+   * bins of a row followed by the four table entries gathered for it */
+  gint tile_y_start;
+  gint tile_y_end;
+  guint16 *row_bins;
+  gint row_bins_width;
+};
+
+#define GINT_CLAMP(x, low, high) ((gint)(CLAMP((x),(low),(high))))
+#define GUINT8_CLAMP(x, low, high) ((guint8)(CLAMP((x),(low),(high))))
+
+/* CLAHE works on single component formats, RGB is equalized globally */
+#define GST_VIDEOLEVELS_MODE(v) \
+  ((v)->mode == GST_VIDEOLEVELS_MODE_CLAHE && (v)->n_components > 1 ? \
+   GST_VIDEOLEVELS_MODE_EQUALIZE : (v)->mode)
 
 /* the capabilities of the inputs and outputs */
 static GstStaticPadTemplate gst_videolevels_src_template =
     GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
     GST_PAD_ALWAYS,
-    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("{ GRAY16_LE, GRAY16_BE, GRAY8 }") ";"
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("{ GRAY16_LE, GRAY16_BE, GRAY8, "
+            "ARGB64 }") ";"
         GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER8 ("{ bggr, grbg, rggb, gbrg }") ";"
         GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER16
         ("{ bggr16, grbg16, rggb16, gbrg16 }", "{1234, 4321}")
@@ -89,8 +168,11 @@ static GstStaticPadTemplate gst_videolevels_sink_template =
     GST_STATIC_PAD_TEMPLATE ("src",
     GST_PAD_SRC,
     GST_PAD_ALWAYS,
-    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("GRAY8") ";"
-        GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER8 ("{ bggr, grbg, rggb, gbrg }")
+    GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("{ GRAY8, GRAY16_LE, GRAY16_BE, "
+            "ARGB, ARGB64 }") ";"
+        GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER8 ("{ bggr, grbg, rggb, gbrg }") ";"
+        GST_GENICAM_PIXEL_FORMAT_MAKE_BAYER16
+        ("{ bggr16, grbg16, rggb16, gbrg16 }", "{1234, 4321}")
     )
     );
 
@@ -113,6 +195,26 @@ gst_videolevels_auto_get_type (void)
   return videolevels_auto_type;
 }
 
+#define GST_TYPE_VIDEOLEVELS_MODE (gst_videolevels_mode_get_type())
+static GType
+gst_videolevels_mode_get_type (void)
+{
+  static GType videolevels_mode_type = 0;
+  static const GEnumValue videolevels_mode[] = {
+    {GST_VIDEOLEVELS_MODE_LINEAR, "Linear stretch", "linear"},
+    {GST_VIDEOLEVELS_MODE_EQUALIZE, "Histogram equalization", "equalize"},
+    {GST_VIDEOLEVELS_MODE_CLAHE,
+        "Contrast limited adaptive histogram equalization", "clahe"},
+    {0, NULL, NULL},
+  };
+
+  if (!videolevels_mode_type) {
+    videolevels_mode_type =
+        g_enum_register_static ("GstVideoLevelsMode", videolevels_mode);
+  }
+  return videolevels_mode_type;
+}
+
 /* GObject vmethod declarations */
 static void gst_videolevels_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec);
@@ -123,19 +225,44 @@ static void gst_videolevels_dispose (GObject * object);
 /* GstBaseTransform vmethod declarations */
 static GstCaps *gst_videolevels_transform_caps (GstBaseTransform * trans,
     GstPadDirection direction, GstCaps * caps, GstCaps * filter_caps);
+static gboolean gst_videolevels_get_unit_size (GstBaseTransform * trans,
+    GstCaps * caps, gsize * size);
 static gboolean gst_videolevels_set_caps (GstBaseTransform * trans,
     GstCaps * incaps, GstCaps * outcaps);
+static GstFlowReturn gst_videolevels_transform_ip (GstBaseTransform * trans,
+    GstBuffer * buf);
+static gboolean gst_videolevels_decide_allocation (GstBaseTransform * trans,
+    GstQuery * query);
 static GstFlowReturn gst_videolevels_transform (GstBaseTransform * trans,
     GstBuffer * inbuf, GstBuffer * outbuf);
+static gboolean gst_videolevels_stop (GstBaseTransform * trans);
 
 /* GstVideoLevels method declarations */
 static void gst_videolevels_reset (GstVideoLevels * filter);
 static gboolean gst_videolevels_calculate_lut (GstVideoLevels * videolevels);
+static void gst_videolevels_calculate_equalize_lut (GstVideoLevels *
+    videolevels);
+static void gst_videolevels_clahe (GstVideoLevels * videolevels,
+    guint8 * in_data, guint8 * out_data);
+static void gst_videolevels_invalidate_lut (GstVideoLevels * videolevels);
+static void gst_videolevels_clamp_levels (GstVideoLevels * videolevels);
+static void gst_videolevels_calculate_stretch (GstVideoLevels * videolevels);
 static gboolean gst_videolevels_calculate_histogram (GstVideoLevels *
     videolevels, guint16 * data);
-static gboolean gst_videolevels_auto_adjust (GstVideoLevels * videolevels,
-    guint16 * data);
+static gboolean gst_videolevels_adjust_from_histogram (GstVideoLevels *
+    videolevels);
+static void gst_videolevels_get_histogram_region (GstVideoLevels *
+    videolevels, gint * x0, gint * y0, gint * x1, gint * y1);
+static void gst_videolevels_merge_histograms (GstVideoLevels * videolevels);
+static void gst_videolevels_calculate_stats (GstVideoLevels * videolevels,
+    gint lower, gint upper);
+static gboolean gst_videolevels_message_due (GstVideoLevels * videolevels,
+    GstClockTime timestamp);
+static void gst_videolevels_publish_stats (GstVideoLevels * videolevels,
+    GstBuffer * outbuf, gboolean post_message);
 static void gst_videolevels_check_passthrough (GstVideoLevels * videolevels);
+static void gst_videolevels_setup_stripes (GstVideoLevels * videolevels);
+static void gst_videolevels_free_stripes (GstVideoLevels * videolevels);
 
 /* setup debug */
 GST_DEBUG_CATEGORY_STATIC (videolevels_debug);
@@ -162,6 +289,7 @@ gst_videolevels_dispose (GObject * object)
   g_free (videolevels->lookup_table);
 
   gst_videolevels_reset (videolevels);
+  gst_videolevels_free_stripes (videolevels);
 
   /* chain up to the parent class */
   G_OBJECT_CLASS (gst_videolevels_parent_class)->dispose (object);
@@ -203,11 +331,11 @@ gst_videolevels_class_init (GstVideoLevelsClass * klass)
       G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
   properties[PROP_LOWOUT] =
       g_param_spec_int ("lower-output-level", "Lower Output Level",
-      "Lower Output Level", 0, DEFAULT_PROP_HIGHOUT, DEFAULT_PROP_LOWOUT,
+      "Lower Output Level", -1, DEFAULT_PROP_HIGHOUT, DEFAULT_PROP_LOWOUT,
       G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
   properties[PROP_HIGHOUT] =
       g_param_spec_int ("upper-output-level", "Upper Output Level",
-      "Upper Output Level", 0, DEFAULT_PROP_HIGHOUT, DEFAULT_PROP_HIGHOUT,
+      "Upper Output Level", -1, DEFAULT_PROP_HIGHOUT, DEFAULT_PROP_HIGHOUT,
       G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
   g_object_class_install_property (gobject_class, PROP_LOWIN,
       properties[PROP_LOWIN]);
@@ -224,6 +352,145 @@ gst_videolevels_class_init (GstVideoLevelsClass * klass)
       g_param_spec_uint64 ("interval", "Interval",
           "Interval of time between adjustments (in nanoseconds)", 1,
           G_MAXUINT64, DEFAULT_PROP_INTERVAL, G_PARAM_READWRITE));
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Number of threads to split each frame across (0 = number of "
+          "processors)", 0, G_MAXINT, DEFAULT_PROP_N_THREADS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_HISTOGRAM_STRIDE_X,
+      g_param_spec_uint ("histogram-stride-x", "Histogram stride X",
+          "Sample every Nth column when computing the auto adjust histogram",
+          1, G_MAXINT, DEFAULT_PROP_HISTOGRAM_STRIDE_X,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_HISTOGRAM_STRIDE_Y,
+      g_param_spec_uint ("histogram-stride-y", "Histogram stride Y",
+          "Sample every Nth row when computing the auto adjust histogram",
+          1, G_MAXINT, DEFAULT_PROP_HISTOGRAM_STRIDE_Y,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_ROI_X,
+      g_param_spec_int ("agc-roi-x", "AGC ROI X",
+          "Left edge of the region used for auto adjust", 0, G_MAXINT,
+          DEFAULT_PROP_ROI_X, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_ROI_Y,
+      g_param_spec_int ("agc-roi-y", "AGC ROI Y",
+          "Top edge of the region used for auto adjust", 0, G_MAXINT,
+          DEFAULT_PROP_ROI_Y, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_ROI_WIDTH,
+      g_param_spec_int ("agc-roi-width", "AGC ROI width",
+          "Width of the region used for auto adjust (0 = to right edge)", 0,
+          G_MAXINT, DEFAULT_PROP_ROI_WIDTH,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_ROI_HEIGHT,
+      g_param_spec_int ("agc-roi-height", "AGC ROI height",
+          "Height of the region used for auto adjust (0 = to bottom edge)", 0,
+          G_MAXINT, DEFAULT_PROP_ROI_HEIGHT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_FUSED_HISTOGRAM,
+      g_param_spec_boolean ("fused-histogram", "Fused histogram",
+          "Accumulate the auto adjust histogram while applying levels, so "
+          "each frame is read once (new levels apply from the next frame)",
+          DEFAULT_PROP_FUSED_HISTOGRAM,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_AGC_SMOOTHING,
+      g_param_spec_double ("agc-smoothing", "AGC smoothing",
+          "Weight of the previous levels when auto adjusting, as an "
+          "exponential moving average (0 = no smoothing)", 0.0, 0.999,
+          DEFAULT_PROP_AGC_SMOOTHING,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_AGC_DEADBAND,
+      g_param_spec_int ("agc-deadband", "AGC dead band",
+          "Minimum change of a level, in input units, before auto adjust "
+          "updates it", 0, DEFAULT_PROP_HIGHIN, DEFAULT_PROP_AGC_DEADBAND,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_MODE,
+      g_param_spec_enum ("mode", "Mode",
+          "Mapping from input to output levels (equalize and clahe update "
+          "every frame and ignore the input levels)",
+          GST_TYPE_VIDEOLEVELS_MODE, DEFAULT_PROP_MODE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_TILES_X,
+      g_param_spec_int ("tiles-x", "Tiles X",
+          "Number of CLAHE tiles horizontally", 1, 64, DEFAULT_PROP_TILES_X,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_TILES_Y,
+      g_param_spec_int ("tiles-y", "Tiles Y",
+          "Number of CLAHE tiles vertically", 1, 64, DEFAULT_PROP_TILES_Y,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_CLIP_LIMIT,
+      g_param_spec_double ("clip-limit", "Clip limit",
+          "CLAHE contrast limit, as a multiple of the mean tile histogram bin "
+          "count (0 = no limit)", 0.0, 1000.0, DEFAULT_PROP_CLIP_LIMIT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_STATS_META,
+      g_param_spec_boolean ("stats-meta", "Stats meta",
+          "Attach a GstVideoLevelsMeta with the frame statistics to each "
+          "output buffer", DEFAULT_PROP_STATS_META,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_STATS_HISTOGRAM_BINS,
+      g_param_spec_uint ("stats-histogram-bins", "Stats histogram bins",
+          "Number of bins of the histogram included in the statistics "
+          "(0 = no histogram)", 0, GST_VIDEOLEVELS_META_MAX_BINS,
+          DEFAULT_PROP_STATS_HISTOGRAM_BINS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_POST_MESSAGES,
+      g_param_spec_boolean ("post-messages", "Post messages",
+          "Post \"videolevels\" element messages with the frame statistics",
+          DEFAULT_PROP_POST_MESSAGES,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  g_object_class_install_property (gobject_class, PROP_MESSAGE_INTERVAL,
+      g_param_spec_uint64 ("message-interval", "Message interval",
+          "Minimum interval of time between element messages (in "
+          "nanoseconds)", 0, G_MAXUINT64, DEFAULT_PROP_MESSAGE_INTERVAL,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  properties[PROP_NOTIFY_LEVELS] =
+      g_param_spec_boolean ("notify-levels", "Notify levels",
+      "Emit notify signals from the streaming thread when auto adjust "
+      "changes the input levels", DEFAULT_PROP_NOTIFY_LEVELS,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (gobject_class, PROP_NOTIFY_LEVELS,
+      properties[PROP_NOTIFY_LEVELS]);
+  properties[PROP_LOWIN_RED] =
+      g_param_spec_int ("lower-input-level-red", "Lower Input Level Red",
+      "Lower input level of the red component of ARGB64 video "
+      "(-1 = lower-input-level)", -1, DEFAULT_PROP_HIGHIN,
+      DEFAULT_PROP_CHANNEL_LEVEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  properties[PROP_LOWIN_GREEN] =
+      g_param_spec_int ("lower-input-level-green", "Lower Input Level Green",
+      "Lower input level of the green component of ARGB64 video "
+      "(-1 = lower-input-level)", -1, DEFAULT_PROP_HIGHIN,
+      DEFAULT_PROP_CHANNEL_LEVEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  properties[PROP_LOWIN_BLUE] =
+      g_param_spec_int ("lower-input-level-blue", "Lower Input Level Blue",
+      "Lower input level of the blue component of ARGB64 video "
+      "(-1 = lower-input-level)", -1, DEFAULT_PROP_HIGHIN,
+      DEFAULT_PROP_CHANNEL_LEVEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  properties[PROP_HIGHIN_RED] =
+      g_param_spec_int ("upper-input-level-red", "Upper Input Level Red",
+      "Upper input level of the red component of ARGB64 video "
+      "(-1 = upper-input-level)", -1, DEFAULT_PROP_HIGHIN,
+      DEFAULT_PROP_CHANNEL_LEVEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  properties[PROP_HIGHIN_GREEN] =
+      g_param_spec_int ("upper-input-level-green", "Upper Input Level Green",
+      "Upper input level of the green component of ARGB64 video "
+      "(-1 = upper-input-level)", -1, DEFAULT_PROP_HIGHIN,
+      DEFAULT_PROP_CHANNEL_LEVEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  properties[PROP_HIGHIN_BLUE] =
+      g_param_spec_int ("upper-input-level-blue", "Upper Input Level Blue",
+      "Upper input level of the blue component of ARGB64 video "
+      "(-1 = upper-input-level)", -1, DEFAULT_PROP_HIGHIN,
+      DEFAULT_PROP_CHANNEL_LEVEL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+  g_object_class_install_property (gobject_class, PROP_LOWIN_RED,
+      properties[PROP_LOWIN_RED]);
+  g_object_class_install_property (gobject_class, PROP_LOWIN_GREEN,
+      properties[PROP_LOWIN_GREEN]);
+  g_object_class_install_property (gobject_class, PROP_LOWIN_BLUE,
+      properties[PROP_LOWIN_BLUE]);
+  g_object_class_install_property (gobject_class, PROP_HIGHIN_RED,
+      properties[PROP_HIGHIN_RED]);
+  g_object_class_install_property (gobject_class, PROP_HIGHIN_GREEN,
+      properties[PROP_HIGHIN_GREEN]);
+  g_object_class_install_property (gobject_class, PROP_HIGHIN_BLUE,
+      properties[PROP_HIGHIN_BLUE]);
 
   gst_element_class_add_pad_template (gstelement_class,
       gst_static_pad_template_get (&gst_videolevels_sink_template));
@@ -239,10 +506,19 @@ gst_videolevels_class_init (GstVideoLevelsClass * klass)
   gstbasetransform_class->transform_caps =
       GST_DEBUG_FUNCPTR (gst_videolevels_transform_caps);
 
+  gstbasetransform_class->get_unit_size =
+      GST_DEBUG_FUNCPTR (gst_videolevels_get_unit_size);
   gstbasetransform_class->set_caps =
       GST_DEBUG_FUNCPTR (gst_videolevels_set_caps);
   gstbasetransform_class->transform =
       GST_DEBUG_FUNCPTR (gst_videolevels_transform);
+  gstbasetransform_class->transform_ip =
+      GST_DEBUG_FUNCPTR (gst_videolevels_transform_ip);
+  /* passthrough buffers may be shared, so they are never processed */
+  gstbasetransform_class->transform_ip_on_passthrough = FALSE;
+  gstbasetransform_class->decide_allocation =
+      GST_DEBUG_FUNCPTR (gst_videolevels_decide_allocation);
+  gstbasetransform_class->stop = GST_DEBUG_FUNCPTR (gst_videolevels_stop);
 }
 
 /**
@@ -258,8 +534,15 @@ gst_videolevels_init (GstVideoLevels * videolevels)
   GST_DEBUG_OBJECT (videolevels, "init class instance");
 
   videolevels->passthrough = FALSE;
+  videolevels->use_stretch = FALSE;
+  videolevels->n_threads = DEFAULT_PROP_N_THREADS;
 
-  videolevels->lookup_table = g_new (guint8, G_MAXUINT16 + 1);
+  videolevels->lookup_table = NULL;
+  videolevels->lut_size = 0;
+  videolevels->lut_entry_size = 0;
+  videolevels->lut_n_tables = 0;
+  videolevels->lut_dirty = FALSE;
+  videolevels->per_channel = FALSE;
 
   gst_videolevels_reset (videolevels);
 }
@@ -283,28 +566,107 @@ gst_videolevels_set_property (GObject * object, guint prop_id,
   switch (prop_id) {
     case PROP_LOWIN:
       videolevels->lower_input = g_value_get_int (value);
-      gst_videolevels_calculate_lut (videolevels);
+      gst_videolevels_invalidate_lut (videolevels);
       break;
     case PROP_HIGHIN:
       videolevels->upper_input = g_value_get_int (value);
-      gst_videolevels_calculate_lut (videolevels);
+      gst_videolevels_invalidate_lut (videolevels);
       break;
     case PROP_LOWOUT:
       videolevels->lower_output = g_value_get_int (value);
-      gst_videolevels_calculate_lut (videolevels);
+      gst_videolevels_invalidate_lut (videolevels);
       break;
     case PROP_HIGHOUT:
       videolevels->upper_output = g_value_get_int (value);
-      gst_videolevels_calculate_lut (videolevels);
+      gst_videolevels_invalidate_lut (videolevels);
       break;
     case PROP_AUTO:{
       videolevels->auto_adjust = g_value_get_enum (value);
+      videolevels->agc_valid = FALSE;
+      gst_videolevels_check_passthrough (videolevels);
       break;
     }
     case PROP_INTERVAL:
       videolevels->interval = g_value_get_uint64 (value);
       videolevels->last_auto_timestamp = GST_CLOCK_TIME_NONE;
       break;
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (videolevels);
+      videolevels->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (videolevels);
+      break;
+    case PROP_HISTOGRAM_STRIDE_X:
+      videolevels->histogram_stride_x = g_value_get_uint (value);
+      break;
+    case PROP_HISTOGRAM_STRIDE_Y:
+      videolevels->histogram_stride_y = g_value_get_uint (value);
+      break;
+    case PROP_ROI_X:
+      videolevels->roi_x = g_value_get_int (value);
+      break;
+    case PROP_ROI_Y:
+      videolevels->roi_y = g_value_get_int (value);
+      break;
+    case PROP_ROI_WIDTH:
+      videolevels->roi_width = g_value_get_int (value);
+      break;
+    case PROP_ROI_HEIGHT:
+      videolevels->roi_height = g_value_get_int (value);
+      break;
+    case PROP_FUSED_HISTOGRAM:
+      videolevels->fused_histogram = g_value_get_boolean (value);
+      break;
+    case PROP_AGC_SMOOTHING:
+      videolevels->agc_smoothing = g_value_get_double (value);
+      break;
+    case PROP_AGC_DEADBAND:
+      videolevels->agc_deadband = g_value_get_int (value);
+      break;
+    case PROP_MODE:
+      videolevels->mode = g_value_get_enum (value);
+      gst_videolevels_invalidate_lut (videolevels);
+      break;
+    case PROP_TILES_X:
+      videolevels->tiles_x = g_value_get_int (value);
+      break;
+    case PROP_TILES_Y:
+      videolevels->tiles_y = g_value_get_int (value);
+      break;
+    case PROP_CLIP_LIMIT:
+      videolevels->clip_limit = g_value_get_double (value);
+      break;
+    case PROP_STATS_META:
+      videolevels->stats_meta = g_value_get_boolean (value);
+      gst_videolevels_check_passthrough (videolevels);
+      break;
+    case PROP_STATS_HISTOGRAM_BINS:
+      videolevels->stats_histogram_bins = g_value_get_uint (value);
+      break;
+    case PROP_POST_MESSAGES:
+      videolevels->post_messages = g_value_get_boolean (value);
+      gst_videolevels_check_passthrough (videolevels);
+      break;
+    case PROP_MESSAGE_INTERVAL:
+      videolevels->message_interval = g_value_get_uint64 (value);
+      videolevels->last_message_timestamp = GST_CLOCK_TIME_NONE;
+      break;
+    case PROP_NOTIFY_LEVELS:
+      videolevels->notify_levels = g_value_get_boolean (value);
+      break;
+    case PROP_LOWIN_RED:
+    case PROP_LOWIN_GREEN:
+    case PROP_LOWIN_BLUE:
+      videolevels->channel_lower_input[prop_id - PROP_LOWIN_RED] =
+          g_value_get_int (value);
+      gst_videolevels_invalidate_lut (videolevels);
+      break;
+    case PROP_HIGHIN_RED:
+    case PROP_HIGHIN_GREEN:
+    case PROP_HIGHIN_BLUE:
+      videolevels->channel_upper_input[prop_id - PROP_HIGHIN_RED] =
+          g_value_get_int (value);
+      gst_videolevels_invalidate_lut (videolevels);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -346,6 +708,75 @@ gst_videolevels_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_INTERVAL:
       g_value_set_uint64 (value, videolevels->interval);
       break;
+    case PROP_N_THREADS:
+      g_value_set_uint (value, videolevels->n_threads);
+      break;
+    case PROP_HISTOGRAM_STRIDE_X:
+      g_value_set_uint (value, videolevels->histogram_stride_x);
+      break;
+    case PROP_HISTOGRAM_STRIDE_Y:
+      g_value_set_uint (value, videolevels->histogram_stride_y);
+      break;
+    case PROP_ROI_X:
+      g_value_set_int (value, videolevels->roi_x);
+      break;
+    case PROP_ROI_Y:
+      g_value_set_int (value, videolevels->roi_y);
+      break;
+    case PROP_ROI_WIDTH:
+      g_value_set_int (value, videolevels->roi_width);
+      break;
+    case PROP_ROI_HEIGHT:
+      g_value_set_int (value, videolevels->roi_height);
+      break;
+    case PROP_FUSED_HISTOGRAM:
+      g_value_set_boolean (value, videolevels->fused_histogram);
+      break;
+    case PROP_AGC_SMOOTHING:
+      g_value_set_double (value, videolevels->agc_smoothing);
+      break;
+    case PROP_AGC_DEADBAND:
+      g_value_set_int (value, videolevels->agc_deadband);
+      break;
+    case PROP_MODE:
+      g_value_set_enum (value, videolevels->mode);
+      break;
+    case PROP_TILES_X:
+      g_value_set_int (value, videolevels->tiles_x);
+      break;
+    case PROP_TILES_Y:
+      g_value_set_int (value, videolevels->tiles_y);
+      break;
+    case PROP_CLIP_LIMIT:
+      g_value_set_double (value, videolevels->clip_limit);
+      break;
+    case PROP_STATS_META:
+      g_value_set_boolean (value, videolevels->stats_meta);
+      break;
+    case PROP_STATS_HISTOGRAM_BINS:
+      g_value_set_uint (value, videolevels->stats_histogram_bins);
+      break;
+    case PROP_POST_MESSAGES:
+      g_value_set_boolean (value, videolevels->post_messages);
+      break;
+    case PROP_MESSAGE_INTERVAL:
+      g_value_set_uint64 (value, videolevels->message_interval);
+      break;
+    case PROP_NOTIFY_LEVELS:
+      g_value_set_boolean (value, videolevels->notify_levels);
+      break;
+    case PROP_LOWIN_RED:
+    case PROP_LOWIN_GREEN:
+    case PROP_LOWIN_BLUE:
+      g_value_set_int (value,
+          videolevels->channel_lower_input[prop_id - PROP_LOWIN_RED]);
+      break;
+    case PROP_HIGHIN_RED:
+    case PROP_HIGHIN_GREEN:
+    case PROP_HIGHIN_BLUE:
+      g_value_set_int (value,
+          videolevels->channel_upper_input[prop_id - PROP_HIGHIN_RED]);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -420,6 +851,80 @@ copy_width_height_framerate (const GstStructure * st, GstStructure * newst)
   gst_structure_set_value (newst, "framerate", value);
 }
 
+/* check which kinds of raw formats a structure may hold */
+static void
+get_raw_format_kinds (const GstStructure * st, gboolean * gray,
+    gboolean * rgb)
+{
+  const GValue *value = gst_structure_get_value (st, "format");
+  guint j, n;
+
+  *gray = FALSE;
+  *rgb = FALSE;
+
+  if (value == NULL) {
+    *gray = TRUE;
+    *rgb = TRUE;
+    return;
+  }
+
+  n = GST_VALUE_HOLDS_LIST (value) ? gst_value_list_get_size (value) : 1;
+  for (j = 0; j < n; ++j) {
+    const GValue *val = GST_VALUE_HOLDS_LIST (value) ?
+        gst_value_list_get_value (value, j) : value;
+    const gchar *str;
+
+    if (!G_VALUE_HOLDS_STRING (val))
+      continue;
+    str = g_value_get_string (val);
+    if (g_str_has_prefix (str, "GRAY"))
+      *gray = TRUE;
+    else if (g_str_has_prefix (str, "ARGB"))
+      *rgb = TRUE;
+  }
+}
+
+static void
+append_raw_structure (GstCaps * caps, const GstStructure * st,
+    const gchar * str)
+{
+  GstStructure *newst = gst_structure_from_string (str, NULL);
+  copy_width_height_framerate (st, newst);
+  gst_caps_append_structure (caps, newst);
+}
+
+/* the same Bayer format at either depth, leaving the 16-bit packing to be
+ * negotiated since the levels map between any input and output range */
+static void
+append_bayer_structures (GstCaps * caps, const GstStructure * st)
+{
+  const GValue *value;
+  GstStructure *same, *swapped;
+  gboolean is_16bit;
+
+  value = gst_structure_get_value (st, "format");
+  if (GST_VALUE_HOLDS_LIST (value)) {
+    value = gst_value_list_get_value (value, 0);
+  }
+  is_16bit = g_str_has_suffix (g_value_get_string (value), "16");
+
+  same = gst_structure_copy (st);
+  gst_structure_remove_fields (same, "endianness", "bpp", NULL);
+
+  swapped = gst_structure_from_string ("video/x-bayer", NULL);
+  swap_format_list (st, swapped);
+  copy_width_height_framerate (st, swapped);
+
+  /* prefer 8-bit */
+  if (is_16bit) {
+    gst_caps_append_structure (caps, swapped);
+    gst_caps_append_structure (caps, same);
+  } else {
+    gst_caps_append_structure (caps, same);
+    gst_caps_append_structure (caps, swapped);
+  }
+}
+
 /**
  * gst_videolevels_transform_caps:
  * @base: #GstBaseTransform
@@ -436,7 +941,7 @@ gst_videolevels_transform_caps (GstBaseTransform * trans,
 {
   GstVideoLevels *videolevels = GST_VIDEOLEVELS (trans);
   GstCaps *other_caps;
-  GstStructure *st, *newst;
+  GstStructure *st;
   gint i, n;
   const gchar *name;
 
@@ -455,50 +960,29 @@ gst_videolevels_transform_caps (GstBaseTransform * trans,
     if (gst_caps_is_subset_structure (other_caps, st))
       continue;
 
-    if (direction == GST_PAD_SRC) {
-      if (g_strcmp0 (name, "video/x-raw") == 0) {
-        newst =
-            gst_structure_from_string
-            ("video/x-raw,format={GRAY16_LE,GRAY16_BE,GRAY8}", NULL);
-        copy_width_height_framerate (st, newst);
-        gst_caps_append_structure (other_caps, newst);
-      } else if (g_strcmp0 (name, "video/x-bayer") == 0) {
-        /* we can handle same format, e.g. bggr->bggr */
-        gst_caps_append_structure (other_caps, gst_structure_copy (st));
-
-        /* and also with higher bit depth */
-        newst = gst_structure_from_string ("video/x-bayer", NULL);
-        swap_format_list (st, newst);
-        copy_width_height_framerate (st, newst);
-        gst_caps_append_structure (other_caps, newst);
+    if (g_strcmp0 (name, "video/x-raw") == 0) {
+      gboolean gray, rgb;
+
+      get_raw_format_kinds (st, &gray, &rgb);
+      if (direction == GST_PAD_SRC) {
+        if (gray)
+          append_raw_structure (other_caps, st,
+              "video/x-raw,format={GRAY16_LE,GRAY16_BE,GRAY8}");
+        if (rgb)
+          append_raw_structure (other_caps, st, "video/x-raw,format=ARGB64");
       } else {
-        g_assert_not_reached ();
+        /* prefer 8-bit output */
+        if (gray)
+          append_raw_structure (other_caps, st,
+              "video/x-raw,format={GRAY8,GRAY16_LE,GRAY16_BE}");
+        if (rgb)
+          append_raw_structure (other_caps, st,
+              "video/x-raw,format={ARGB,ARGB64}");
       }
+    } else if (g_strcmp0 (name, "video/x-bayer") == 0) {
+      append_bayer_structures (other_caps, st);
     } else {
-      if (g_strcmp0 (name, "video/x-raw") == 0) {
-        newst = gst_structure_from_string ("video/x-raw,format=GRAY8", NULL);
-        copy_width_height_framerate (st, newst);
-        gst_caps_append_structure (other_caps, newst);
-      } else if (g_strcmp0 (name, "video/x-bayer") == 0) {
-        const GValue *value;
-        const gchar *str;
-        newst = gst_structure_from_string ("video/x-bayer", NULL);
-        value = gst_structure_get_value (st, "format");
-        if (GST_VALUE_HOLDS_LIST (value)) {
-          value = gst_value_list_get_value (value, 0);
-        }
-        str = g_value_get_string (value);
-        if (g_str_has_suffix (str, "16")) {
-          swap_format_list (st, newst);
-        } else {
-          gst_structure_set_value (newst, "format", gst_structure_get_value (st,
-                  "format"));
-        }
-        copy_width_height_framerate (st, newst);
-        gst_caps_append_structure (other_caps, newst);
-      } else {
-        g_assert_not_reached ();
-      }
+      g_assert_not_reached ();
     }
   }
 
@@ -515,21 +999,58 @@ gst_videolevels_transform_caps (GstBaseTransform * trans,
   return other_caps;
 }
 
+/**
+ * gst_videolevels_get_unit_size:
+ * @base: #GstBaseTransform
+ * @caps: #GstCaps
+ * @size: location for the frame size
+ *
+ * The input and output frame sizes differ whenever the sample size changes.
+ * Bayer frames use 4 byte aligned rows, like in set_caps.
+ *
+ * Returns: TRUE on success
+ */
+static gboolean
+gst_videolevels_get_unit_size (GstBaseTransform * trans, GstCaps * caps,
+    gsize * size)
+{
+  GstStructure *st = gst_caps_get_structure (caps, 0);
+  GstVideoInfo info;
+
+  if (g_str_equal (gst_structure_get_name (st), "video/x-bayer")) {
+    const gchar *format = gst_structure_get_string (st, "format");
+    gint width, height;
+
+    if (format == NULL || !gst_structure_get_int (st, "width", &width) ||
+        !gst_structure_get_int (st, "height", &height))
+      return FALSE;
+
+    if (g_str_has_suffix (format, "16"))
+      *size = GST_ROUND_UP_4 (width * 2) * height;
+    else
+      *size = GST_ROUND_UP_4 (width) * height;
+    return TRUE;
+  }
+
+  if (!gst_video_info_from_caps (&info, caps))
+    return FALSE;
+
+  *size = GST_VIDEO_INFO_SIZE (&info);
+  return TRUE;
+}
+
 static gboolean
 gst_videolevels_set_caps (GstBaseTransform * trans, GstCaps * incaps,
     GstCaps * outcaps)
 {
   GstVideoLevels *levels = GST_VIDEOLEVELS (trans);
-  GstStructure *st;
+  GstStructure *st, *outst;
   gboolean res;
   GstVideoInfo invinfo, outvinfo;
 
   GST_DEBUG_OBJECT (levels,
       "set_caps: in %" GST_PTR_FORMAT " out %" GST_PTR_FORMAT, incaps, outcaps);
 
-  /* always assume 8-bit output */
-  levels->bpp_out = 8;
-
   /* GstVideoInfo treats Bayer as encoded, but it's still useful */
   gst_video_info_from_caps (&invinfo, incaps);
   gst_video_info_from_caps (&outvinfo, outcaps);
@@ -541,8 +1062,13 @@ gst_videolevels_set_caps (GstBaseTransform * trans, GstCaps * incaps,
   levels->stride_in = GST_VIDEO_INFO_COMP_STRIDE (&invinfo, 0);
   levels->stride_out = GST_VIDEO_INFO_COMP_STRIDE (&outvinfo, 0);
   levels->bpp_in = invinfo.finfo->bits;
+  levels->bpp_out = outvinfo.finfo->bits;
+  levels->n_components = 1;
+  levels->endianness_in = G_BYTE_ORDER;
+  levels->endianness_out = G_BYTE_ORDER;
 
   st = gst_caps_get_structure (incaps, 0);
+  outst = gst_caps_get_structure (outcaps, 0);
 
   if (invinfo.finfo->format == GST_VIDEO_FORMAT_GRAY8) {
     // do nothing
@@ -550,6 +1076,9 @@ gst_videolevels_set_caps (GstBaseTransform * trans, GstCaps * incaps,
     levels->endianness_in = G_BIG_ENDIAN;
   } else if (invinfo.finfo->format == GST_VIDEO_FORMAT_GRAY16_LE) {
     levels->endianness_in = G_LITTLE_ENDIAN;
+  } else if (invinfo.finfo->format == GST_VIDEO_FORMAT_ARGB64) {
+    /* RGB share the levels, alpha is passed through */
+    levels->n_components = 4;
   } else {
     const gchar *format = gst_structure_get_string (st, "format");
     if (g_str_has_suffix (format, "16")) {
@@ -560,63 +1089,400 @@ gst_videolevels_set_caps (GstBaseTransform * trans, GstCaps * incaps,
       levels->bpp_in = 8;
       levels->stride_in = GST_ROUND_UP_4 (levels->width);
     }
-    levels->stride_out = GST_ROUND_UP_4 (levels->width);
+  }
+
+  if (outvinfo.finfo->format == GST_VIDEO_FORMAT_GRAY16_BE) {
+    levels->endianness_out = G_BIG_ENDIAN;
+  } else if (outvinfo.finfo->format == GST_VIDEO_FORMAT_GRAY16_LE) {
+    levels->endianness_out = G_LITTLE_ENDIAN;
+  } else if (g_str_equal (gst_structure_get_name (outst), "video/x-bayer")) {
+    const gchar *format = gst_structure_get_string (outst, "format");
+    if (g_str_has_suffix (format, "16")) {
+      gst_structure_get_int (outst, "endianness", &levels->endianness_out);
+      levels->bpp_out = 16;
+      levels->stride_out = GST_ROUND_UP_4 (levels->width * 2);
+    } else {
+      levels->bpp_out = 8;
+      levels->stride_out = GST_ROUND_UP_4 (levels->width);
+    }
   }
 
   if (gst_structure_has_field (st, "bpp")) {
     gst_structure_get_int (st, "bpp", &levels->bpp_in);
   }
+  if (gst_structure_has_field (outst, "bpp")) {
+    gst_structure_get_int (outst, "bpp", &levels->bpp_out);
+  }
 
   g_assert (levels->bpp_in >= 1 && levels->bpp_in <= 16);
+  g_assert (levels->bpp_out >= 1 && levels->bpp_out <= 16);
+
+  levels->swap_in = levels->bpp_in > 8 &&
+      (levels->endianness_in == G_LITTLE_ENDIAN ||
+      levels->endianness_in == G_BIG_ENDIAN) &&
+      levels->endianness_in != G_BYTE_ORDER;
+  levels->swap_out = levels->bpp_out > 8 &&
+      (levels->endianness_out == G_LITTLE_ENDIAN ||
+      levels->endianness_out == G_BIG_ENDIAN) &&
+      levels->endianness_out != G_BYTE_ORDER;
+
+  /* identity levels can only be passed through without a format change */
+  levels->same_caps = gst_caps_is_equal (incaps, outcaps);
+
+  /* each sample is read before its output is written, so the levels can be
+   * applied in place when the sample size is unchanged; ARGB64 alpha is
+   * restored from the input after the row is mapped so it can't */
+  gst_base_transform_set_in_place (trans,
+      (levels->bpp_in > 8) == (levels->bpp_out > 8) &&
+      levels->n_components == 1);
+
+  /* restart smoothing from the first measurement of the new format */
+  levels->agc_valid = FALSE;
+
+  if (levels->nbins != MIN (4096, 1 << levels->bpp_in)) {
+    levels->nbins = MIN (4096, 1 << levels->bpp_in);
+    g_free (levels->histogram);
+    levels->histogram = NULL;
+  }
 
-  levels->nbins = MIN (4096, 1 << levels->bpp_in);
-
+  levels->lut_dirty = FALSE;
   res = gst_videolevels_calculate_lut (levels);
 
   return res;
 }
 
 /**
- * gst_videolevels_transform:
- * @base: #GstBaseTransform
+ * gst_videolevels_histogram_row:
+ * @videolevels: #GstVideoLevels
+ * @data: first pixel of the row
+ * @x_start: first column to sample
+ * @x_end: column after the last to sample
+ * @hist: histogram to accumulate into
+ *
+ * Add every histogram-stride-x pixel of a row to a histogram.
+ */
+static inline void
+gst_videolevels_histogram_row (GstVideoLevels * videolevels, guint8 * data,
+    gint x_start, gint x_end, gint * hist)
+{
+  gint nbins = videolevels->nbins;
+  gint step_x = videolevels->histogram_stride_x;
+  gint maxVal = (1 << videolevels->bpp_in) - 1;
+  gfloat factor = (gfloat) ((nbins - 1.0) / maxVal);
+  gint c, k;
+
+  if (videolevels->n_components == 4) {
+    /* ARGB64, native endian, skip alpha */
+    guint16 *row = (guint16 *) data;
+
+    for (c = x_start; c < x_end; c += step_x) {
+      for (k = 1; k < 4; k++)
+        hist[GINT_CLAMP (row[c * 4 + k] * factor, 0, nbins - 1)]++;
+    }
+  } else if (videolevels->bpp_in > 8) {
+    guint16 *row = (guint16 *) data;
+
+    if (videolevels->swap_in) {
+      for (c = x_start; c < x_end; c += step_x) {
+        hist[GINT_CLAMP (GUINT16_SWAP_LE_BE (row[c]) * factor, 0,
+                nbins - 1)]++;
+      }
+    } else {
+      for (c = x_start; c < x_end; c += step_x) {
+        hist[GINT_CLAMP (row[c] * factor, 0, nbins - 1)]++;
+      }
+    }
+  } else {
+    guint8 *row = data;
+    for (c = x_start; c < x_end; c += step_x) {
+      hist[GINT_CLAMP (row[c] * factor, 0, nbins - 1)]++;
+    }
+  }
+}
+
+/* Map rows of samples through the lookup table, which holds one entry of
+ * the output sample size per input value, already in output byte order.
+ * Instantiated below for 8 or 16-bit input and output samples. */
+#define GST_VIDEOLEVELS_DEFINE_APPLY_LUT(in_bits, out_bits)                  \
+static void                                                                   \
+gst_videolevels_apply_lut_##in_bits##_##out_bits (GstVideoLevels *            \
+    videolevels, guint8 * in_data, guint8 * out_data, gint rows)              \
+{                                                                             \
+  const guint##out_bits *lut = videolevels->lookup_table;                     \
+  const guint max_in = videolevels->lut_size - 1;                             \
+  const gint n = videolevels->width * videolevels->n_components;              \
+  gint r, c;                                                                  \
+                                                                              \
+  for (r = 0; r < rows; r++) {                                                \
+    const guint##in_bits *src = (const guint##in_bits *) in_data;             \
+    guint##out_bits *dst = (guint##out_bits *) out_data;                      \
+                                                                              \
+    if (in_bits == 8) {                                                       \
+      for (c = 0; c < n; c++)                                                 \
+        dst[c] = lut[src[c]];                                                 \
+    } else if (videolevels->swap_in) {                                        \
+      for (c = 0; c < n; c++)                                                 \
+        dst[c] = lut[MIN ((guint16) GUINT16_SWAP_LE_BE (src[c]), max_in)];    \
+    } else {                                                                  \
+      for (c = 0; c < n; c++)                                                 \
+        dst[c] = lut[MIN (src[c], max_in)];                                   \
+    }                                                                         \
+                                                                              \
+    in_data += videolevels->stride_in;                                        \
+    out_data += videolevels->stride_out;                                      \
+  }                                                                           \
+}
+
+GST_VIDEOLEVELS_DEFINE_APPLY_LUT (8, 8);
+GST_VIDEOLEVELS_DEFINE_APPLY_LUT (8, 16);
+GST_VIDEOLEVELS_DEFINE_APPLY_LUT (16, 8);
+GST_VIDEOLEVELS_DEFINE_APPLY_LUT (16, 16);
+
+/**
+ * gst_videolevels_apply_channel_luts:
+ * @videolevels: #GstVideoLevels
+ * @in_data: first input row
+ * @out_data: first output row
+ * @rows: number of rows
+ *
+ * Map the colour components of ARGB64 rows, each through its own table.
+ * Alpha is left for gst_videolevels_copy_alpha().
+ */
+static void
+gst_videolevels_apply_channel_luts (GstVideoLevels * videolevels,
+    guint8 * in_data, guint8 * out_data, gint rows)
+{
+  const gint lut_size = videolevels->lut_size;
+  const guint max_in = lut_size - 1;
+  gint r, c, k;
+
+  for (r = 0; r < rows; r++) {
+    const guint16 *src = (const guint16 *) in_data;
+
+    if (videolevels->bpp_out > 8) {
+      const guint16 *lut = videolevels->lookup_table;
+      guint16 *dst = (guint16 *) out_data;
+      for (c = 0; c < videolevels->width; c++) {
+        for (k = 1; k < 4; k++)
+          dst[c * 4 + k] = lut[(k - 1) * lut_size + MIN (src[c * 4 + k],
+                  max_in)];
+      }
+    } else {
+      const guint8 *lut = videolevels->lookup_table;
+      for (c = 0; c < videolevels->width; c++) {
+        for (k = 1; k < 4; k++)
+          out_data[c * 4 + k] = lut[(k - 1) * lut_size + MIN (src[c * 4 + k],
+                  max_in)];
+      }
+    }
+
+    in_data += videolevels->stride_in;
+    out_data += videolevels->stride_out;
+  }
+}
+
+/**
+ * gst_videolevels_copy_alpha:
+ * @videolevels: #GstVideoLevels
+ * @in_data: first input row
+ * @out_data: first output row
+ * @rows: number of rows
+ *
+ * Replace the mapped alpha of ARGB64 input with the original alpha,
+ * scaled to the output sample size.
+ */
+static void
+gst_videolevels_copy_alpha (GstVideoLevels * videolevels, guint8 * in_data,
+    guint8 * out_data, gint rows)
+{
+  gint r, c;
+
+  for (r = 0; r < rows; r++) {
+    const guint16 *src = (const guint16 *) in_data;
+
+    if (videolevels->bpp_out > 8) {
+      guint16 *dst = (guint16 *) out_data;
+      for (c = 0; c < videolevels->width; c++)
+        dst[c * 4] = src[c * 4];
+    } else {
+      for (c = 0; c < videolevels->width; c++)
+        out_data[c * 4] = src[c * 4] >> 8;
+    }
+
+    in_data += videolevels->stride_in;
+    out_data += videolevels->stride_out;
+  }
+}
+
+/**
+ * gst_videolevels_apply_rows:
+ * @videolevels: #GstVideoLevels
+ * @in_data: first input row
+ * @out_data: first output row
+ * @rows: number of rows
+ *
+ * Map rows from input to output levels.
+ */
+static void
+gst_videolevels_apply_rows (GstVideoLevels * videolevels, guint8 * in_data,
+    guint8 * out_data, gint rows)
+{
+  if (videolevels->use_stretch) {
+    if (videolevels->swap_in)
+      videolevels_orc_stretch_u16_swap (out_data, videolevels->stride_out,
+          (guint16 *) in_data, videolevels->stride_in,
+          videolevels->stretch_low_in, videolevels->stretch_range,
+          videolevels->stretch_shift, videolevels->stretch_mult,
+          videolevels->stretch_low_out, videolevels->width, rows);
+    else
+      videolevels_orc_stretch_u16 (out_data, videolevels->stride_out,
+          (guint16 *) in_data, videolevels->stride_in,
+          videolevels->stretch_low_in, videolevels->stretch_range,
+          videolevels->stretch_shift, videolevels->stretch_mult,
+          videolevels->stretch_low_out, videolevels->width, rows);
+    return;
+  }
+
+  if (videolevels->per_channel) {
+    gst_videolevels_apply_channel_luts (videolevels, in_data, out_data, rows);
+  } else if (videolevels->bpp_in > 8) {
+    if (videolevels->bpp_out > 8)
+      gst_videolevels_apply_lut_16_16 (videolevels, in_data, out_data, rows);
+    else
+      gst_videolevels_apply_lut_16_8 (videolevels, in_data, out_data, rows);
+  } else {
+    if (videolevels->bpp_out > 8)
+      gst_videolevels_apply_lut_8_16 (videolevels, in_data, out_data, rows);
+    else
+      gst_videolevels_apply_lut_8_8 (videolevels, in_data, out_data, rows);
+  }
+
+  if (videolevels->n_components == 4)
+    gst_videolevels_copy_alpha (videolevels, in_data, out_data, rows);
+}
+
+/**
+ * gst_videolevels_apply_stripe:
+ * @data: #GstVideoLevelsStripe
+ *
+ * Map the rows of one stripe from input to output levels. In fused histogram
+ * mode the AGC histogram is accumulated from each input row right before it
+ * is mapped, so the row is read from cache and in-place operation still
+ * sees the original values.
+ */
+static void
+gst_videolevels_apply_stripe (gpointer data)
+{
+  GstVideoLevelsStripe *stripe = data;
+  GstVideoLevels *videolevels = stripe->videolevels;
+  gint step_y = videolevels->histogram_stride_y;
+  guint8 *in_data = stripe->in_data + stripe->y_start * videolevels->stride_in;
+  guint8 *out_data =
+      stripe->out_data + stripe->y_start * videolevels->stride_out;
+  gint r;
+
+  if (stripe->y_end <= stripe->y_start)
+    return;
+
+  if (!videolevels->fuse_pending) {
+    gst_videolevels_apply_rows (videolevels, in_data, out_data,
+        stripe->y_end - stripe->y_start);
+    return;
+  }
+
+  memset (stripe->histogram, 0, sizeof (gint) * videolevels->nbins);
+
+  for (r = stripe->y_start; r < stripe->y_end; r++) {
+    if (r >= stripe->hist_y_start && r < stripe->hist_y_end &&
+        (r - stripe->hist_y_start) % step_y == 0) {
+      gst_videolevels_histogram_row (videolevels, in_data,
+          stripe->hist_x_start, stripe->hist_x_end, stripe->histogram);
+    }
+
+    gst_videolevels_apply_rows (videolevels, in_data, out_data, 1);
+
+    in_data += videolevels->stride_in;
+    out_data += videolevels->stride_out;
+  }
+}
+
+/**
+ * gst_videolevels_process:
+ * @videolevels: #GstVideoLevels
  * @inbuf: #GstBuffer
- * @outbuf: #GstBuffer
+ * @outbuf: #GstBuffer, may be @inbuf when working in place
  *
- * Transforms input buffer to output buffer.
+ * Maps input buffer to output buffer levels.
  *
  * Returns: GST_FLOW_OK on success
  */
 static GstFlowReturn
-gst_videolevels_transform (GstBaseTransform * trans, GstBuffer * inbuf,
+gst_videolevels_process (GstVideoLevels * videolevels, GstBuffer * inbuf,
     GstBuffer * outbuf)
 {
-  GstVideoLevels *videolevels = GST_VIDEOLEVELS (trans);
   GstClockTimeDiff elapsed;
   GstClockTime start =
       gst_clock_get_time (gst_element_get_clock (GST_ELEMENT (videolevels)));
-  gint r, c;
+  gint i, n_stripes;
   guint8 *in_data, *out_data;
-  guint8 *lut;
   GstMapInfo inminfo, outminfo;
+  gboolean do_adjust = FALSE;
+  gboolean do_message, want_stats, need_histogram;
+  gint applied_lower, applied_upper;
 
-  GST_LOG_OBJECT (videolevels, "Performing non-inplace transform");
+  if (inbuf == outbuf) {
+    GST_LOG_OBJECT (videolevels, "Performing in-place transform");
 
-  gst_buffer_map (inbuf, &inminfo, GST_MAP_READ);
-  gst_buffer_map (outbuf, &outminfo, GST_MAP_WRITE);
+    if (!gst_buffer_map (inbuf, &inminfo, GST_MAP_READWRITE)) {
+      GST_ELEMENT_ERROR (videolevels, STREAM, FAILED,
+          ("Failed to map buffer"), (NULL));
+      return GST_FLOW_ERROR;
+    }
+    outminfo = inminfo;
+  } else {
+    GST_LOG_OBJECT (videolevels, "Performing non-inplace transform");
 
-  if (!inminfo.data || !outminfo.data) {
-    GST_ELEMENT_ERROR (videolevels, STREAM, FAILED, ("Failed to map buffer"),
-        (NULL));
-    return GST_FLOW_ERROR;
+    if (!gst_buffer_map (inbuf, &inminfo, GST_MAP_READ)) {
+      GST_ELEMENT_ERROR (videolevels, STREAM, FAILED,
+          ("Failed to map buffer"), (NULL));
+      return GST_FLOW_ERROR;
+    }
+    if (!gst_buffer_map (outbuf, &outminfo, GST_MAP_WRITE)) {
+      gst_buffer_unmap (inbuf, &inminfo);
+      GST_ELEMENT_ERROR (videolevels, STREAM, FAILED,
+          ("Failed to map buffer"), (NULL));
+      return GST_FLOW_ERROR;
+    }
   }
   in_data = inminfo.data;
   out_data = outminfo.data;
 
-  if (videolevels->auto_adjust == 1) {
+  gst_videolevels_setup_stripes (videolevels);
+  n_stripes = gst_vision_task_runner_get_n_threads (videolevels->runner);
+
+  do_message = videolevels->post_messages &&
+      gst_videolevels_message_due (videolevels, GST_BUFFER_TIMESTAMP (inbuf));
+  want_stats = videolevels->stats_meta || do_message;
+
+  if (GST_VIDEOLEVELS_MODE (videolevels) == GST_VIDEOLEVELS_MODE_CLAHE) {
+    /* the tile histograms are not merged, gather the global one separately */
+    if (want_stats)
+      gst_videolevels_calculate_histogram (videolevels, (guint16 *) in_data);
+    gst_videolevels_clahe (videolevels, in_data, out_data);
+    applied_lower = videolevels->lower_input;
+    applied_upper = videolevels->upper_input;
+    goto stats;
+  }
+
+  if (GST_VIDEOLEVELS_MODE (videolevels) == GST_VIDEOLEVELS_MODE_EQUALIZE) {
+    /* the equalization table follows every frame */
+    do_adjust = TRUE;
+  } else if (videolevels->auto_adjust == 1) {
     GST_DEBUG_OBJECT (videolevels, "Auto adjusting levels (once)");
-    gst_videolevels_auto_adjust (videolevels, (guint16 *) in_data);
+    do_adjust = TRUE;
     videolevels->auto_adjust = 0;
     g_object_notify (G_OBJECT (videolevels), "auto");
+    gst_videolevels_check_passthrough (videolevels);
   } else if (videolevels->auto_adjust == 2) {
     elapsed =
         GST_CLOCK_DIFF (videolevels->last_auto_timestamp,
@@ -625,42 +1491,79 @@ gst_videolevels_transform (GstBaseTransform * trans, GstBuffer * inbuf,
         || elapsed >= (GstClockTimeDiff) videolevels->interval || elapsed < 0) {
       GST_LOG_OBJECT (videolevels, "Auto adjusting levels (%d ns since last)",
           elapsed);
-      gst_videolevels_auto_adjust (videolevels, (guint16 *) in_data);
+      do_adjust = TRUE;
       videolevels->last_auto_timestamp = GST_BUFFER_TIMESTAMP (inbuf);
     }
   }
 
-  lut = videolevels->lookup_table;
-  if (videolevels->bpp_in > 8) {
-    for (r = 0; r < videolevels->height; r++) {
-      guint16 *src = (guint16 *) in_data;
-      guint8 *dst = out_data;
+  /* in fused mode the histogram is gathered while applying the current
+   * levels, and the resulting levels are used from the next frame on */
+  need_histogram = do_adjust || want_stats;
+  videolevels->fuse_pending = need_histogram && videolevels->fused_histogram;
+  if (need_histogram && !videolevels->fuse_pending) {
+    gst_videolevels_calculate_histogram (videolevels, (guint16 *) in_data);
+    if (do_adjust)
+      gst_videolevels_adjust_from_histogram (videolevels);
+  }
 
-      for (c = 0; c < videolevels->width; c++) {
-        //GST_LOG_OBJECT (videolevels, "Converting pixel (%d, %d), %d->%d", c, r, *src, lut[*src]);
-        *dst++ = lut[*src++];
-      }
+  /* levels changed by property writes or auto adjust since the last frame */
+  if (videolevels->lut_dirty) {
+    videolevels->lut_dirty = FALSE;
+    gst_videolevels_calculate_lut (videolevels);
+  }
+  applied_lower = videolevels->lower_input;
+  applied_upper = videolevels->upper_input;
+
+  /* the levels became an identity mapping, e.g. after being clamped, so
+   * there is no table to apply; basetransform skips us from the next frame */
+  if (videolevels->passthrough) {
+    if (outbuf != inbuf)
+      memcpy (out_data, in_data, MIN (inminfo.size, outminfo.size));
+    if (videolevels->fuse_pending) {
+      videolevels->fuse_pending = FALSE;
+      if (want_stats || do_adjust)
+        gst_videolevels_calculate_histogram (videolevels, (guint16 *) in_data);
+      if (do_adjust)
+        gst_videolevels_adjust_from_histogram (videolevels);
+    }
+    goto stats;
+  }
 
-      in_data += videolevels->stride_in;
-      out_data += videolevels->stride_out;
+  if (videolevels->fuse_pending) {
+    gint x0, y0, x1, y1;
+    gst_videolevels_get_histogram_region (videolevels, &x0, &y0, &x1, &y1);
+    for (i = 0; i < n_stripes; i++) {
+      videolevels->stripes[i].hist_x_start = x0;
+      videolevels->stripes[i].hist_x_end = x1;
+      videolevels->stripes[i].hist_y_start = y0;
+      videolevels->stripes[i].hist_y_end = y1;
     }
-  } else {
-    for (r = 0; r < videolevels->height; r++) {
-      guint8 *src = (guint8 *) in_data;
-      guint8 *dst = out_data;
+  }
 
-      for (c = 0; c < videolevels->width; c++) {
-        //GST_LOG_OBJECT (videolevels, "Converting pixel (%d, %d), %d->%d", c, r, *src, lut[*src]);
-        *dst++ = lut[*src++];
-      }
+  for (i = 0; i < n_stripes; i++) {
+    videolevels->stripes[i].in_data = in_data;
+    videolevels->stripes[i].out_data = out_data;
+  }
+  gst_vision_task_runner_run (videolevels->runner,
+      gst_videolevels_apply_stripe, videolevels->stripe_data);
+
+  if (videolevels->fuse_pending) {
+    gst_videolevels_merge_histograms (videolevels);
+    if (do_adjust)
+      gst_videolevels_adjust_from_histogram (videolevels);
+    videolevels->fuse_pending = FALSE;
+  }
 
-      in_data += videolevels->stride_in;
-      out_data += videolevels->stride_out;
-    }
+stats:
+  if (want_stats) {
+    gst_videolevels_calculate_stats (videolevels, applied_lower,
+        applied_upper);
+    gst_videolevels_publish_stats (videolevels, outbuf, do_message);
   }
 
   gst_buffer_unmap (inbuf, &inminfo);
-  gst_buffer_unmap (outbuf, &outminfo);
+  if (outbuf != inbuf)
+    gst_buffer_unmap (outbuf, &outminfo);
 
   GST_LOG_OBJECT (videolevels, "Processing took %" G_GINT64_FORMAT "ms",
       GST_TIME_AS_MSECONDS (GST_CLOCK_DIFF (start,
@@ -670,30 +1573,242 @@ gst_videolevels_transform (GstBaseTransform * trans, GstBuffer * inbuf,
   return GST_FLOW_OK;
 }
 
-/************************************************************************/
-/* GstVideoLevels method implementations                                */
-/************************************************************************/
-
 /**
- * gst_videolevels_reset:
- * @videolevels: #GstVideoLevels
+ * gst_videolevels_transform:
+ * @base: #GstBaseTransform
+ * @inbuf: #GstBuffer
+ * @outbuf: #GstBuffer
  *
- * Reset instance variables and free memory
+ * Transforms input buffer to output buffer.
+ *
+ * Returns: GST_FLOW_OK on success
+ */
+static GstFlowReturn
+gst_videolevels_transform (GstBaseTransform * trans, GstBuffer * inbuf,
+    GstBuffer * outbuf)
+{
+  return gst_videolevels_process (GST_VIDEOLEVELS (trans), inbuf, outbuf);
+}
+
+/**
+ * gst_videolevels_transform_ip:
+ * @base: #GstBaseTransform
+ * @buf: #GstBuffer
+ *
+ * Transforms buffer in place, used when input and output samples have the
+ * same size.
+ *
+ * Returns: GST_FLOW_OK on success
+ */
+static GstFlowReturn
+gst_videolevels_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
+{
+  return gst_videolevels_process (GST_VIDEOLEVELS (trans), buf, buf);
+}
+
+/**
+ * gst_videolevels_decide_allocation:
+ * @base: #GstBaseTransform
+ * @query: #GstQuery
+ *
+ * Offer a video buffer pool for the output when downstream doesn't provide
+ * one, so output frames are recycled rather than allocated per buffer. Video
+ * meta isn't enabled as rows are written at the default stride.
+ *
+ * Returns: TRUE on success
+ */
+static gboolean
+gst_videolevels_decide_allocation (GstBaseTransform * trans, GstQuery * query)
+{
+  GstBufferPool *pool = NULL;
+  GstCaps *outcaps;
+  gsize unit_size;
+  guint size = 0, min = 0, max = 0;
+
+  gst_query_parse_allocation (query, &outcaps, NULL);
+
+  if (outcaps && gst_videolevels_get_unit_size (trans, outcaps, &unit_size)) {
+    if (gst_query_get_n_allocation_pools (query) > 0)
+      gst_query_parse_nth_allocation_pool (query, 0, &pool, &size, &min,
+          &max);
+
+    if (pool == NULL) {
+      GstStructure *st = gst_caps_get_structure (outcaps, 0);
+
+      GST_DEBUG_OBJECT (trans, "Downstream has no pool, offering our own");
+
+      if (g_str_equal (gst_structure_get_name (st), "video/x-raw"))
+        pool = gst_video_buffer_pool_new ();
+      else
+        pool = gst_buffer_pool_new ();
+      size = MAX (size, unit_size);
+
+      if (gst_query_get_n_allocation_pools (query) > 0)
+        gst_query_set_nth_allocation_pool (query, 0, pool, size, min, max);
+      else
+        gst_query_add_allocation_pool (query, pool, size, min, max);
+    }
+
+    gst_object_unref (pool);
+  }
+
+  return GST_BASE_TRANSFORM_CLASS (gst_videolevels_parent_class)->
+      decide_allocation (trans, query);
+}
+
+static gboolean
+gst_videolevels_stop (GstBaseTransform * trans)
+{
+  GstVideoLevels *videolevels = GST_VIDEOLEVELS (trans);
+
+  gst_videolevels_free_stripes (videolevels);
+
+  return TRUE;
+}
+
+/************************************************************************/
+/* GstVideoLevels method implementations                                */
+/************************************************************************/
+
+/**
+ * gst_videolevels_free_stripes:
+ * @videolevels: #GstVideoLevels
+ *
+ * Stop the worker threads and free the per-stripe state
+ */
+static void
+gst_videolevels_free_stripes (GstVideoLevels * videolevels)
+{
+  gint i, n;
+
+  if (videolevels->runner == NULL)
+    return;
+
+  n = gst_vision_task_runner_get_n_threads (videolevels->runner);
+  for (i = 0; i < n; i++) {
+    g_free (videolevels->stripes[i].histogram);
+    g_free (videolevels->stripes[i].row_bins);
+  }
+  g_free (videolevels->stripes);
+  g_free (videolevels->stripe_data);
+  gst_vision_task_runner_free (videolevels->runner);
+
+  videolevels->stripes = NULL;
+  videolevels->stripe_data = NULL;
+  videolevels->runner = NULL;
+  videolevels->stripes_nbins = 0;
+}
+
+/**
+ * gst_videolevels_setup_stripes:
+ * @videolevels: #GstVideoLevels
+ *
+ * (Re)create the worker threads if the number of threads or histogram bins
+ * changed, and split the frame into one stripe of rows per thread
+ */
+static void
+gst_videolevels_setup_stripes (GstVideoLevels * videolevels)
+{
+  guint n_threads;
+  gint i, n;
+
+  GST_OBJECT_LOCK (videolevels);
+  n_threads = videolevels->n_threads;
+  GST_OBJECT_UNLOCK (videolevels);
+
+  if (n_threads == 0)
+    n_threads = g_get_num_processors ();
+
+  if (videolevels->runner == NULL ||
+      gst_vision_task_runner_get_n_threads (videolevels->runner) != n_threads
+      || videolevels->stripes_nbins != videolevels->nbins) {
+    gst_videolevels_free_stripes (videolevels);
+
+    GST_DEBUG_OBJECT (videolevels, "Using %u threads", n_threads);
+
+    videolevels->runner = gst_vision_task_runner_new (n_threads);
+    videolevels->stripes = g_new0 (GstVideoLevelsStripe, n_threads);
+    videolevels->stripe_data = g_new (gpointer, n_threads);
+    for (i = 0; i < n_threads; i++) {
+      videolevels->stripes[i].videolevels = videolevels;
+      videolevels->stripes[i].histogram = g_new (gint, videolevels->nbins);
+      videolevels->stripe_data[i] = &videolevels->stripes[i];
+    }
+    videolevels->stripes_nbins = videolevels->nbins;
+  }
+
+  n = gst_vision_task_runner_get_n_threads (videolevels->runner);
+  for (i = 0; i < n; i++) {
+    videolevels->stripes[i].y_start = videolevels->height * i / n;
+    videolevels->stripes[i].y_end = videolevels->height * (i + 1) / n;
+  }
+}
+
+/**
+ * gst_videolevels_reset:
+ * @videolevels: #GstVideoLevels
+ *
+ * Reset instance variables and free memory
  */
 static void
 gst_videolevels_reset (GstVideoLevels * videolevels)
 {
+  gint i;
+
   videolevels->bpp_in = 0;
 
   videolevels->lower_input = DEFAULT_PROP_LOWIN;
   videolevels->upper_input = DEFAULT_PROP_HIGHIN;
   videolevels->lower_output = DEFAULT_PROP_LOWOUT;
   videolevels->upper_output = DEFAULT_PROP_HIGHOUT;
+  for (i = 0; i < 3; i++) {
+    videolevels->channel_lower_input[i] = DEFAULT_PROP_CHANNEL_LEVEL;
+    videolevels->channel_upper_input[i] = DEFAULT_PROP_CHANNEL_LEVEL;
+  }
 
   videolevels->auto_adjust = DEFAULT_PROP_AUTO;
   videolevels->interval = DEFAULT_PROP_INTERVAL;
   videolevels->last_auto_timestamp = GST_CLOCK_TIME_NONE;
 
+  videolevels->histogram_stride_x = DEFAULT_PROP_HISTOGRAM_STRIDE_X;
+  videolevels->histogram_stride_y = DEFAULT_PROP_HISTOGRAM_STRIDE_Y;
+  videolevels->roi_x = DEFAULT_PROP_ROI_X;
+  videolevels->roi_y = DEFAULT_PROP_ROI_Y;
+  videolevels->roi_width = DEFAULT_PROP_ROI_WIDTH;
+  videolevels->roi_height = DEFAULT_PROP_ROI_HEIGHT;
+  videolevels->fused_histogram = DEFAULT_PROP_FUSED_HISTOGRAM;
+  videolevels->fuse_pending = FALSE;
+  videolevels->agc_smoothing = DEFAULT_PROP_AGC_SMOOTHING;
+  videolevels->agc_deadband = DEFAULT_PROP_AGC_DEADBAND;
+  videolevels->agc_valid = FALSE;
+
+  videolevels->mode = DEFAULT_PROP_MODE;
+  videolevels->tiles_x = DEFAULT_PROP_TILES_X;
+  videolevels->tiles_y = DEFAULT_PROP_TILES_Y;
+  videolevels->clip_limit = DEFAULT_PROP_CLIP_LIMIT;
+
+  videolevels->stats_meta = DEFAULT_PROP_STATS_META;
+  videolevels->stats_histogram_bins = DEFAULT_PROP_STATS_HISTOGRAM_BINS;
+  videolevels->post_messages = DEFAULT_PROP_POST_MESSAGES;
+  videolevels->message_interval = DEFAULT_PROP_MESSAGE_INTERVAL;
+  videolevels->last_message_timestamp = GST_CLOCK_TIME_NONE;
+  videolevels->notify_levels = DEFAULT_PROP_NOTIFY_LEVELS;
+
+  g_free (videolevels->clahe_luts);
+  videolevels->clahe_luts = NULL;
+  videolevels->clahe_luts_size = 0;
+  g_free (videolevels->clahe_col_offset0);
+  g_free (videolevels->clahe_col_offset1);
+  g_free (videolevels->clahe_col_weight);
+  g_free (videolevels->equalize_cdf);
+  videolevels->clahe_col_offset0 = NULL;
+  videolevels->clahe_col_offset1 = NULL;
+  videolevels->clahe_col_weight = NULL;
+  videolevels->clahe_cols_width = 0;
+  videolevels->clahe_cols_tiles = 0;
+  videolevels->equalize_cdf = NULL;
+  videolevels->equalize_cdf_size = 0;
+
   videolevels->lower_pix_sat = 0.01f;
   videolevels->upper_pix_sat = 0.01f;
 
@@ -704,28 +1819,91 @@ gst_videolevels_reset (GstVideoLevels * videolevels)
   videolevels->histogram = NULL;
 }
 
-#define GINT_CLAMP(x, low, high) ((gint)(CLAMP((x),(low),(high))))
-#define GUINT8_CLAMP(x, low, high) ((guint8)(CLAMP((x),(low),(high))))
+/**
+ * gst_videolevels_calculate_stretch:
+ * @videolevels: #GstVideoLevels
+ *
+ * Compute the fixed-point parameters used by the ORC linear stretch, which
+ * replaces the 64K LUT lookup for >8-bit input. The input is clamped to
+ * [0, range] after subtracting the lower input level, shifted up to use the
+ * full 16 bits, then scaled by mult/65536. mult is rounded up so that the
+ * upper input level maps exactly to the upper output level; intermediate
+ * values are within one level of the LUT result. Only used for 8-bit
+ * single component output.
+ */
+static void
+gst_videolevels_calculate_stretch (GstVideoLevels * videolevels)
+{
+  guint range, shift, mult;
+  gint low_out = videolevels->lower_output;
+  gint high_out = videolevels->upper_output;
+
+  videolevels->use_stretch = FALSE;
+
+  /* inverted or degenerate mappings go through the LUT */
+  if (videolevels->bpp_in <= 8 || videolevels->bpp_out > 8 ||
+      videolevels->n_components != 1 ||
+      videolevels->mode != GST_VIDEOLEVELS_MODE_LINEAR ||
+      videolevels->lower_input >= videolevels->upper_input ||
+      low_out > high_out)
+    return;
+
+  range = videolevels->upper_input - videolevels->lower_input;
+  shift = 0;
+  while ((range << (shift + 1)) <= G_MAXUINT16)
+    shift++;
+
+  mult = (((guint) (high_out - low_out) << 16) + (range << shift) - 1) /
+      (range << shift);
+  if (mult > G_MAXUINT16)
+    return;
+
+  videolevels->stretch_low_in = videolevels->lower_input;
+  videolevels->stretch_range = range;
+  videolevels->stretch_shift = shift;
+  videolevels->stretch_mult = mult;
+  videolevels->stretch_low_out = low_out;
+  videolevels->use_stretch = TRUE;
+
+  GST_LOG_OBJECT (videolevels, "Using linear stretch: range=%u shift=%u "
+      "mult=%u", range, shift, mult);
+}
 
-static gboolean
-gst_videolevels_calculate_lut (GstVideoLevels * videolevels)
+/**
+ * gst_videolevels_invalidate_lut:
+ * @videolevels: #GstVideoLevels
+ *
+ * Schedule a rebuild of the lookup table before the next frame, so that
+ * several level changes between frames only cost one rebuild
+ */
+static void
+gst_videolevels_invalidate_lut (GstVideoLevels * videolevels)
 {
-  gint i;
-  gdouble m;
-  gdouble b;
-  guint8 *lut = (guint8 *) videolevels->lookup_table;
-  const guint16 max_in = (1 << videolevels->bpp_in) - 1;
-  guint16 low_in;
-  guint16 high_in;
-  const guint8 max_out = (1 << videolevels->bpp_out) - 1;
-  const guint8 low_out = videolevels->lower_output;
-  const guint8 high_out = videolevels->upper_output;
+  videolevels->lut_dirty = TRUE;
 
-  if (videolevels->bpp_in == 0) {
-    return FALSE;
-  }
+  /* transform isn't called in passthrough, so leave it right away, but only
+   * decide that on the levels that will actually be applied */
+  gst_videolevels_clamp_levels (videolevels);
+  gst_videolevels_check_passthrough (videolevels);
+}
 
-  GST_LOG_OBJECT (videolevels, "Calculating lookup table");
+/**
+ * gst_videolevels_clamp_levels:
+ * @videolevels: #GstVideoLevels
+ *
+ * Reset levels outside the input or output range to the range limits. Does
+ * nothing until the caps are known.
+ */
+static void
+gst_videolevels_clamp_levels (GstVideoLevels * videolevels)
+{
+  gint max_in, max_out, k;
+
+  if (videolevels->bpp_in == 0)
+    return;
+
+  max_in = (1 << videolevels->bpp_in) - 1;
+  max_out = (1 << videolevels->bpp_out) - 1;
 
   if (videolevels->lower_input < 0 || videolevels->lower_input > max_in) {
     videolevels->lower_input = 0;
@@ -735,61 +1913,624 @@ gst_videolevels_calculate_lut (GstVideoLevels * videolevels)
     videolevels->upper_input = max_in;
     g_object_notify_by_pspec (G_OBJECT (videolevels), properties[PROP_HIGHIN]);
   }
+  if (videolevels->lower_output < 0 || videolevels->lower_output > max_out) {
+    videolevels->lower_output = 0;
+    g_object_notify_by_pspec (G_OBJECT (videolevels), properties[PROP_LOWOUT]);
+  }
+  if (videolevels->upper_output < 0 || videolevels->upper_output > max_out) {
+    videolevels->upper_output = max_out;
+    g_object_notify_by_pspec (G_OBJECT (videolevels),
+        properties[PROP_HIGHOUT]);
+  }
+  for (k = 0; k < 3; k++) {
+    if (videolevels->channel_lower_input[k] > max_in) {
+      videolevels->channel_lower_input[k] = max_in;
+      g_object_notify_by_pspec (G_OBJECT (videolevels),
+          properties[PROP_LOWIN_RED + k]);
+    }
+    if (videolevels->channel_upper_input[k] > max_in) {
+      videolevels->channel_upper_input[k] = max_in;
+      g_object_notify_by_pspec (G_OBJECT (videolevels),
+          properties[PROP_HIGHIN_RED + k]);
+    }
+  }
+}
+
+/**
+ * gst_videolevels_channel_levels:
+ * @videolevels: #GstVideoLevels
+ * @k: colour component, 0 for red to 2 for blue
+ * @lower: (out): lower input level of the component
+ * @upper: (out): upper input level of the component
+ *
+ * Get the input levels of one ARGB64 colour component, falling back to the
+ * shared levels where the component has none of its own
+ */
+static void
+gst_videolevels_channel_levels (GstVideoLevels * videolevels, gint k,
+    gint * lower, gint * upper)
+{
+  *lower = videolevels->channel_lower_input[k] >= 0 ?
+      videolevels->channel_lower_input[k] : videolevels->lower_input;
+  *upper = videolevels->channel_upper_input[k] >= 0 ?
+      videolevels->channel_upper_input[k] : videolevels->upper_input;
+}
+
+/* whether ARGB64 input has any component with its own input levels */
+static gboolean
+gst_videolevels_has_channel_levels (GstVideoLevels * videolevels)
+{
+  gint k;
+
+  if (videolevels->n_components != 4)
+    return FALSE;
+
+  for (k = 0; k < 3; k++) {
+    if (videolevels->channel_lower_input[k] >= 0 ||
+        videolevels->channel_upper_input[k] >= 0)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/* store a lookup table entry in the output sample size and byte order */
+static inline void
+gst_videolevels_lut_store (GstVideoLevels * videolevels, gint idx, guint v)
+{
+  if (videolevels->bpp_out > 8) {
+    guint16 *lut = videolevels->lookup_table;
+    lut[idx] = videolevels->swap_out ? GUINT16_SWAP_LE_BE ((guint16) v) : v;
+  } else {
+    guint8 *lut = videolevels->lookup_table;
+    lut[idx] = v;
+  }
+}
+
+/* fill entries [start, end) of the lookup table */
+static void
+gst_videolevels_lut_fill (GstVideoLevels * videolevels, gint start, gint end,
+    guint v)
+{
+  gint i;
+
+  if (videolevels->bpp_out > 8) {
+    for (i = start; i < end; i++)
+      gst_videolevels_lut_store (videolevels, i, v);
+  } else {
+    memset ((guint8 *) videolevels->lookup_table + start, v, end - start);
+  }
+}
+
+/**
+ * gst_videolevels_fill_linear_lut:
+ * @videolevels: #GstVideoLevels
+ * @base: index of the first entry of the table to fill
+ * @low_in: lower input level
+ * @high_in: upper input level
+ * @low_out: lower output level
+ * @high_out: upper output level
+ *
+ * Fill one lookup table with the linear mapping (low_in, high_in) ->
+ * (low_out, high_out), saturating outside the input range.
+ * Entries are computed with 32.32 fixed-point arithmetic; the step is rounded
+ * up so that the result equals the exact floor of the linear mapping.
+ */
+static void
+gst_videolevels_fill_linear_lut (GstVideoLevels * videolevels, gint base,
+    gint low_in, gint high_in, gint low_out, gint high_out)
+{
+  const gint lut_size = videolevels->lut_size;
+  guint range_in, range_out;
+  guint64 step, acc;
+  gint i;
+
+  GST_LOG_OBJECT (videolevels, "Make linear LUT mapping (%d, %d) -> (%d, %d)",
+      low_in, high_in, low_out, high_out);
+
+  if (low_in == high_in) {
+    gst_videolevels_lut_fill (videolevels, base, base + lut_size, low_out);
+    return;
+  }
+
+  /* walk from low_in towards high_in, which may be either direction */
+  range_in = ABS (high_in - low_in);
+  range_out = ABS (high_out - low_out);
+  step = (((guint64) range_out << 32) + range_in - 1) / range_in;
+
+  acc = 0;
+  for (i = 0; i <= (gint) range_in; i++) {
+    guint delta = (guint) (acc >> 32);
+    gint idx = low_in < high_in ? low_in + i : low_in - i;
+    gst_videolevels_lut_store (videolevels, base + idx,
+        low_out <= high_out ? low_out + delta : low_out - delta);
+    acc += step;
+  }
+
+  /* saturate outside the input range */
+  if (low_in < high_in) {
+    gst_videolevels_lut_fill (videolevels, base, base + low_in, low_out);
+    gst_videolevels_lut_fill (videolevels, base + high_in + 1,
+        base + lut_size, high_out);
+  } else {
+    gst_videolevels_lut_fill (videolevels, base, base + high_in, high_out);
+    gst_videolevels_lut_fill (videolevels, base + low_in + 1,
+        base + lut_size, low_out);
+  }
+}
+
+/**
+ * gst_videolevels_calculate_lut:
+ * @videolevels: #GstVideoLevels
+ *
+ * Build the lookup table for the current levels. The table has one entry per
+ * possible input value (1 << bpp_in, at least 256 so 8-bit input can't read
+ * past it) and is indexed by the host order value. Entries are 8 or 16-bit
+ * depending on the output, and stored in the output byte order. ARGB64 with
+ * per-component input levels gets three consecutive tables, red to blue.
+ *
+ * Returns: TRUE on success
+ */
+static gboolean
+gst_videolevels_calculate_lut (GstVideoLevels * videolevels)
+{
+  const gint lut_size = 1 << MAX (videolevels->bpp_in, 8);
+  const gint entry_size = videolevels->bpp_out > 8 ? 2 : 1;
+  gint n_tables, k;
+
+  if (videolevels->bpp_in == 0) {
+    return FALSE;
+  }
+
+  GST_LOG_OBJECT (videolevels, "Calculating lookup table");
 
+  gst_videolevels_clamp_levels (videolevels);
   gst_videolevels_check_passthrough (videolevels);
 
-  if (!videolevels->passthrough) {
-    low_in = videolevels->lower_input;
-    high_in = videolevels->upper_input;
+  gst_videolevels_calculate_stretch (videolevels);
 
-    GST_LOG_OBJECT (videolevels, "Make linear LUT mapping (%d, %d) -> (%d, %d)",
-        low_in, high_in, low_out, high_out);
+  videolevels->per_channel = gst_videolevels_has_channel_levels (videolevels) &&
+      GST_VIDEOLEVELS_MODE (videolevels) == GST_VIDEOLEVELS_MODE_LINEAR;
 
-    if (low_in == high_in)
-      m = 0.0;
-    else
-      m = (high_out - low_out) / (gdouble) (high_in - low_in);
+  /* the ORC stretch doesn't need the table */
+  if (videolevels->passthrough || videolevels->use_stretch)
+    return TRUE;
 
-    b = low_out - m * low_in;
+  n_tables = videolevels->per_channel ? 3 : 1;
 
-    if (videolevels->endianness_in == G_LITTLE_ENDIAN)
-      for (i = 0; i < G_MAXUINT16; i++)
-        lut[i] = GUINT8_CLAMP (m * GUINT16_FROM_LE (i) + b, low_out, high_out);
-    else if (videolevels->endianness_in == G_BIG_ENDIAN)
-      for (i = 0; i < G_MAXUINT16; i++)
-        lut[i] = GUINT8_CLAMP (m * GUINT16_FROM_BE (i) + b, low_out, high_out);
-    else
-      for (i = 0; i < G_MAXUINT16; i++)
-        lut[i] = GUINT8_CLAMP (m * i + b, low_out, high_out);
+  if (videolevels->lut_size != lut_size ||
+      videolevels->lut_entry_size != entry_size ||
+      videolevels->lut_n_tables != n_tables) {
+    g_free (videolevels->lookup_table);
+    videolevels->lookup_table = g_malloc (n_tables * lut_size * entry_size);
+    videolevels->lut_size = lut_size;
+    videolevels->lut_entry_size = entry_size;
+    videolevels->lut_n_tables = n_tables;
+  }
+
+  if (GST_VIDEOLEVELS_MODE (videolevels) == GST_VIDEOLEVELS_MODE_EQUALIZE) {
+    gst_videolevels_calculate_equalize_lut (videolevels);
+    return TRUE;
+  }
+
+  if (videolevels->per_channel) {
+    for (k = 0; k < 3; k++) {
+      gint low_in, high_in;
+      gst_videolevels_channel_levels (videolevels, k, &low_in, &high_in);
+      gst_videolevels_fill_linear_lut (videolevels, k * lut_size, low_in,
+          high_in, videolevels->lower_output, videolevels->upper_output);
+    }
+  } else {
+    gst_videolevels_fill_linear_lut (videolevels, 0, videolevels->lower_input,
+        videolevels->upper_input, videolevels->lower_output,
+        videolevels->upper_output);
   }
 
   return TRUE;
 }
 
+/**
+ * gst_videolevels_calculate_equalize_lut:
+ * @videolevels: #GstVideoLevels
+ *
+ * Fill the lookup table from the cumulative histogram, spreading the input
+ * evenly over the output levels
+ */
+static void
+gst_videolevels_calculate_equalize_lut (GstVideoLevels * videolevels)
+{
+  const gint low_out = videolevels->lower_output;
+  const gint range_out = videolevels->upper_output - videolevels->lower_output;
+  const gint nbins = videolevels->nbins;
+  const gint maxVal = (1 << videolevels->bpp_in) - 1;
+  const gfloat factor = (gfloat) ((nbins - 1.0) / maxVal);
+  guint64 *cdf;
+  guint64 total, cdf_min;
+  gint i;
+
+  if (videolevels->histogram == NULL) {
+    /* no frame seen yet, use an identity stretch for now */
+    for (i = 0; i < videolevels->lut_size; i++)
+      gst_videolevels_lut_store (videolevels, i,
+          low_out + (gint64) range_out * MIN (i, maxVal) / maxVal);
+    return;
+  }
+
+  if (videolevels->equalize_cdf_size != nbins) {
+    g_free (videolevels->equalize_cdf);
+    videolevels->equalize_cdf = g_new (guint64, nbins);
+    videolevels->equalize_cdf_size = nbins;
+  }
+
+  cdf = videolevels->equalize_cdf;
+  total = 0;
+  for (i = 0; i < nbins; i++) {
+    total += videolevels->histogram[i];
+    cdf[i] = total;
+  }
+
+  cdf_min = 0;
+  for (i = 0; i < nbins; i++) {
+    if (cdf[i] > 0) {
+      cdf_min = cdf[i];
+      break;
+    }
+  }
+
+  for (i = 0; i < videolevels->lut_size; i++) {
+    gint bin = GINT_CLAMP (MIN (i, maxVal) * factor, 0, nbins - 1);
+    if (total > cdf_min && cdf[bin] > cdf_min)
+      gst_videolevels_lut_store (videolevels, i,
+          low_out + (gint64) range_out * (gint64) (cdf[bin] - cdf_min) /
+          (gint64) (total - cdf_min));
+    else
+      gst_videolevels_lut_store (videolevels, i, low_out);
+  }
+}
 
 /**
-* gst_videolevels_calculate_histogram
+ * gst_videolevels_clahe_setup:
+ * @videolevels: #GstVideoLevels
+ *
+ * Allocate the per-tile tables and precompute, for every column, the offsets
+ * of the two nearest tile tables and the interpolation weight between them
+ */
+static void
+gst_videolevels_clahe_setup (GstVideoLevels * videolevels)
+{
+  const gint tiles_x = videolevels->clahe_tiles_x;
+  const gint width = videolevels->width;
+  const gint nbins = videolevels->nbins;
+  gint size = videolevels->clahe_tiles_x * videolevels->clahe_tiles_y * nbins;
+  gint c, tx;
+
+  if (videolevels->clahe_luts_size != size) {
+    g_free (videolevels->clahe_luts);
+    videolevels->clahe_luts = g_new (guint16, size);
+    videolevels->clahe_luts_size = size;
+  }
+
+  if (videolevels->clahe_cols_width == width &&
+      videolevels->clahe_cols_tiles == tiles_x * nbins)
+    return;
+
+  g_free (videolevels->clahe_col_offset0);
+  g_free (videolevels->clahe_col_offset1);
+  g_free (videolevels->clahe_col_weight);
+  videolevels->clahe_col_offset0 = g_new (gint, width);
+  videolevels->clahe_col_offset1 = g_new (gint, width);
+  videolevels->clahe_col_weight = g_new (guint16, width);
+
+  tx = 0;
+  for (c = 0; c < width; c++) {
+    /* tile centers, in half pixels to stay exact */
+    gint center0, center1;
+
+    while (tx < tiles_x - 1 &&
+        c * 2 >= (width * (tx + 1) / tiles_x + width * (tx + 2) / tiles_x))
+      tx++;
+
+    center0 = width * tx / tiles_x + width * (tx + 1) / tiles_x;
+    if (c * 2 < center0 || tx == tiles_x - 1) {
+      /* before the first or after the last center, no interpolation */
+      videolevels->clahe_col_offset0[c] = tx * nbins;
+      videolevels->clahe_col_offset1[c] = tx * nbins;
+      videolevels->clahe_col_weight[c] = 0;
+    } else {
+      center1 = width * (tx + 1) / tiles_x + width * (tx + 2) / tiles_x;
+      videolevels->clahe_col_offset0[c] = tx * nbins;
+      videolevels->clahe_col_offset1[c] = (tx + 1) * nbins;
+      videolevels->clahe_col_weight[c] =
+          (c * 2 - center0) * 256 / (center1 - center0);
+    }
+  }
+
+  videolevels->clahe_cols_width = width;
+  videolevels->clahe_cols_tiles = tiles_x * nbins;
+}
+
+/* bin of an input value in the CLAHE histograms */
+static inline gint
+gst_videolevels_clahe_bin (GstVideoLevels * videolevels, guint v)
+{
+  v = MIN (v, videolevels->clahe_max);
+  return v >> videolevels->clahe_shift;
+}
+
+/**
+ * gst_videolevels_clahe_tiles:
+ * @data: #GstVideoLevelsStripe
+ *
+ * Compute the clipped histogram and mapping table of each tile in the tile
+ * rows assigned to this thread
+ */
+static void
+gst_videolevels_clahe_tiles (gpointer data)
+{
+  GstVideoLevelsStripe *stripe = data;
+  GstVideoLevels *videolevels = stripe->videolevels;
+  const gint nbins = videolevels->nbins;
+  const gint tiles_x = videolevels->clahe_tiles_x;
+  const gint tiles_y = videolevels->clahe_tiles_y;
+  const gint low_out = videolevels->lower_output;
+  const gint range_out = videolevels->upper_output - videolevels->lower_output;
+  gint *hist = stripe->histogram;
+  gint tx, ty, r, c, b;
+
+  for (ty = stripe->tile_y_start; ty < stripe->tile_y_end; ty++) {
+    gint y0 = videolevels->height * ty / tiles_y;
+    gint y1 = videolevels->height * (ty + 1) / tiles_y;
+
+    for (tx = 0; tx < tiles_x; tx++) {
+      gint x0 = videolevels->width * tx / tiles_x;
+      gint x1 = videolevels->width * (tx + 1) / tiles_x;
+      gint npix = (x1 - x0) * (y1 - y0);
+      guint16 *lut = videolevels->clahe_luts + (ty * tiles_x + tx) * nbins;
+      gint64 cdf;
+
+      memset (hist, 0, sizeof (gint) * nbins);
+
+      for (r = y0; r < y1; r++) {
+        guint8 *row = stripe->in_data + r * videolevels->stride_in;
+        if (videolevels->bpp_in > 8) {
+          guint16 *row16 = (guint16 *) row;
+          if (videolevels->swap_in) {
+            for (c = x0; c < x1; c++)
+              hist[gst_videolevels_clahe_bin (videolevels,
+                      GUINT16_SWAP_LE_BE (row16[c]))]++;
+          } else {
+            for (c = x0; c < x1; c++)
+              hist[gst_videolevels_clahe_bin (videolevels, row16[c])]++;
+          }
+        } else {
+          for (c = x0; c < x1; c++)
+            hist[gst_videolevels_clahe_bin (videolevels, row[c])]++;
+        }
+      }
+
+      /* clip the histogram and spread the excess over all bins */
+      if (videolevels->clip_limit > 0.0 && npix > 0) {
+        gint limit = MAX (1, (gint) (videolevels->clip_limit * npix / nbins));
+        gint excess = 0, add, rem;
+
+        for (b = 0; b < nbins; b++) {
+          if (hist[b] > limit) {
+            excess += hist[b] - limit;
+            hist[b] = limit;
+          }
+        }
+
+        add = excess / nbins;
+        rem = excess % nbins;
+        for (b = 0; b < nbins; b++)
+          hist[b] += add;
+        /* spread the remainder evenly across the range */
+        if (rem > 0) {
+          gint step = MAX (1, nbins / rem);
+          for (b = 0; b < nbins && rem > 0; b += step, rem--)
+            hist[b]++;
+        }
+      }
+
+      cdf = 0;
+      for (b = 0; b < nbins; b++) {
+        cdf += hist[b];
+        lut[b] = npix > 0 ? low_out + range_out * cdf / npix : low_out;
+      }
+    }
+  }
+}
+
+/**
+ * gst_videolevels_clahe_apply:
+ * @data: #GstVideoLevelsStripe
+ *
+ * Map the rows of one stripe through the bilinear interpolation of the four
+ * nearest tile tables. The table entries of each row are gathered with the
+ * tile offsets looked up from per-column tables, then blended with ORC using
+ * 8-bit weights.
+ */
+static void
+gst_videolevels_clahe_apply (gpointer data)
+{
+  GstVideoLevelsStripe *stripe = data;
+  GstVideoLevels *videolevels = stripe->videolevels;
+  const gint nbins = videolevels->nbins;
+  const gint tiles_x = videolevels->clahe_tiles_x;
+  const gint tiles_y = videolevels->clahe_tiles_y;
+  const gint height = videolevels->height;
+  const gint *off0 = videolevels->clahe_col_offset0;
+  const gint *off1 = videolevels->clahe_col_offset1;
+  const guint16 *wx = videolevels->clahe_col_weight;
+  const guint max = videolevels->clahe_max;
+  const gint shift = videolevels->clahe_shift;
+  const gint width = videolevels->width;
+  guint16 *bins = stripe->row_bins;
+  guint16 *g00 = bins + width;
+  guint16 *g01 = g00 + width;
+  guint16 *g10 = g01 + width;
+  guint16 *g11 = g10 + width;
+  gint r, c, ty;
+
+  ty = 0;
+  for (r = stripe->y_start; r < stripe->y_end; r++) {
+    guint8 *src = stripe->in_data + r * videolevels->stride_in;
+    guint8 *dst = stripe->out_data + r * videolevels->stride_out;
+    const guint16 *lut0, *lut1;
+    gint center0, center1, wy;
+
+    while (ty < tiles_y - 1 &&
+        r * 2 >= (height * (ty + 1) / tiles_y + height * (ty + 2) / tiles_y))
+      ty++;
+
+    center0 = height * ty / tiles_y + height * (ty + 1) / tiles_y;
+    lut0 = videolevels->clahe_luts + ty * tiles_x * nbins;
+    if (r * 2 < center0 || ty == tiles_y - 1) {
+      lut1 = lut0;
+      wy = 0;
+    } else {
+      center1 = height * (ty + 1) / tiles_y + height * (ty + 2) / tiles_y;
+      lut1 = lut0 + tiles_x * nbins;
+      wy = (r * 2 - center0) * 256 / (center1 - center0);
+    }
+
+    /* convert the row to bins first, keeping both loops branch free */
+    if (videolevels->bpp_in > 8) {
+      guint16 *src16 = (guint16 *) src;
+      if (videolevels->swap_in) {
+        for (c = 0; c < width; c++)
+          bins[c] = MIN (GUINT16_SWAP_LE_BE (src16[c]), max) >> shift;
+      } else {
+        for (c = 0; c < width; c++)
+          bins[c] = MIN (src16[c], max) >> shift;
+      }
+    } else {
+      for (c = 0; c < width; c++)
+        bins[c] = MIN (src[c], max);
+    }
+
+    for (c = 0; c < width; c++) {
+      g00[c] = lut0[off0[c] + bins[c]];
+      g01[c] = lut0[off1[c] + bins[c]];
+      g10[c] = lut1[off0[c] + bins[c]];
+      g11[c] = lut1[off1[c] + bins[c]];
+    }
+
+    if (videolevels->bpp_out > 8) {
+      guint16 *dst16 = (guint16 *) dst;
+      videolevels_orc_clahe_blend_u16 (dst16, g00, g01, g10, g11, wx, wy,
+          width);
+      if (videolevels->swap_out) {
+        for (c = 0; c < width; c++)
+          dst16[c] = GUINT16_SWAP_LE_BE (dst16[c]);
+      }
+    } else {
+      videolevels_orc_clahe_blend_u8 (dst, g00, g01, g10, g11, wx, wy, width);
+    }
+  }
+}
+
+/**
+ * gst_videolevels_clahe:
+ * @videolevels: #GstVideoLevels
+ * @in_data: input frame
+ * @out_data: output frame
+ *
+ * Contrast limited adaptive histogram equalization. The tile tables are
+ * computed with the tile rows split across threads, then the frame is mapped
+ * in row stripes.
+ */
+static void
+gst_videolevels_clahe (GstVideoLevels * videolevels, guint8 * in_data,
+    guint8 * out_data)
+{
+  gint i, n;
+
+  /* the tile count may have changed since the last frame */
+  videolevels->clahe_tiles_x = MIN (videolevels->tiles_x, videolevels->width);
+  videolevels->clahe_tiles_y = MIN (videolevels->tiles_y, videolevels->height);
+  videolevels->clahe_max = (1 << videolevels->bpp_in) - 1;
+  videolevels->clahe_shift = MAX (0, videolevels->bpp_in - 12);
+
+  gst_videolevels_clahe_setup (videolevels);
+
+  n = gst_vision_task_runner_get_n_threads (videolevels->runner);
+  for (i = 0; i < n; i++) {
+    GstVideoLevelsStripe *stripe = &videolevels->stripes[i];
+    stripe->in_data = in_data;
+    stripe->out_data = out_data;
+    stripe->tile_y_start = videolevels->clahe_tiles_y * i / n;
+    stripe->tile_y_end = videolevels->clahe_tiles_y * (i + 1) / n;
+
+    if (stripe->row_bins_width != videolevels->width) {
+      g_free (stripe->row_bins);
+      stripe->row_bins = g_new (guint16, videolevels->width * 5);
+      stripe->row_bins_width = videolevels->width;
+    }
+  }
+
+  gst_vision_task_runner_run (videolevels->runner,
+      gst_videolevels_clahe_tiles, videolevels->stripe_data);
+  gst_vision_task_runner_run (videolevels->runner,
+      gst_videolevels_clahe_apply, videolevels->stripe_data);
+}
+
+
+/**
+* gst_videolevels_histogram_stripe
+* @data: #GstVideoLevelsStripe
+*
+* Calculate the partial histogram of one stripe
+*/
+static void
+gst_videolevels_histogram_stripe (gpointer data)
+{
+  GstVideoLevelsStripe *stripe = data;
+  GstVideoLevels *videolevels = stripe->videolevels;
+  gint r;
+
+  memset (stripe->histogram, 0, sizeof (gint) * videolevels->nbins);
+
+  for (r = stripe->hist_y_start; r < stripe->hist_y_end;
+      r += videolevels->histogram_stride_y) {
+    gst_videolevels_histogram_row (videolevels,
+        stripe->in_data + r * videolevels->stride_in, stripe->hist_x_start,
+        stripe->hist_x_end, stripe->histogram);
+  }
+}
+
+/**
+* gst_videolevels_get_histogram_region
 * @videolevels: #GstVideoLevels
-* @data: input frame data
 *
-* Calculate histogram of input frame
+* Get the AGC region of interest clipped to the frame
+*/
+static void
+gst_videolevels_get_histogram_region (GstVideoLevels * videolevels,
+    gint * x0, gint * y0, gint * x1, gint * y1)
+{
+  /* clamp both operands first, their sum could overflow */
+  *x0 = MIN (videolevels->roi_x, videolevels->width);
+  *y0 = MIN (videolevels->roi_y, videolevels->height);
+  *x1 = videolevels->roi_width > 0 ?
+      *x0 + MIN (videolevels->roi_width, videolevels->width - *x0) :
+      videolevels->width;
+  *y1 = videolevels->roi_height > 0 ?
+      *y0 + MIN (videolevels->roi_height, videolevels->height - *y0) :
+      videolevels->height;
+}
+
+/**
+* gst_videolevels_merge_histograms
+* @videolevels: #GstVideoLevels
 *
-* Returns: TRUE on success
+* Sum the partial histograms of all stripes into the frame histogram
 */
-gboolean
-gst_videolevels_calculate_histogram (GstVideoLevels * videolevels,
-    guint16 * data)
+static void
+gst_videolevels_merge_histograms (GstVideoLevels * videolevels)
 {
   gint *hist;
   gint nbins = videolevels->nbins;
-  gint r;
-  gint c;
-  gfloat factor;
-  gint stride = videolevels->stride_in;
-  gint endianness = videolevels->endianness_in;
-  gint maxVal = (1 << videolevels->bpp_in) - 1;
-
-  factor = (gfloat) ((nbins - 1.0) / maxVal);
+  gint i, n, b;
 
   if (videolevels->histogram == NULL) {
     GST_DEBUG_OBJECT (videolevels,
@@ -798,49 +2539,213 @@ gst_videolevels_calculate_histogram (GstVideoLevels * videolevels,
   }
 
   hist = videolevels->histogram;
+  n = gst_vision_task_runner_get_n_threads (videolevels->runner);
+
+  memcpy (hist, videolevels->stripes[0].histogram, sizeof (gint) * nbins);
+  for (i = 1; i < n; i++) {
+    gint *partial = videolevels->stripes[i].histogram;
+    for (b = 0; b < nbins; b++)
+      hist[b] += partial[b];
+  }
+}
 
-  /* reset histogram */
-  memset (hist, 0, sizeof (gint) * nbins);
+/**
+* gst_videolevels_calculate_histogram
+* @videolevels: #GstVideoLevels
+* @data: input frame data
+*
+* Calculate histogram of input frame, each thread fills a partial histogram
+* for its stripe which are then summed. Only the AGC region of interest is
+* considered, sampled every histogram-stride-x columns and
+* histogram-stride-y rows.
+*
+* Returns: TRUE on success
+*/
+gboolean
+gst_videolevels_calculate_histogram (GstVideoLevels * videolevels,
+    guint16 * data)
+{
+  gint i, n;
+  gint x0, y0, x1, y1, n_rows;
 
   GST_LOG_OBJECT (videolevels, "Calculating histogram");
-  if (videolevels->bpp_in > 8) {
-    if (endianness == G_BYTE_ORDER) {
-      for (r = 0; r < videolevels->height; r++) {
-        for (c = 0; c < videolevels->width; c++) {
-          hist[GINT_CLAMP (data[c + r * stride / 2] * factor, 0, nbins - 1)]++;
-        }
-      }
-    } else {
-      for (r = 0; r < videolevels->height; r++) {
-        for (c = 0; c < videolevels->width; c++) {
-          hist[GINT_CLAMP (GUINT16_FROM_BE (data[c +
-                          r * stride / 2]) * factor, 0, nbins - 1)]++;
-        }
-      }
-    }
-  } else {
-    guint8 *data8 = (guint8 *) data;
-    for (r = 0; r < videolevels->height; r++) {
-      for (c = 0; c < videolevels->width; c++) {
-        hist[GINT_CLAMP (data8[c + r * stride / 2] * factor, 0, nbins - 1)]++;
-      }
-    }
+
+  gst_videolevels_get_histogram_region (videolevels, &x0, &y0, &x1, &y1);
+
+  /* split the sampled rows evenly between threads */
+  n_rows = (y1 - y0 + videolevels->histogram_stride_y - 1) /
+      videolevels->histogram_stride_y;
+
+  n = gst_vision_task_runner_get_n_threads (videolevels->runner);
+  for (i = 0; i < n; i++) {
+    GstVideoLevelsStripe *stripe = &videolevels->stripes[i];
+    stripe->in_data = (guint8 *) data;
+    stripe->hist_x_start = x0;
+    stripe->hist_x_end = x1;
+    stripe->hist_y_start =
+        y0 + (n_rows * i / n) * videolevels->histogram_stride_y;
+    stripe->hist_y_end =
+        MIN (y0 + (n_rows * (i + 1) / n) * videolevels->histogram_stride_y,
+        y1);
   }
+  gst_vision_task_runner_run (videolevels->runner,
+      gst_videolevels_histogram_stripe, videolevels->stripe_data);
+
+  gst_videolevels_merge_histograms (videolevels);
 
   return TRUE;
 }
 
 /**
-* gst_videolevels_auto_adjust
+* gst_videolevels_calculate_stats
 * @videolevels: #GstVideoLevels
-* @data: input frame data
+* @lower: lower input level applied to the frame
+* @upper: upper input level applied to the frame
 *
-* Calculate lower and upper levels based on the histogram of the frame
+* Summarize the current histogram into videolevels->stats
+*/
+static void
+gst_videolevels_calculate_stats (GstVideoLevels * videolevels, gint lower,
+    gint upper)
+{
+  GstVideoLevelsStats *stats = &videolevels->stats;
+  const gint *hist = videolevels->histogram;
+  const gint nbins = videolevels->nbins;
+  const gint maxVal = (1 << videolevels->bpp_in) - 1;
+  const float factor = maxVal / (nbins - 1.0f);
+  const guint out_bins = videolevels->stats_histogram_bins;
+  guint64 total = 0, weighted = 0, sum;
+  guint64 target_1, target_50, target_99;
+  gint i, first = -1, last = -1;
+
+  memset (stats, 0, sizeof (GstVideoLevelsStats));
+  stats->lower_input = lower;
+  stats->upper_input = upper;
+
+  for (i = 0; i < nbins; i++) {
+    if (hist[i] == 0)
+      continue;
+    if (first < 0)
+      first = i;
+    last = i;
+    total += hist[i];
+    weighted += (guint64) hist[i] * i;
+  }
+
+  if (total == 0)
+    return;
+
+  stats->n_samples = (guint) total;
+  stats->min = (gint) (first * factor);
+  stats->max = (gint) (last * factor);
+  stats->mean = (gdouble) weighted * factor / total;
+
+  target_1 = total / 100;
+  target_50 = total / 2;
+  target_99 = total - total / 100;
+  stats->percentile_1 = stats->median = stats->percentile_99 = -1;
+
+  sum = 0;
+  for (i = first; i <= last; i++) {
+    gint value = (gint) (i * factor);
+    sum += hist[i];
+    if (stats->percentile_1 < 0 && sum > target_1)
+      stats->percentile_1 = value;
+    if (stats->median < 0 && sum > target_50)
+      stats->median = value;
+    if (stats->percentile_99 < 0 && sum >= target_99)
+      stats->percentile_99 = value;
+    if (value <= MIN (lower, upper))
+      stats->saturated_low += hist[i];
+    if (value >= MAX (lower, upper))
+      stats->saturated_high += hist[i];
+  }
+
+  if (out_bins > 0) {
+    stats->n_bins = out_bins;
+    stats->histogram = videolevels->stats_histogram;
+    memset (stats->histogram, 0, out_bins * sizeof (guint32));
+    for (i = first; i <= last; i++)
+      stats->histogram[(guint64) i * out_bins / nbins] += hist[i];
+  }
+}
+
+/**
+* gst_videolevels_message_due
+* @videolevels: #GstVideoLevels
+* @timestamp: timestamp of the current buffer
+*
+* Rate limit element messages to one per message-interval
+*
+* Returns: TRUE if a message should be posted for this buffer
+*/
+static gboolean
+gst_videolevels_message_due (GstVideoLevels * videolevels,
+    GstClockTime timestamp)
+{
+  GstClockTimeDiff elapsed;
+
+  if (videolevels->last_message_timestamp != GST_CLOCK_TIME_NONE &&
+      timestamp != GST_CLOCK_TIME_NONE) {
+    elapsed = GST_CLOCK_DIFF (videolevels->last_message_timestamp, timestamp);
+    if (elapsed >= 0 && elapsed < (GstClockTimeDiff)
+        videolevels->message_interval)
+      return FALSE;
+  }
+
+  videolevels->last_message_timestamp = timestamp;
+  return TRUE;
+}
+
+/**
+* gst_videolevels_publish_stats
+* @videolevels: #GstVideoLevels
+* @outbuf: output buffer
+* @post_message: whether to post an element message
+*
+* Attach the statistics to the output buffer and/or post them on the bus
+*/
+static void
+gst_videolevels_publish_stats (GstVideoLevels * videolevels,
+    GstBuffer * outbuf, gboolean post_message)
+{
+  const GstVideoLevelsStats *stats = &videolevels->stats;
+  GstStructure *s;
+
+  if (videolevels->stats_meta)
+    gst_buffer_add_videolevels_meta (outbuf, stats);
+
+  if (!post_message)
+    return;
+
+  s = gst_structure_new ("videolevels",
+      "timestamp", G_TYPE_UINT64, GST_BUFFER_TIMESTAMP (outbuf),
+      "lower-input", G_TYPE_INT, stats->lower_input,
+      "upper-input", G_TYPE_INT, stats->upper_input,
+      "samples", G_TYPE_UINT, stats->n_samples,
+      "min", G_TYPE_INT, stats->min,
+      "max", G_TYPE_INT, stats->max,
+      "mean", G_TYPE_DOUBLE, stats->mean,
+      "percentile-1", G_TYPE_INT, stats->percentile_1,
+      "median", G_TYPE_INT, stats->median,
+      "percentile-99", G_TYPE_INT, stats->percentile_99,
+      "saturated-low", G_TYPE_UINT, stats->saturated_low,
+      "saturated-high", G_TYPE_UINT, stats->saturated_high, NULL);
+
+  gst_element_post_message (GST_ELEMENT (videolevels),
+      gst_message_new_element (GST_OBJECT (videolevels), s));
+}
+
+/**
+* gst_videolevels_adjust_from_histogram
+* @videolevels: #GstVideoLevels
+*
+* Calculate lower and upper levels based on the current histogram
 *
 * Returns: TRUE on success
 */
-gboolean
-gst_videolevels_auto_adjust (GstVideoLevels * videolevels, guint16 * data)
+static gboolean
+gst_videolevels_adjust_from_histogram (GstVideoLevels * videolevels)
 {
   guint npixsat;
   guint sum;
@@ -849,9 +2754,19 @@ gst_videolevels_auto_adjust (GstVideoLevels * videolevels, guint16 * data)
   gint minVal = 0;
   gint maxVal = (1 << videolevels->bpp_in) - 1;
   float factor = maxVal / (videolevels->nbins - 1.0f);
-  gst_videolevels_calculate_histogram (videolevels, data);
+  gint lower = videolevels->lower_input;
+  gint upper = videolevels->upper_input;
+
+  /* the equalization table is built from the histogram directly */
+  if (GST_VIDEOLEVELS_MODE (videolevels) == GST_VIDEOLEVELS_MODE_EQUALIZE) {
+    gst_videolevels_invalidate_lut (videolevels);
+    return TRUE;
+  }
 
-  size = videolevels->width * videolevels->height;
+  /* percentiles are relative to the number of sampled pixels */
+  size = 0;
+  for (i = 0; i < videolevels->nbins; i++)
+    size += videolevels->histogram[i];
 
   /* pixels to saturate on low end */
   npixsat = (guint) (videolevels->lower_pix_sat * size);
@@ -859,7 +2774,7 @@ gst_videolevels_auto_adjust (GstVideoLevels * videolevels, guint16 * data)
   for (i = 0; i < videolevels->nbins; i++) {
     sum += videolevels->histogram[i];
     if (sum > npixsat) {
-      videolevels->lower_input = (gint) CLAMP (i * factor, minVal, maxVal);
+      lower = (gint) CLAMP (i * factor, minVal, maxVal);
       break;
     }
   }
@@ -870,27 +2785,64 @@ gst_videolevels_auto_adjust (GstVideoLevels * videolevels, guint16 * data)
   for (i = videolevels->nbins - 1; i >= 0; i--) {
     sum += videolevels->histogram[i];
     if (sum > npixsat) {
-      videolevels->upper_input = (gint) CLAMP (i * factor, minVal, maxVal);
+      upper = (gint) CLAMP (i * factor, minVal, maxVal);
       break;
     }
   }
 
-  gst_videolevels_calculate_lut (videolevels);
+  /* exponential moving average of the measured levels */
+  if (videolevels->agc_valid && videolevels->agc_smoothing > 0.0) {
+    gdouble s = videolevels->agc_smoothing;
+    videolevels->agc_lower = s * videolevels->agc_lower + (1.0 - s) * lower;
+    videolevels->agc_upper = s * videolevels->agc_upper + (1.0 - s) * upper;
+  } else {
+    videolevels->agc_lower = lower;
+    videolevels->agc_upper = upper;
+    videolevels->agc_valid = TRUE;
+  }
+  lower = (gint) (videolevels->agc_lower + 0.5);
+  upper = (gint) (videolevels->agc_upper + 0.5);
+
+  /* only rebuild the LUT once the window has moved enough */
+  if (ABS (lower - videolevels->lower_input) <= videolevels->agc_deadband &&
+      ABS (upper - videolevels->upper_input) <= videolevels->agc_deadband) {
+    GST_LOG_OBJECT (videolevels, "Levels (%d, %d) within dead band, keeping "
+        "(%d, %d)", lower, upper, videolevels->lower_input,
+        videolevels->upper_input);
+    return TRUE;
+  }
+
+  videolevels->lower_input = lower;
+  videolevels->upper_input = upper;
+
+  gst_videolevels_invalidate_lut (videolevels);
 
   GST_LOG_OBJECT (videolevels, "Contrast stretch with npixsat=%d, (%d, %d)",
       npixsat, videolevels->lower_input, videolevels->upper_input);
 
-  g_object_notify_by_pspec (G_OBJECT (videolevels), properties[PROP_LOWIN]);
-  g_object_notify_by_pspec (G_OBJECT (videolevels), properties[PROP_HIGHIN]);
+  if (videolevels->notify_levels) {
+    g_object_notify_by_pspec (G_OBJECT (videolevels), properties[PROP_LOWIN]);
+    g_object_notify_by_pspec (G_OBJECT (videolevels), properties[PROP_HIGHIN]);
+  }
 
   return TRUE;
 }
 
+/**
+ * gst_videolevels_check_passthrough:
+ * @levels: #GstVideoLevels
+ *
+ * Pass buffers through untouched when the levels are an identity mapping.
+ * Passthrough buffers may be shared and are not seen by transform_ip, so
+ * it's only used when no frame needs to be analysed or tagged either.
+ */
 static void
 gst_videolevels_check_passthrough (GstVideoLevels * levels)
 {
   gboolean passthrough;
-  if (levels->bpp_in == 8 &&
+  if (levels->same_caps && levels->mode == GST_VIDEOLEVELS_MODE_LINEAR &&
+      levels->auto_adjust == 0 && !levels->stats_meta &&
+      !levels->post_messages && !gst_videolevels_has_channel_levels (levels) &&
       levels->lower_input == levels->lower_output &&
       levels->upper_input == levels->upper_output) {
     passthrough = TRUE;
@@ -28,6 +28,9 @@
 #include <gst/base/gstbasetransform.h>
 #include <gst/video/video.h>
 
+#include "gstvisiontaskrunner.h"
+#include "videolevelsmeta.h"
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_VIDEOLEVELS \
@@ -43,6 +46,7 @@ G_BEGIN_DECLS
 
 typedef struct _GstVideoLevels GstVideoLevels;
 typedef struct _GstVideoLevelsClass GstVideoLevelsClass;
+typedef struct _GstVideoLevelsStripe GstVideoLevelsStripe;
 
 /**
 * GstVideoLevelsAuto:
@@ -58,6 +62,20 @@ typedef enum {
   GST_VIDEOLEVELS_AUTO_CONTINUOUS
 } GstVideoLevelsAuto;
 
+/**
+* GstVideoLevelsMode:
+* @GST_VIDEOLEVELS_MODE_LINEAR: linear stretch between the input and output levels
+* @GST_VIDEOLEVELS_MODE_EQUALIZE: global histogram equalization
+* @GST_VIDEOLEVELS_MODE_CLAHE: contrast limited adaptive histogram equalization
+*
+* Mapping from input to output levels.
+*/
+typedef enum {
+  GST_VIDEOLEVELS_MODE_LINEAR,
+  GST_VIDEOLEVELS_MODE_EQUALIZE,
+  GST_VIDEOLEVELS_MODE_CLAHE
+} GstVideoLevelsMode;
+
 /**
 * GstVideoLevels:
 * @element: the parent element.
@@ -75,6 +93,11 @@ struct _GstVideoLevels
   gint bpp_in;
   gint bpp_out;
   gint endianness_in;
+  gint endianness_out;
+  gboolean swap_in;
+  gboolean swap_out;
+  gint n_components;
+  gboolean same_caps;
   gint stride_in;
   gint stride_out;
 
@@ -84,8 +107,25 @@ struct _GstVideoLevels
   gint lower_output;
   gint upper_output;
 
-  /* tables */
+  /* ARGB64 red, green and blue input levels, -1 to use the shared level */
+  gint channel_lower_input[3];
+  gint channel_upper_input[3];
+
+  /* tables, one per colour component when per_channel is set */
   gpointer lookup_table;
+  gint lut_size;
+  gint lut_entry_size;
+  gint lut_n_tables;
+  gboolean lut_dirty;
+  gboolean per_channel;
+
+  /* linear stretch parameters, used instead of the LUT for >8-bit input */
+  gboolean use_stretch;
+  guint16 stretch_low_in;
+  guint16 stretch_range;
+  guint16 stretch_shift;
+  guint16 stretch_mult;
+  guint16 stretch_low_out;
 
   GstVideoLevelsAuto auto_adjust;
   guint64 interval;
@@ -94,9 +134,62 @@ struct _GstVideoLevels
   gint nbins;
   gint * histogram;
 
+  /* histogram sampling */
+  guint histogram_stride_x;
+  guint histogram_stride_y;
+  gint roi_x;
+  gint roi_y;
+  gint roi_width;
+  gint roi_height;
+  gboolean fused_histogram;
+  gboolean fuse_pending;
+
+  /* equalization */
+  GstVideoLevelsMode mode;
+  gint tiles_x;
+  gint tiles_y;
+  gdouble clip_limit;
+  guint16 *clahe_luts;
+  gint clahe_luts_size;
+  gint *clahe_col_offset0;
+  gint *clahe_col_offset1;
+  guint16 *clahe_col_weight;
+  gint clahe_cols_width;
+  gint clahe_cols_tiles;
+  gint clahe_tiles_x;
+  gint clahe_tiles_y;
+  gint clahe_shift;
+  guint clahe_max;
+  guint64 *equalize_cdf;
+  gint equalize_cdf_size;
+
+  /* AGC smoothing */
+  gdouble agc_smoothing;
+  gint agc_deadband;
+  gboolean agc_valid;
+  gdouble agc_lower;
+  gdouble agc_upper;
+
   guint64 last_auto_timestamp;
 
+  /* statistics */
+  gboolean stats_meta;
+  guint stats_histogram_bins;
+  gboolean post_messages;
+  guint64 message_interval;
+  guint64 last_message_timestamp;
+  gboolean notify_levels;
+  GstVideoLevelsStats stats;
+  guint32 stats_histogram[GST_VIDEOLEVELS_META_MAX_BINS];
+
   gboolean passthrough;
+
+  /* threading */
+  guint n_threads;
+  GstVisionTaskRunner *runner;
+  GstVideoLevelsStripe *stripes;
+  gpointer *stripe_data;
+  gint stripes_nbins;
 };
 
 struct _GstVideoLevelsClass
@@ -0,0 +1,116 @@
+/* GStreamer KLV Metadata Support Library
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Benchmark of building and parsing a MISB ST 0601 UAS Datalink local set
+ * like the one klvinject attaches to each buffer.
+ *
+ * Usage: klv-bench [iterations]
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+
+#include <gst/gst.h>
+
+#include "klvbuilder.h"
+
+#define DEFAULT_ITERATIONS 1000000
+
+static void
+klv_bench_report (const gchar * name, gint64 start, gint iterations)
+{
+  gint64 elapsed = g_get_monotonic_time () - start;
+
+  g_print ("%-8s %8.1f ns/packet\n", name,
+      elapsed * 1000.0 / MAX (iterations, 1));
+}
+
+int
+main (int argc, char **argv)
+{
+  const guint8 key[GST_KLV_KEY_SIZE] = GST_KLV_UAS_LOCAL_SET_KEY;
+  GstKLVLocalSetBuilder builder;
+  const guint8 *data = NULL;
+  gsize size = 0;
+  guint64 sum = 0;
+  gint iterations = DEFAULT_ITERATIONS;
+  gint64 start;
+  gint i;
+
+  if (argc > 1)
+    iterations = atoi (argv[1]);
+
+  gst_klv_local_set_builder_init (&builder, key);
+  gst_klv_local_set_builder_put_uint (&builder,
+      GST_KLV_UAS_TAG_PRECISION_TIME_STAMP, 0, 8);
+  gst_klv_local_set_builder_put_data (&builder,
+      GST_KLV_UAS_TAG_IMAGE_COORDINATE_SYSTEM, (guint8 *) "Geodetic WGS84", 14);
+  gst_klv_local_set_builder_put_int (&builder,
+      GST_KLV_UAS_TAG_SENSOR_LATITUDE, gst_klv_scale_int (51.449825, 90.0,
+          4), 4);
+  gst_klv_local_set_builder_put_int (&builder,
+      GST_KLV_UAS_TAG_SENSOR_LONGITUDE, gst_klv_scale_int (-2.600439, 180.0,
+          4), 4);
+  gst_klv_local_set_builder_put_uint (&builder,
+      GST_KLV_UAS_TAG_SENSOR_TRUE_ALTITUDE,
+      gst_klv_scale_uint (10.0, -900.0, 19000.0, 2), 2);
+  gst_klv_local_set_builder_put_uint (&builder, GST_KLV_UAS_TAG_VERSION, 17,
+      1);
+
+  /* per buffer, klvinject only updates the timestamp */
+  start = g_get_monotonic_time ();
+  for (i = 0; i < iterations; i++) {
+    gst_klv_local_set_builder_set_uint (&builder,
+        GST_KLV_UAS_TAG_PRECISION_TIME_STAMP, i);
+    data = gst_klv_local_set_builder_finish (&builder, &size);
+  }
+  klv_bench_report ("build", start, iterations);
+
+  g_print ("packet of %" G_GSIZE_FORMAT " bytes\n", size);
+
+  /* klvdemux and consumers parse the packet, check it and read items */
+  start = g_get_monotonic_time ();
+  for (i = 0; i < iterations; i++) {
+    GstKLVPacket packet;
+    GstKLVLocalSetIter iter;
+    GstKLVLocalSetItem item;
+    guint64 value;
+
+    if (!gst_klv_packet_parse (data, size, &packet) ||
+        !gst_klv_packet_verify_checksum (&packet))
+      g_error ("built packet doesn't parse");
+
+    gst_klv_local_set_iter_init (&iter, packet.value, packet.length);
+    while (gst_klv_local_set_iter_next (&iter, &item)) {
+      if (gst_klv_local_set_item_get_uint (&item, &value))
+        sum += value;
+    }
+  }
+  klv_bench_report ("parse", start, iterations);
+
+  /* keep the parse loop from being optimised away */
+  g_print ("checksum of values %" G_GUINT64_FORMAT "\n", sum);
+
+  gst_klv_local_set_builder_clear (&builder);
+
+  return 0;
+}
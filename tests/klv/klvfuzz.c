@@ -0,0 +1,156 @@
+/* GStreamer KLV Metadata Support Library
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Fuzz target for the KLV packet and local set parser.
+ *
+ * LLVMFuzzerTestOneInput() can be linked with libFuzzer, defining
+ * KLV_FUZZ_NO_MAIN; otherwise main() runs it once on each file given on the
+ * command line and can check whether the file holds a valid packet, which
+ * is how the seeds are checked by ctest. Every input is copied to an
+ * allocation of exactly its size so that a sanitizer catches reads past
+ * the end.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <gst/gst.h>
+
+#include "klvparse.h"
+
+int LLVMFuzzerTestOneInput (const guint8 * data, size_t size);
+
+static void
+klv_fuzz_local_set (const guint8 * data, gsize size)
+{
+  GstKLVLocalSetIter iter;
+  GstKLVLocalSetItem item;
+  guint64 uval;
+  gint64 ival;
+
+  gst_klv_local_set_iter_init (&iter, data, size);
+  while (gst_klv_local_set_iter_next (&iter, &item)) {
+    gst_klv_local_set_item_get_uint (&item, &uval);
+    gst_klv_local_set_item_get_int (&item, &ival);
+  }
+
+  if (gst_klv_local_set_find (data, size, GST_KLV_TAG_CHECKSUM, &item))
+    gst_klv_local_set_item_get_uint (&item, &uval);
+}
+
+int
+LLVMFuzzerTestOneInput (const guint8 * data, size_t size)
+{
+  GstKLVIter iter;
+  GstKLVPacket packet;
+  gsize length, consumed;
+  guint tag;
+
+  gst_klv_read_ber_length (data, size, &length, &consumed);
+  gst_klv_read_ber_oid (data, size, &tag, &consumed);
+
+  gst_klv_iter_init (&iter, data, size);
+  while (gst_klv_iter_next (&iter, &packet)) {
+    gst_klv_packet_verify_checksum (&packet);
+    klv_fuzz_local_set (packet.value, packet.length);
+  }
+
+  /* the input as the value of a packet, as klvdemux does with meta */
+  klv_fuzz_local_set (data, size);
+
+  return 0;
+}
+
+#ifndef KLV_FUZZ_NO_MAIN
+typedef enum
+{
+  KLV_FUZZ_EXPECT_ANY,
+  KLV_FUZZ_EXPECT_VALID,
+  KLV_FUZZ_EXPECT_INVALID
+} KlvFuzzExpect;
+
+/* whether @data starts with a packet whose checksum is correct */
+static gboolean
+klv_fuzz_is_valid (const guint8 * data, gsize size)
+{
+  GstKLVPacket packet;
+
+  return gst_klv_packet_parse (data, size, &packet) &&
+      gst_klv_packet_verify_checksum (&packet);
+}
+
+/* Usage: klv-fuzz [[--valid|--invalid|--any] FILE...]...
+ *
+ * --valid and --invalid make the files after them fail the run unless
+ * they hold a packet with a correct checksum, or don't. */
+int
+main (int argc, char **argv)
+{
+  KlvFuzzExpect expect = KLV_FUZZ_EXPECT_ANY;
+  gint i, ret = 0;
+
+  for (i = 1; i < argc; i++) {
+    GError *error = NULL;
+    gchar *contents;
+    gsize size;
+    guint8 *data;
+    gboolean valid;
+
+    if (g_str_equal (argv[i], "--valid")) {
+      expect = KLV_FUZZ_EXPECT_VALID;
+      continue;
+    } else if (g_str_equal (argv[i], "--invalid")) {
+      expect = KLV_FUZZ_EXPECT_INVALID;
+      continue;
+    } else if (g_str_equal (argv[i], "--any")) {
+      expect = KLV_FUZZ_EXPECT_ANY;
+      continue;
+    }
+
+    if (!g_file_get_contents (argv[i], &contents, &size, &error)) {
+      g_printerr ("%s\n", error->message);
+      g_error_free (error);
+      return 1;
+    }
+
+    data = g_malloc (size);
+    memcpy (data, contents, size);
+    g_free (contents);
+
+    LLVMFuzzerTestOneInput (data, size);
+    valid = klv_fuzz_is_valid (data, size);
+    g_free (data);
+
+    g_print ("%s: %" G_GSIZE_FORMAT " bytes, %s\n", argv[i], size,
+        valid ? "valid" : "invalid");
+
+    if ((expect == KLV_FUZZ_EXPECT_VALID && !valid) ||
+        (expect == KLV_FUZZ_EXPECT_INVALID && valid)) {
+      g_printerr ("%s: expected a %s packet\n", argv[i],
+          expect == KLV_FUZZ_EXPECT_VALID ? "valid" : "invalid");
+      ret = 1;
+    }
+  }
+
+  return ret;
+}
+#endif
@@ -0,0 +1,137 @@
+/* GStreamer
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/*
+ * Checks that videolevels copes with buffers it may not write to, which
+ * is what it gets after a tee or whenever upstream keeps a reference.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include <gst/check/gstcheck.h>
+#include <gst/check/gstharness.h>
+
+#include "videolevelsmeta.h"
+
+#define WIDTH 16
+#define HEIGHT 4
+
+#define GRAY8_CAPS "video/x-raw,format=GRAY8,width=16,height=4,framerate=30/1"
+#define GRAY16_CAPS \
+    "video/x-raw,format=GRAY16_LE,width=16,height=4,framerate=30/1"
+
+/* pushes a buffer that is still referenced here, so it isn't writable */
+static void
+push_shared_buffer (GstHarness * h, gsize size, gboolean expect_meta)
+{
+  GstBuffer *in, *out;
+  GstMapInfo map;
+  guint8 *ref;
+  gsize i;
+
+  in = gst_harness_create_buffer (h, size);
+  fail_unless (gst_buffer_map (in, &map, GST_MAP_WRITE));
+  for (i = 0; i < size; i++)
+    map.data[i] = i * 7;
+  ref = g_malloc (size);
+  memcpy (ref, map.data, size);
+  gst_buffer_unmap (in, &map);
+
+  gst_buffer_ref (in);
+  fail_if (gst_buffer_is_writable (in));
+
+  out = gst_harness_push_and_pull (h, in);
+  fail_unless (out != NULL);
+
+  fail_unless (gst_buffer_map (out, &map, GST_MAP_READ));
+  fail_unless_equals_int (map.size, size);
+  fail_unless (memcmp (map.data, ref, size) == 0);
+  gst_buffer_unmap (out, &map);
+
+  /* the shared input must be left as it was */
+  fail_unless (gst_buffer_get_videolevels_meta (in) == NULL);
+  fail_unless (gst_buffer_map (in, &map, GST_MAP_READ));
+  fail_unless (memcmp (map.data, ref, size) == 0);
+  gst_buffer_unmap (in, &map);
+
+  if (expect_meta)
+    fail_unless (gst_buffer_get_videolevels_meta (out) != NULL);
+
+  gst_buffer_unref (out);
+  gst_buffer_unref (in);
+  g_free (ref);
+}
+
+GST_START_TEST (test_identity_gray8_shared)
+{
+  GstHarness *h = gst_harness_new ("videolevels");
+
+  gst_harness_set_caps_str (h, GRAY8_CAPS, GRAY8_CAPS);
+  push_shared_buffer (h, WIDTH * HEIGHT, FALSE);
+  push_shared_buffer (h, WIDTH * HEIGHT, FALSE);
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_identity_gray16_shared)
+{
+  GstHarness *h = gst_harness_new ("videolevels");
+
+  gst_harness_set_caps_str (h, GRAY16_CAPS, GRAY16_CAPS);
+  push_shared_buffer (h, WIDTH * HEIGHT * 2, FALSE);
+  push_shared_buffer (h, WIDTH * HEIGHT * 2, FALSE);
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+GST_START_TEST (test_identity_stats_meta_shared)
+{
+  GstHarness *h = gst_harness_new ("videolevels");
+
+  g_object_set (h->element, "stats-meta", TRUE, NULL);
+  gst_harness_set_caps_str (h, GRAY16_CAPS, GRAY16_CAPS);
+  push_shared_buffer (h, WIDTH * HEIGHT * 2, TRUE);
+
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
+static Suite *
+videolevels_suite (void)
+{
+  Suite *s = suite_create ("videolevels");
+  TCase *tc = tcase_create ("general");
+
+  suite_add_tcase (s, tc);
+  tcase_add_test (tc, test_identity_gray8_shared);
+  tcase_add_test (tc, test_identity_gray16_shared);
+  tcase_add_test (tc, test_identity_stats_meta_shared);
+
+  return s;
+}
+
+GST_CHECK_MAIN (videolevels);